@@ -10,10 +10,16 @@
 #include "../../integer.h"
 #include "../cstdint/types.h"
 #include "../numbers/signedness.h"
+#include "../radix_powers.h"
 #include "../scaled/declaration.h"
 #include "../unreachable.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl::_impl {
@@ -24,6 +30,57 @@ namespace cnl::_impl {
         static constexpr int radix = Radix;
     };
 
+    // (std::numeric_limits<std::int64_t>::max() / 10) / 5^n for every n in [0, 26)
+    inline constexpr auto max_descaled_odd_significands{[]() {
+        std::array<std::uint64_t, 26> limits{};
+        auto limit{static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max() / 10)};
+        for (auto& element : limits) {
+            element = limit;
+            limit /= 5;
+        }
+        return limits;
+    }()};
+
+    // the result of descale of a 64-bit significand scaled by 2^InExponent to a decimal significand;
+    // descale multiplies an odd significand by ten if it is no greater than max_odd and otherwise halves it,
+    // so while it remains odd, each multiplication by ten is followed by an exact halving;
+    // a run of such steps is performed with a single multiplication by a power of five
+    template<int InExponent>
+    [[nodiscard]] constexpr auto descale_binary_fraction(std::int64_t const& input) -> descaled<std::int64_t, 10>
+    {
+        static_assert(InExponent < 0);
+        constexpr auto max_odd{max_descaled_odd_significands[0]};
+
+        auto const is_negative{input < 0};
+        auto const magnitude{
+                is_negative ? std::uint64_t{0} - static_cast<std::uint64_t>(input) : static_cast<std::uint64_t>(input)};
+        auto const trailing_zeros{std::min(std::countr_zero(magnitude), -InExponent)};
+        auto significand{magnitude >> trailing_zeros};
+        auto num_halvings{-InExponent - trailing_zeros};
+
+        auto num_fractional_digits{0};
+        while (num_fractional_digits != num_halvings
+               && num_fractional_digits != int(max_descaled_odd_significands.size())
+               && significand <= max_descaled_odd_significands[num_fractional_digits]) {
+            ++num_fractional_digits;
+        }
+        significand *= radix_powers<std::uint64_t, 5>[num_fractional_digits];
+        num_halvings -= num_fractional_digits;
+
+        for (; num_halvings; --num_halvings) {
+            if ((significand & 1) && significand <= max_odd) {
+                significand *= 5;
+                ++num_fractional_digits;
+            } else {
+                significand >>= 1;
+            }
+        }
+
+        return descaled<std::int64_t, 10>{
+                static_cast<std::int64_t>(is_negative ? std::uint64_t{0} - significand : significand),
+                -num_fractional_digits};
+    }
+
     template<
             integer Significand = std::int64_t, int OutRadix = 10,
             bool Precise = false,
@@ -51,6 +108,11 @@ namespace cnl::_impl {
                   }};
 
         if constexpr (InExponent < 0) {
+            if constexpr (
+                    std::is_same_v<Significand, std::int64_t> && OutRadix == 10 && !Precise && InRadix == 2) {
+                return descale_binary_fraction<InExponent>(output.significand);
+            }
+
             for (int in_exponent = InExponent;
                  in_exponent != 0 || (Precise && !(output.significand % OutRadix));) {
                 if (output.significand % InRadix) {
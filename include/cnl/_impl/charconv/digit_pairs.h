@@ -0,0 +1,67 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief generation of decimal digits two at a time
+
+#if !defined(CNL_IMPL_CHARCONV_DIGIT_PAIRS_H)
+#define CNL_IMPL_CHARCONV_DIGIT_PAIRS_H
+
+#include "../radix_powers.h"
+#include "constants.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // "00", "01", ..., "99"
+        inline constexpr auto digit_pairs{[]() {
+            std::array<char, 200> pairs{};
+            for (auto n{0}; n != 100; ++n) {
+                pairs[n * 2] = static_cast<char>(zero_char + n / 10);
+                pairs[n * 2 + 1] = static_cast<char>(zero_char + n % 10);
+            }
+            return pairs;
+        }()};
+
+        // number of decimal digits in value
+        [[nodiscard]] constexpr auto count_digits(std::uint64_t value) -> int
+        {
+            // floor(log10(2) * bit width) is the number of digits or one less
+            auto const estimate{(static_cast<int>(std::bit_width(value)) * 1233) >> 12};
+            return std::max(1, estimate + int{value >= radix_powers<std::uint64_t, 10>[estimate]});
+        }
+
+        // writes the decimal digits of value so that they end at last;
+        // returns the position of the most significant digit
+        template<std::unsigned_integral Unsigned>
+        [[nodiscard]] constexpr auto to_chars_digits_backward(char* last, Unsigned value) -> char*
+        {
+            while (value >= 100) {
+                auto const pair{static_cast<int>(value % 100) * 2};
+                value /= 100;
+                last -= 2;
+                last[0] = digit_pairs[pair];
+                last[1] = digit_pairs[pair + 1];
+            }
+            if (value >= 10) {
+                auto const pair{static_cast<int>(value) * 2};
+                last -= 2;
+                last[0] = digit_pairs[pair];
+                last[1] = digit_pairs[pair + 1];
+            } else {
+                *--last = static_cast<char>(zero_char + static_cast<int>(value));
+            }
+            return last;
+        }
+    }
+}
+
+#endif  // CNL_IMPL_CHARCONV_DIGIT_PAIRS_H
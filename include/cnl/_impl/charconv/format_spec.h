@@ -0,0 +1,190 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::format_spec and its parser
+
+#if !defined(CNL_IMPL_CHARCONV_FORMAT_SPEC_H)
+#define CNL_IMPL_CHARCONV_FORMAT_SPEC_H
+
+#include "constants.h"
+
+#include <iterator>
+#include <string_view>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief alignment of a formatted number within its field
+    /// \headerfile cnl/scaled_integer.h
+    enum class format_align {
+        none,
+        left,
+        center,
+        right
+    };
+
+    /// \brief which signs of a formatted number are written
+    /// \headerfile cnl/scaled_integer.h
+    enum class format_sign {
+        minus,
+        plus,
+        space
+    };
+
+    /// \brief the options which control how \ref cnl::format_to writes a number
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \note The members correspond to the fields of the standard format specification,
+    /// `[[fill]align][sign][#][0][width][.precision][type]`, which \ref cnl::parse_format_spec reads.
+    struct format_spec {
+        /// character written to pad the number to width
+        char fill{' '};
+
+        /// position of the number within width; numbers are right-aligned by default
+        format_align align{format_align::none};
+
+        format_sign sign{format_sign::minus};
+
+        /// if true, a radix point is always written
+        bool alternate{false};
+
+        /// if true, and align is none, the number is padded with zeros which follow its sign
+        bool zero_pad{false};
+
+        /// minimum number of characters written
+        int width{0};
+
+        /// number of digits after the radix point, or -1 for the default
+        int precision{-1};
+
+        /// one of `'\0'`, `'f'`, `'F'`, `'e'`, `'E'`, `'a'` and `'A'`
+        char type{'\0'};
+    };
+
+    /// \brief result of \ref cnl::parse_format_spec
+    template<class Iterator>
+    struct parse_format_spec_result {
+        format_spec spec;
+
+        /// the first character which is not part of the specification
+        Iterator ptr;
+
+        /// `std::errc::invalid_argument` if the specification is malformed
+        std::errc ec;
+    };
+
+    namespace _impl {
+        [[nodiscard]] constexpr auto to_format_align(char c)
+        {
+            switch (c) {
+            case '<':
+                return format_align::left;
+            case '^':
+                return format_align::center;
+            case '>':
+                return format_align::right;
+            default:
+                return format_align::none;
+            }
+        }
+
+        [[nodiscard]] constexpr auto is_format_type(char c)
+        {
+            return c == 'f' || c == 'F' || c == 'e' || c == 'E' || c == 'a' || c == 'A';
+        }
+
+        // parses a run of decimal digits, which must not be empty, into value
+        template<class Iterator>
+        [[nodiscard]] constexpr auto parse_format_integer(Iterator& first, Iterator last, int& value)
+        {
+            if (first == last || !isdigit(*first)) {
+                return false;
+            }
+            constexpr auto max_value{1'000'000};
+            for (value = 0; first != last && isdigit(*first); ++first) {
+                value = value * 10 + (*first - zero_char);
+                if (value > max_value) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /// \brief reads a standard format specification for numbers, e.g. `"*>+12.3f"`
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \param first beginning of the specification
+    /// \param last end of the characters which may hold the specification
+    ///
+    /// \note Parsing stops at `last` or at the first `'}'`.
+    /// Locale-specific formatting, `L`, and nested replacement fields are not accepted.
+    template<class Iterator>
+    [[nodiscard]] constexpr auto parse_format_spec(Iterator first, Iterator last)
+    {
+        using result = parse_format_spec_result<Iterator>;
+        auto spec{format_spec{}};
+
+        if (first != last && std::next(first) != last && _impl::to_format_align(*std::next(first)) != format_align::none) {
+            spec.fill = *first;
+            spec.align = _impl::to_format_align(*std::next(first));
+            std::advance(first, 2);
+        } else if (first != last && _impl::to_format_align(*first) != format_align::none) {
+            spec.align = _impl::to_format_align(*first);
+            ++first;
+        }
+        if (spec.fill == '{' || spec.fill == '}') {
+            return result{spec, first, std::errc::invalid_argument};
+        }
+
+        if (first != last && (*first == _impl::plus_char || *first == _impl::minus_char || *first == ' ')) {
+            spec.sign = (*first == _impl::plus_char) ? format_sign::plus
+                      : (*first == ' ')               ? format_sign::space
+                                                      : format_sign::minus;
+            ++first;
+        }
+
+        if (first != last && *first == '#') {
+            spec.alternate = true;
+            ++first;
+        }
+
+        if (first != last && *first == _impl::zero_char) {
+            spec.zero_pad = true;
+            ++first;
+        }
+
+        if (first != last && _impl::isdigit(*first) && !_impl::parse_format_integer(first, last, spec.width)) {
+            return result{spec, first, std::errc::invalid_argument};
+        }
+
+        if (first != last && *first == _impl::radix_char) {
+            ++first;
+            if (!_impl::parse_format_integer(first, last, spec.precision)) {
+                return result{spec, first, std::errc::invalid_argument};
+            }
+        }
+
+        if (first != last && _impl::is_format_type(*first)) {
+            spec.type = *first;
+            ++first;
+        }
+
+        if (first != last && *first != '}') {
+            return result{spec, first, std::errc::invalid_argument};
+        }
+        return result{spec, first, std::errc{}};
+    }
+
+    /// \brief reads a standard format specification for numbers from a string
+    /// \headerfile cnl/scaled_integer.h
+    [[nodiscard]] constexpr auto parse_format_spec(std::string_view spec)
+    {
+        return parse_format_spec(spec.begin(), spec.end());
+    }
+}
+
+#endif  // CNL_IMPL_CHARCONV_FORMAT_SPEC_H
@@ -0,0 +1,165 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::from_chars overloaded on cnl::integer
+
+#if !defined(CNL_IMPL_CHARCONV_FROM_CHARS_H)
+#define CNL_IMPL_CHARCONV_FROM_CHARS_H
+
+#include "../../integer.h"
+#include "../cnl_assert.h"
+#include "../numbers/set_signedness.h"
+#include "../num_traits/digits.h"
+#include "../numbers/signedness.h"
+#include "constants.h"
+#include "parse_digits.h"
+
+#include <charconv>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // the value of c as a digit in the given base, or -1 if it is not a digit
+        [[nodiscard]] constexpr auto ctoi(char c, int base) -> int
+        {
+            auto const value{
+                    (c >= zero_char && c <= '9') ? c - zero_char
+                    : (c >= 'a' && c <= 'z')     ? c - ('a' - 10)
+                    : (c >= 'A' && c <= 'Z')     ? c - ('A' - 10)
+                                                 : base};
+            return (value < base) ? value : -1;
+        }
+
+        template<typename Natural>
+        struct from_chars_natural_result {
+            Natural value;
+            char const* ptr;
+            bool is_overflow;
+        };
+
+        // accumulates blocks of BlockDigits decimal digits at the start of [first, last) into value
+        // for as long as doing so cannot take it above max; returns the end of the digits accumulated
+        template<int BlockDigits, typename Natural>
+        [[nodiscard]] inline auto from_chars_decimal_blocks(
+                char const* first, char const* last, Natural& value, Natural const& max) -> char const*
+        {
+            auto const block_base{
+                    static_cast<Natural>(BlockDigits == 8 ? std::uint64_t{100'000'000} : std::uint64_t{10'000'000'000'000'000})};
+            if (max < block_base) {
+                return first;
+            }
+            auto const max_quotient{static_cast<Natural>((max - (block_base - Natural{1})) / block_base)};
+            while (last - first >= BlockDigits && value <= max_quotient) {
+                auto const block{parse_decimal_block<BlockDigits>(first)};
+                if (!block) {
+                    break;
+                }
+                value = static_cast<Natural>(value * block_base + static_cast<Natural>(*block));
+                first += BlockDigits;
+            }
+            return first;
+        }
+
+        // reads the longest sequence of digits at the start of [first, last);
+        // digits which would take the value above max are consumed but not accumulated
+        template<typename Natural>
+        [[nodiscard]] constexpr auto from_chars_natural(
+                char const* first, char const* last, Natural const& max, int base)
+                -> from_chars_natural_result<Natural>
+        {
+            auto const natural_base{static_cast<Natural>(base)};
+            auto const max_quotient{static_cast<Natural>(max / natural_base)};
+            auto const max_remainder{static_cast<Natural>(max - max_quotient * natural_base)};
+
+            auto value{Natural{0}};
+            if constexpr (swar_parse_enabled && digits_v<Natural> >= 32) {
+                // at run time, long runs of decimal digits are parsed a block at a time
+                if (base == 10 && !std::is_constant_evaluated()) {
+                    if constexpr (digits_v<Natural> >= 64) {
+                        first = from_chars_decimal_blocks<16>(first, last, value, max);
+                    }
+                    first = from_chars_decimal_blocks<8>(first, last, value, max);
+                }
+            }
+
+            auto is_overflow{false};
+            for (; first != last; ++first) {
+                auto const digit{ctoi(*first, base)};
+                if (digit < 0) {
+                    break;
+                }
+
+                auto const natural_digit{static_cast<Natural>(digit)};
+                if (value > max_quotient || (value == max_quotient && natural_digit > max_remainder)) {
+                    is_overflow = true;
+                } else if (!is_overflow) {
+                    value = static_cast<Natural>(value * natural_base + natural_digit);
+                }
+            }
+            return from_chars_natural_result<Natural>{value, first, is_overflow};
+        }
+
+        // the magnitude of the largest value of type, Integer, with the given sign
+        template<integer Integer>
+        [[nodiscard]] constexpr auto max_magnitude(bool is_negative)
+        {
+            using natural = numbers::set_signedness_t<Integer, false>;
+            auto const max{static_cast<natural>(std::numeric_limits<Integer>::max())};
+            return is_negative ? static_cast<natural>(max + natural{1}) : max;
+        }
+
+        // the value of type, Integer, with the given magnitude and sign
+        template<integer Integer, typename Natural>
+        [[nodiscard]] constexpr auto from_magnitude(Natural const& magnitude, bool is_negative)
+        {
+            return static_cast<Integer>(is_negative ? static_cast<Natural>(Natural{0} - magnitude) : magnitude);
+        }
+
+        // true iff [first, last) begins with a minus sign which is permitted in a value of type, Number
+        template<typename Number>
+        [[nodiscard]] constexpr auto from_chars_is_negative(char const* first, char const* last)
+        {
+            return numbers::signedness_v<Number> && first != last && *first == minus_char;
+        }
+    }
+
+    /// \brief partial implementation of std::from_chars overloaded on cnl::integer
+    /// \headerfile cnl/wide_integer.h
+    ///
+    /// \param first beginning of the characters to parse
+    /// \param last end of the characters to parse
+    /// \param value number to which the result is assigned on success
+    /// \param base number base of the digits; one of 2, 8, 10 and 16
+    ///
+    /// \note As with std::from_chars, a minus sign is only accepted if `value` is signed,
+    /// and neither a plus sign nor a base prefix is accepted.
+    /// \return a `std::from_chars_result` with the same semantics as the result of std::from_chars
+
+    template<integer Integer>
+    [[nodiscard]] constexpr auto from_chars(
+            char const* const first, char const* const last, Integer& value, int base = 10)
+    {
+        CNL_ASSERT(base == 2 || base == 8 || base == 10 || base == 16);
+
+        auto const is_negative{_impl::from_chars_is_negative<Integer>(first, last)};
+        auto const natural{_impl::from_chars_natural(
+                first + is_negative, last, _impl::max_magnitude<Integer>(is_negative), base)};
+        if (natural.ptr == first + is_negative) {
+            return std::from_chars_result{first, std::errc::invalid_argument};
+        }
+        if (natural.is_overflow) {
+            return std::from_chars_result{natural.ptr, std::errc::result_out_of_range};
+        }
+
+        value = _impl::from_magnitude<Integer>(natural.value, is_negative);
+        return std::from_chars_result{natural.ptr, std::errc{}};
+    }
+}
+
+#endif  // CNL_IMPL_CHARCONV_FROM_CHARS_H
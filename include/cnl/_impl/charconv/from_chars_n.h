@@ -0,0 +1,84 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::from_chars_n, parsing of separated text into a sequence of numbers
+
+#if !defined(CNL_IMPL_CHARCONV_FROM_CHARS_N_H)
+#define CNL_IMPL_CHARCONV_FROM_CHARS_N_H
+
+#include "../cnl_assert.h"
+#include "from_chars.h"
+
+#include <cstddef>
+#include <span>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief result of \ref cnl::from_chars_n
+    struct from_chars_n_result {
+        /// one past the last character consumed or, on failure, the position of the error
+        char const* ptr;
+
+        /// `std::errc{}` on success or the error which stopped parsing
+        std::errc ec;
+
+        /// number of values assigned
+        std::size_t count;
+
+        friend constexpr auto operator==(from_chars_n_result const&, from_chars_n_result const&) -> bool = default;
+    };
+
+    /// \brief reads a sequence of numbers from separated text
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \param first beginning of the characters to parse
+    /// \param last end of the characters to parse
+    /// \param values numbers to which the results are assigned
+    /// \param separator character expected between consecutive values, e.g. `','`
+    /// \param offsets if non-empty, receives the position of the first character of each value,
+    /// measured from `first`; must be at least as long as `values`
+    ///
+    /// \note Each value is parsed as by \ref cnl::from_chars in base 10.
+    /// Parsing stops after `values` is full; characters which follow are not examined.
+    /// \return a \ref cnl::from_chars_n_result holding the end of the parsed text and the number of values assigned;
+    /// `ec` is `std::errc::invalid_argument` if a value or separator is missing
+    /// and `std::errc::result_out_of_range` if a value does not fit
+    template<typename Number, std::size_t Extent>
+    [[nodiscard]] constexpr auto from_chars_n(
+            char const* const first,
+            char const* const last,
+            std::span<Number, Extent> values,
+            char separator,
+            std::span<std::ptrdiff_t> offsets = {})
+    {
+        CNL_ASSERT(offsets.empty() || offsets.size() >= values.size());
+
+        auto in{first};
+        for (auto index{std::size_t{0}}; index != values.size(); ++index) {
+            if (index) {
+                if (in == last || *in != separator) {
+                    return from_chars_n_result{in, std::errc::invalid_argument, index};
+                }
+                ++in;
+            }
+
+            auto const result{from_chars(in, last, values[index])};
+            if (result.ec != std::errc{}) {
+                return from_chars_n_result{result.ptr, result.ec, index};
+            }
+
+            if (!offsets.empty()) {
+                offsets[index] = in - first;
+            }
+            in = result.ptr;
+        }
+
+        return from_chars_n_result{in, std::errc{}, values.size()};
+    }
+}
+
+#endif  // CNL_IMPL_CHARCONV_FROM_CHARS_N_H
@@ -0,0 +1,103 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief parsing of blocks of decimal digits several at a time
+
+#if !defined(CNL_IMPL_CHARCONV_PARSE_DIGITS_H)
+#define CNL_IMPL_CHARCONV_PARSE_DIGITS_H
+
+#include "../config.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#if defined(CNL_SIMD_PARSE_ENABLED)
+#include <smmintrin.h>
+#endif
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // true iff blocks of digits can be loaded into a word with the first digit in the least significant byte
+        inline constexpr auto swar_parse_enabled{std::endian::native == std::endian::little};
+
+        // the eight characters starting at first, with the first character in the least significant byte
+        [[nodiscard]] inline auto load_eight_chars(char const* first) -> std::uint64_t
+        {
+            std::uint64_t chars{};
+            std::memcpy(&chars, first, sizeof(chars));
+            return chars;
+        }
+
+        // true iff every byte of chars is in the range ['0', '9']
+        [[nodiscard]] constexpr auto is_eight_digits(std::uint64_t chars) -> bool
+        {
+            return ((chars & 0xF0F0F0F0F0F0F0F0) | (((chars + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+                == 0x3333333333333333;
+        }
+
+        // the value of eight decimal digits with the most significant digit in the least significant byte;
+        // pairs, then quads and then octets of digits are combined in parallel within the word
+        [[nodiscard]] constexpr auto eight_digits_value(std::uint64_t chars) -> std::uint32_t
+        {
+            constexpr auto mask{std::uint64_t{0x000000FF000000FF}};
+            constexpr auto multiplier_lower{std::uint64_t{100} + (std::uint64_t{1000000} << 32)};
+            constexpr auto multiplier_upper{std::uint64_t{1} + (std::uint64_t{10000} << 32)};
+            auto const digits{chars - 0x3030303030303030};
+            auto const pairs{digits * 10 + (digits >> 8)};
+            return static_cast<std::uint32_t>(
+                    (((pairs & mask) * multiplier_lower) + (((pairs >> 16) & mask) * multiplier_upper)) >> 32);
+        }
+
+        // the value of the NumDigits characters starting at first if they are all decimal digits;
+        // NumDigits is either 8 or 16
+        template<int NumDigits>
+        [[nodiscard]] inline auto parse_decimal_block(char const* first) -> std::optional<std::uint64_t>
+        {
+            static_assert(swar_parse_enabled);
+            if constexpr (NumDigits == 8) {
+                auto const chars{load_eight_chars(first)};
+                if (!is_eight_digits(chars)) {
+                    return std::nullopt;
+                }
+                return eight_digits_value(chars);
+            } else {
+                static_assert(NumDigits == 16);
+#if defined(CNL_SIMD_PARSE_ENABLED)
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                auto const chars{_mm_loadu_si128(reinterpret_cast<__m128i const*>(first))};
+                auto const digits{_mm_sub_epi8(chars, _mm_set1_epi8('0'))};
+                auto const nines{_mm_set1_epi8(9)};
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(digits, nines), nines)) != 0xffff) {
+                    return std::nullopt;
+                }
+
+                auto const pairs{_mm_maddubs_epi16(digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1))};
+                auto const quads{_mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1))};
+                auto const packed_quads{_mm_packus_epi32(quads, quads)};
+                auto const octets{_mm_madd_epi16(packed_quads, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1))};
+                auto const upper{static_cast<std::uint32_t>(_mm_cvtsi128_si32(octets))};
+                auto const lower{static_cast<std::uint32_t>(_mm_extract_epi32(octets, 1))};
+                return std::uint64_t{upper} * 100'000'000 + lower;
+#else
+                auto const upper{parse_decimal_block<8>(first)};
+                if (!upper) {
+                    return std::nullopt;
+                }
+                auto const lower{parse_decimal_block<8>(first + 8)};
+                if (!lower) {
+                    return std::nullopt;
+                }
+                return *upper * 100'000'000 + *lower;
+#endif
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_CHARCONV_PARSE_DIGITS_H
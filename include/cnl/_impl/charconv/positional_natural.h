@@ -0,0 +1,235 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief a natural number whose digits, in base 2 or 10, can be read and rounded individually
+
+#if !defined(CNL_IMPL_CHARCONV_POSITIONAL_NATURAL_H)
+#define CNL_IMPL_CHARCONV_POSITIONAL_NATURAL_H
+
+#include "../cnl_assert.h"
+#include "constants.h"
+#include "digit_pairs.h"
+#include "../num_traits/digits.h"
+#include "../numbers/signedness.h"
+#include "../radix_powers.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl::_impl {
+    // a natural number stored as an array of limbs, least significant limb first,
+    // where each limb holds the same number of digits in base Base
+    template<int Base, int NumLimbs>
+    class positional_natural {
+        static_assert(Base == 2 || Base == 10);
+
+    public:
+        static constexpr int limb_digits{Base == 10 ? 9 : 32};
+        static constexpr auto limb_radix{Base == 10 ? std::uint64_t{1'000'000'000} : std::uint64_t{1} << 32};
+
+        // multiplies the number by factor
+        constexpr void multiply(std::uint32_t factor)
+        {
+            auto carry{std::uint64_t{0}};
+            for (auto index{0}; index != _num_limbs; ++index) {
+                auto const product{std::uint64_t{_limbs[index]} * factor + carry};
+                _limbs[index] = static_cast<std::uint32_t>(product % limb_radix);
+                carry = product / limb_radix;
+            }
+            for (; carry; carry /= limb_radix) {
+                push_limb(static_cast<std::uint32_t>(carry % limb_radix));
+            }
+        }
+
+        // appends a limb which is more significant than any other
+        constexpr void push_limb(std::uint32_t limb)
+        {
+            CNL_ASSERT(_num_limbs < NumLimbs);
+            CNL_ASSERT(limb < limb_radix);
+            _limbs[_num_limbs++] = limb;
+        }
+
+        // the digit which is worth Base^position
+        [[nodiscard]] constexpr auto digit(int position) const -> int
+        {
+            if (position < 0 || position >= _num_limbs * limb_digits) {
+                return 0;
+            }
+            return static_cast<int>(
+                    _limbs[position / limb_digits] / unit(position % limb_digits) % static_cast<std::uint32_t>(Base));
+        }
+
+        // writes the count digits which start at position and descend, as characters
+        template<class OutputIt>
+        constexpr auto write_digits(OutputIt out, int position, int count) const
+        {
+            auto const num_limb_digits{_num_limbs * limb_digits};
+            for (; count > 0 && position >= num_limb_digits; --count, --position) {
+                *out++ = zero_char;
+            }
+
+            while (count > 0 && position >= 0) {
+                auto limb_chars{std::array<char, limb_digits>{}};
+                limb_to_chars(limb_chars, _limbs[position / limb_digits]);
+
+                auto const* const first{limb_chars.data() + (limb_digits - 1 - position % limb_digits)};
+                auto const length{std::min(count, static_cast<int>(limb_chars.data() + limb_digits - first))};
+                out = std::copy_n(first, length, out);
+                count -= length;
+                position -= length;
+            }
+
+            for (; count > 0; --count) {
+                *out++ = zero_char;
+            }
+            return out;
+        }
+
+        // the number of digits, not counting leading zeros
+        [[nodiscard]] constexpr auto num_digits() const -> int
+        {
+            auto top_limb{_num_limbs};
+            while (top_limb && !_limbs[top_limb - 1]) {
+                --top_limb;
+            }
+            if (!top_limb) {
+                return 0;
+            }
+
+            auto digits{(top_limb - 1) * limb_digits + 1};
+            for (auto limb{_limbs[top_limb - 1]}; limb >= static_cast<std::uint32_t>(Base); limb /= Base) {
+                ++digits;
+            }
+            return digits;
+        }
+
+        // the position of the least significant non-zero digit, or 0 if the number is zero
+        [[nodiscard]] constexpr auto num_trailing_zeros() const -> int
+        {
+            for (auto position{0}; position < _num_limbs * limb_digits; ++position) {
+                if (digit(position)) {
+                    return position;
+                }
+            }
+            return 0;
+        }
+
+        // rounds to the nearest multiple of Base^position, with ties rounded to even
+        constexpr void round(int position)
+        {
+            if (position <= 0) {
+                return;
+            }
+
+            auto const half{Base / 2};
+            auto const discarded{digit(position - 1)};
+            auto const is_round_up{
+                    discarded > half
+                    || (discarded == half && (!is_zero_below(position - 1) || (digit(position) & 1)))};
+
+            // clear the discarded digits
+            auto const limb_index{position / limb_digits};
+            for (auto index{0}; index != std::min(limb_index, _num_limbs); ++index) {
+                _limbs[index] = 0;
+            }
+            if (limb_index < _num_limbs) {
+                _limbs[limb_index] -= _limbs[limb_index] % unit(position % limb_digits);
+            }
+
+            if (is_round_up) {
+                add_unit(position);
+            }
+        }
+
+    private:
+        // the digits of limb, most significant first and including leading zeros
+        static constexpr void limb_to_chars(std::array<char, limb_digits>& chars, std::uint32_t limb)
+        {
+            if constexpr (Base == 10) {
+                std::fill(chars.begin(), chars.end(), zero_char);
+                static_cast<void>(to_chars_digits_backward(chars.data() + limb_digits, limb));
+            } else {
+                for (auto index{limb_digits - 1}; index >= 0; --index, limb >>= 1) {
+                    chars[index] = static_cast<char>(zero_char + (limb & 1));
+                }
+            }
+        }
+
+        // Base^exponent, for exponent in the range [0, limb_digits)
+        [[nodiscard]] static constexpr auto unit(int exponent) -> std::uint32_t
+        {
+            static_assert(limb_digits <= num_radix_powers<std::uint32_t, Base>);
+            return radix_powers<std::uint32_t, Base>[exponent];
+        }
+
+        [[nodiscard]] constexpr auto is_zero_below(int position) const -> bool
+        {
+            auto const limb_index{position / limb_digits};
+            for (auto index{0}; index != std::min(limb_index, _num_limbs); ++index) {
+                if (_limbs[index]) {
+                    return false;
+                }
+            }
+            return limb_index >= _num_limbs || !(_limbs[limb_index] % unit(position % limb_digits));
+        }
+
+        // adds Base^position
+        constexpr void add_unit(int position)
+        {
+            auto index{position / limb_digits};
+            while (_num_limbs <= index) {
+                push_limb(0);
+            }
+
+            auto carry{std::uint64_t{unit(position % limb_digits)}};
+            for (; carry && index != _num_limbs; ++index) {
+                auto const sum{_limbs[index] + carry};
+                _limbs[index] = static_cast<std::uint32_t>(sum % limb_radix);
+                carry = sum / limb_radix;
+            }
+            if (carry) {
+                push_limb(static_cast<std::uint32_t>(carry));
+            }
+        }
+
+        std::array<std::uint32_t, NumLimbs> _limbs{};
+        int _num_limbs{0};
+    };
+
+    // the magnitude of integer as a specialization of positional_natural
+    template<class Natural, typename Integer>
+    [[nodiscard]] constexpr auto make_positional_natural(Integer const& integer)
+    {
+        auto result{Natural{}};
+        if constexpr (digits_v<Integer> <= digits_v<std::uint64_t>) {
+            auto magnitude{std::uint64_t{}};
+            if constexpr (numbers::signedness_v<Integer>) {
+                auto const value{static_cast<std::int64_t>(integer)};
+                magnitude = (value < 0) ? std::uint64_t{0} - static_cast<std::uint64_t>(value)
+                                        : static_cast<std::uint64_t>(value);
+            } else {
+                magnitude = static_cast<std::uint64_t>(integer);
+            }
+            for (auto remaining{magnitude}; remaining; remaining /= Natural::limb_radix) {
+                result.push_limb(static_cast<std::uint32_t>(remaining % Natural::limb_radix));
+            }
+        } else {
+            // the remainders have the same sign as integer
+            auto const radix{static_cast<Integer>(Natural::limb_radix)};
+            for (auto remaining{integer}; remaining != Integer{0};) {
+                auto const remainder{static_cast<std::int64_t>(static_cast<Integer>(remaining % radix))};
+                result.push_limb(static_cast<std::uint32_t>(remainder < 0 ? -remainder : remainder));
+                remaining = static_cast<Integer>(remaining / radix);
+            }
+        }
+        return result;
+    }
+}
+
+#endif  // CNL_IMPL_CHARCONV_POSITIONAL_NATURAL_H
@@ -16,10 +16,14 @@
 #include "../num_traits/set_rounding.h"
 #include "../numbers/signedness.h"
 #include "constants.h"
+#include "digit_pairs.h"
 #include "to_chars_capacity.h"
 
+#include <algorithm>
 #include <array>
 #include <charconv>
+#include <concepts>
+#include <cstdint>
 #include <limits>
 #include <string_view>
 #include <system_error>
@@ -36,23 +40,105 @@ namespace cnl {
             return static_cast<char>(c);
         }
 
-        // cnl::_impl::to_chars_natural
-        [[nodiscard]] constexpr auto to_chars_natural(char* ptr, char* last, auto const& value, int base = 10) -> char*
+        // largest power of base that fits in a std::uint64_t
+        // and the number of digits it takes to represent one less than it
+        struct natural_chunk {
+            std::uint64_t divisor;
+            int num_digits;
+        };
+
+        [[nodiscard]] constexpr auto make_natural_chunk(int base)
         {
-            auto const quotient = value / base;
+            auto const wide_base{static_cast<std::uint64_t>(base)};
+            auto chunk{natural_chunk{wide_base, 1}};
+            while (chunk.divisor <= std::numeric_limits<std::uint64_t>::max() / wide_base) {
+                chunk.divisor *= wide_base;
+                ++chunk.num_digits;
+            }
+            return chunk;
+        }
 
-            auto const next_ptr = quotient ? to_chars_natural(ptr, last, quotient, base) : ptr;
+        // writes the digits of value so that they end at last;
+        // returns the position of the most significant digit
+        template<std::unsigned_integral Unsigned>
+        [[nodiscard]] constexpr auto to_chars_chunk_backward(char* last, Unsigned value, int base) -> char*
+        {
+            if (base == 10) {
+                return to_chars_digits_backward(last, value);
+            }
+
+            auto const wide_base{static_cast<Unsigned>(base)};
+            do {
+                *--last = itoc(static_cast<int>(value % wide_base));
+                value /= wide_base;
+            } while (value);
+            return last;
+        }
+
+        // number of digits it takes to represent value
+        [[nodiscard]] constexpr auto count_chunk_digits(std::uint64_t value, int base) -> int
+        {
+            if (base == 10) {
+                return count_digits(value);
+            }
 
-            if (next_ptr == last || next_ptr == nullptr) {
-                return nullptr;
+            auto const wide_base{static_cast<std::uint64_t>(base)};
+            auto num_digits{1};
+            for (; value >= wide_base; value /= wide_base) {
+                ++num_digits;
             }
+            return num_digits;
+        }
 
-            // Note: linker may struggle with combination of clang, int128_t and sanitizer.
-            // (See posix.cmake for details.)
-            auto const remainder = value - (quotient * base);
-            *next_ptr = itoc(static_cast<int>(remainder));
+        // cnl::_impl::to_chars_natural
+        [[nodiscard]] constexpr auto to_chars_natural(char* ptr, char* last, auto const& value, int base = 10) -> char*
+        {
+            using natural = std::remove_cvref_t<decltype(value)>;
+
+            if constexpr (digits_v<natural> <= 64) {
+                // narrower division is faster on some targets
+                using chunk_type = std::conditional_t<(digits_v<natural> <= 32), std::uint32_t, std::uint64_t>;
+                auto const chunk{static_cast<chunk_type>(value)};
+                auto const num_digits{count_chunk_digits(chunk, base)};
+                if (num_digits > last - ptr) {
+                    return nullptr;
+                }
 
-            return next_ptr + 1;
+                auto* const natural_last{ptr + num_digits};
+                [[maybe_unused]] auto const* const natural_first{
+                        to_chars_chunk_backward(natural_last, chunk, base)};
+                CNL_ASSERT(natural_first == ptr);
+                return natural_last;
+            } else {
+                // enough for every digit in base 2
+                std::array<char, digits_v<natural> + 1> digits{};
+                auto* const digits_last{digits.data() + digits.size()};
+                auto* digits_first{digits_last};
+
+                // one multiword division per chunk of digits
+                auto const chunk{make_natural_chunk(base)};
+                auto const divisor{static_cast<natural>(chunk.divisor)};
+                auto remaining{static_cast<natural>(value)};
+                while (!(remaining < divisor)) {
+                    // Note: linker may struggle with combination of clang, int128_t and sanitizer.
+                    // (See posix.cmake for details.)
+                    auto const quotient{static_cast<natural>(remaining / divisor)};
+                    auto const remainder{
+                            static_cast<std::uint64_t>(remaining - static_cast<natural>(quotient * divisor))};
+
+                    auto* const chunk_first{digits_first - chunk.num_digits};
+                    std::fill(chunk_first, to_chars_chunk_backward(digits_first, remainder, base), zero_char);
+                    digits_first = chunk_first;
+                    remaining = quotient;
+                }
+                digits_first = to_chars_chunk_backward(digits_first, static_cast<std::uint64_t>(remaining), base);
+
+                if (digits_last - digits_first > last - ptr) {
+                    return nullptr;
+                }
+
+                return std::copy(digits_first, digits_last, ptr);
+            }
         }
 
         [[nodiscard]] constexpr auto
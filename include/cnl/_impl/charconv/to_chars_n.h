@@ -0,0 +1,98 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::to_chars_n, formatting of a sequence of numbers as separated text
+
+#if !defined(CNL_IMPL_CHARCONV_TO_CHARS_N_H)
+#define CNL_IMPL_CHARCONV_TO_CHARS_N_H
+
+#include "../cnl_assert.h"
+#include "to_chars.h"
+#include "to_chars_capacity.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief result of \ref cnl::to_chars_n
+    struct to_chars_n_result {
+        /// one past the last character written or, on failure, `last`
+        char* ptr;
+
+        /// `std::errc{}` on success or `std::errc::value_too_large` if the text does not fit
+        std::errc ec;
+
+        /// number of values written in full
+        std::size_t count;
+
+        friend constexpr auto operator==(to_chars_n_result const&, to_chars_n_result const&) -> bool = default;
+    };
+
+    /// \brief writes a sequence of numbers to a character buffer, one after another
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \param values numbers to format
+    /// \param first beginning of the destination
+    /// \param last end of the destination
+    /// \param separator character written between consecutive values, e.g. `','`
+    /// \param offsets if non-empty, receives the position of the first character of each value,
+    /// measured from `first`; must be at least as long as `values`
+    ///
+    /// \note Each value is formatted as by \ref cnl::to_chars in base 10.
+    /// Values are never truncated to fit the destination:
+    /// a value is either written in full or not at all.
+    /// \return a \ref cnl::to_chars_n_result holding the end of the written text and the number of values written
+    template<typename Number, std::size_t Extent>
+    [[nodiscard]] constexpr auto to_chars_n(
+            std::span<Number const, Extent> values,
+            char* const first,
+            char* const last,
+            char separator,
+            std::span<std::ptrdiff_t> offsets = {})
+    {
+        CNL_ASSERT(offsets.empty() || offsets.size() >= values.size());
+
+        // any value formats into this many characters without being truncated
+        constexpr auto capacity{_impl::to_chars_capacity<Number>{}()};
+
+        auto out{first};
+        for (auto index{std::size_t{0}}; index != values.size(); ++index) {
+            if (index) {
+                if (out == last) {
+                    return to_chars_n_result{last, std::errc::value_too_large, index};
+                }
+                *out++ = separator;
+            }
+
+            auto const& value{values[index]};
+            auto const value_first{out};
+            if (last - out >= capacity) {
+                out = to_chars(out, out + capacity, value).ptr;
+            } else {
+                // format near the end of the destination via a buffer to avoid truncation
+                std::array<char, capacity> chars{};
+                auto const result{to_chars(chars.data(), chars.data() + capacity, value)};
+                CNL_ASSERT(result.ec == std::errc{});
+                if (result.ptr - chars.data() > last - out) {
+                    return to_chars_n_result{last, std::errc::value_too_large, index};
+                }
+                out = std::copy(chars.data(), result.ptr, out);
+            }
+
+            if (!offsets.empty()) {
+                offsets[index] = value_first - first;
+            }
+        }
+
+        return to_chars_n_result{out, std::errc{}, values.size()};
+    }
+}
+
+#endif  // CNL_IMPL_CHARCONV_TO_CHARS_N_H
@@ -1,4 +1,3 @@
-
 //          Copyright John McFarlane 2021.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file ../LICENSE_1_0.txt or copy at
@@ -10,15 +9,109 @@
 #include "../../integer.h"
 #include "../cnl_assert.h"
 #include "../num_traits/digits.h"
+#include "../num_traits/set_width.h"
+#include "../num_traits/width.h"
+#include "../numbers/set_signedness.h"
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
 
 /// compositional numeric library
 namespace cnl {
+    namespace _impl {
+        // floor(sqrt(x)), one binary digit at a time; taken from
+        // https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29
+        template<integer Integer>
+        [[nodiscard]] constexpr auto digit_by_digit_sqrt(Integer const& x)
+        {
+            auto root = +Integer{0};
+            auto bit = Integer{1} << ((digits_v<Integer> - 1) & ~1);
+            auto num = decltype(root + bit){x};
+
+            while (bit > num) {
+                bit >>= 2;
+            }
+
+            while (bit) {
+                if (num >= root + bit) {
+                    num -= root + bit;
+                    root = (root >> 1) + bit;
+                } else {
+                    root >>= 1;
+                }
+                bit >>= 2;
+            }
+            return root;
+        }
+
+        // floor(sqrt(x) * 16) for every x in [0, 256)
+        inline constexpr auto sqrt_table{[]() {
+            std::array<std::uint8_t, 256> table{};
+            auto root{0};
+            for (auto x{0}; x != int(table.size()); ++x) {
+                while ((root + 1) * (root + 1) <= x * 256) {
+                    ++root;
+                }
+                table[x] = static_cast<std::uint8_t>(root);
+            }
+            return table;
+        }()};
+
+        // floor(sqrt(x)) of a fundamental unsigned integer;
+        // narrow values are looked up in a table; for wider values, the root of the upper
+        // half of x's significant digits is used as an over-estimate which is refined
+        // with a single Newton-Raphson iteration and then corrected exactly
+        template<std::unsigned_integral Word>
+        [[nodiscard]] constexpr auto newton_sqrt(Word const& x) -> Word
+        {
+            if constexpr (width<Word> <= 16) {
+                // even shift which leaves seven or eight significant digits in the index
+                auto const num_digits{static_cast<int>(std::bit_width(x))};
+                auto const shift{(num_digits > 8) ? ((num_digits - 7) & ~1) : 0};
+
+                // within one of floor(sqrt(x))
+                auto root{static_cast<Word>(sqrt_table[x >> shift] >> (4 - shift / 2))};
+                if ((root + 1) * (root + 1) <= x) {
+                    ++root;
+                }
+                return root;
+            } else {
+                using half_word = set_width_t<Word, width<Word> / 2>;
+                constexpr auto max_root{static_cast<Word>(~half_word{})};
+
+                auto const num_digits{static_cast<int>(std::bit_width(x))};
+                if (num_digits <= width<half_word>) {
+                    return newton_sqrt(static_cast<half_word>(x));
+                }
+
+                // even shift which leaves between a quarter and a half of the bits of x in upper
+                auto const shift{(num_digits - width<half_word> + 1) & ~1};
+                auto const upper{static_cast<half_word>(x >> shift)};
+
+                // (sqrt(upper) + 1) * 2^(shift/2) >= sqrt(x)
+                auto const estimate{static_cast<Word>(static_cast<Word>(newton_sqrt(upper) + 1U) << (shift / 2))};
+                auto root{static_cast<Word>((estimate + x / estimate) >> 1)};
+
+                // root is no less than floor(sqrt(x)) and rarely exceeds it
+                if (root > max_root) {
+                    root = max_root;
+                }
+                while (static_cast<Word>(root * root) > x) {
+                    --root;
+                }
+                return root;
+            }
+        }
+    }
+
     /// \brief integer overload of cnl::sqrt
     /// \headerfile cnl/cmath.h
     /// \return square root of `x`
-    /// \note This function has O(n) complexity where n is the number of significant digits.
-    /// \note The algorithm is taken from
-    /// [here](https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29).
+    /// \note For fundamental integers, the result is refined from a table-seeded estimate
+    /// using one division for every halving of the width of `x`.
+    /// Otherwise, this function has O(n) complexity where n is the number of significant digits.
     /// \pre `x` must be non-negative
 
     template<integer Integer>
@@ -26,24 +119,13 @@ namespace cnl {
     {
         CNL_ASSERT(x >= Integer{0});
 
-        auto root = +Integer{0};
-        auto bit = Integer{1} << ((digits_v<Integer> - 1) & ~1);
-        auto num = decltype(root + bit){x};
-
-        while (bit > num) {
-            bit >>= 2;
-        }
-
-        while (bit) {
-            if (num >= root + bit) {
-                num -= root + bit;
-                root = (root >> 1) + bit;
-            } else {
-                root >>= 1;
-            }
-            bit >>= 2;
+        if constexpr (std::integral<Integer>) {
+            using result_type = decltype(+x);
+            using unsigned_type = numbers::set_signedness_t<result_type, false>;
+            return static_cast<result_type>(_impl::newton_sqrt(static_cast<unsigned_type>(x)));
+        } else {
+            return _impl::digit_by_digit_sqrt(x);
         }
-        return root;
     }
 }
 
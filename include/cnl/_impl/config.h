@@ -53,6 +53,114 @@
 #define CNL_INT128_ENABLED
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// CNL_HARDWARE_DIVIDE_ENABLED macro definition
+
+#if defined(CNL_HARDWARE_DIVIDE_ENABLED)
+#error CNL_HARDWARE_DIVIDE_ENABLED already defined
+#endif
+
+#if !defined(CNL_USE_HARDWARE_DIVIDE)
+/// \def CNL_USE_HARDWARE_DIVIDE
+/// \brief user flag enables or disables use of the x86-64 128-by-64-bit `div` instruction
+///        in multiword division outside of constant evaluation;
+///        defaults to `1` on supported platforms.
+/// \sa CNL_HARDWARE_DIVIDE_ENABLED
+#if defined(__x86_64__) && (defined(__GNUG__) || defined(__clang__))
+#define CNL_USE_HARDWARE_DIVIDE 1  // NOLINT(cppcoreguidelines-macro-usage)
+#else
+#define CNL_USE_HARDWARE_DIVIDE 0  // NOLINT(cppcoreguidelines-macro-usage)
+#endif
+#endif
+
+#if CNL_USE_HARDWARE_DIVIDE
+/// \def CNL_HARDWARE_DIVIDE_ENABLED
+/// \brief non-zero iff CNL is configured to divide multiword integers using inline assembly
+/// \sa CNL_USE_HARDWARE_DIVIDE
+#define CNL_HARDWARE_DIVIDE_ENABLED
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// CNL_SIMD_PARSE_ENABLED macro definition
+
+#if defined(CNL_SIMD_PARSE_ENABLED)
+#error CNL_SIMD_PARSE_ENABLED already defined
+#endif
+
+#if !defined(CNL_USE_SIMD_PARSE)
+/// \def CNL_USE_SIMD_PARSE
+/// \brief user flag enables or disables use of SSE4.1 instructions
+///        to parse sixteen decimal digits at a time outside of constant evaluation;
+///        defaults to `1` when the target supports SSE4.1.
+/// \sa CNL_SIMD_PARSE_ENABLED
+#if defined(__SSE4_1__)
+#define CNL_USE_SIMD_PARSE 1  // NOLINT(cppcoreguidelines-macro-usage)
+#else
+#define CNL_USE_SIMD_PARSE 0  // NOLINT(cppcoreguidelines-macro-usage)
+#endif
+#endif
+
+#if CNL_USE_SIMD_PARSE
+/// \def CNL_SIMD_PARSE_ENABLED
+/// \brief non-zero iff CNL is configured to parse decimal digits using SSE4.1 instructions
+/// \sa CNL_USE_SIMD_PARSE
+#define CNL_SIMD_PARSE_ENABLED
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// CNL_SIMD_SATURATE_ENABLED macro definition
+
+#if defined(CNL_SIMD_SATURATE_ENABLED)
+#error CNL_SIMD_SATURATE_ENABLED already defined
+#endif
+
+#if !defined(CNL_USE_SIMD_SATURATE)
+/// \def CNL_USE_SIMD_SATURATE
+/// \brief user flag enables or disables use of SSE2, or AVX2, saturating instructions
+///        to add and subtract sequences of 8- and 16-bit saturated integers outside of constant evaluation;
+///        defaults to `1` when the target supports SSE2.
+/// \sa CNL_SIMD_SATURATE_ENABLED
+#if defined(__SSE2__)
+#define CNL_USE_SIMD_SATURATE 1  // NOLINT(cppcoreguidelines-macro-usage)
+#else
+#define CNL_USE_SIMD_SATURATE 0  // NOLINT(cppcoreguidelines-macro-usage)
+#endif
+#endif
+
+#if CNL_USE_SIMD_SATURATE
+/// \def CNL_SIMD_SATURATE_ENABLED
+/// \brief non-zero iff CNL is configured to saturate sequences of integers using vector instructions
+/// \sa CNL_USE_SIMD_SATURATE
+#define CNL_SIMD_SATURATE_ENABLED
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// CNL_BMI2_ENABLED macro definition
+
+#if defined(CNL_BMI2_ENABLED)
+#error CNL_BMI2_ENABLED already defined
+#endif
+
+#if !defined(CNL_USE_BMI2)
+/// \def CNL_USE_BMI2
+/// \brief user flag enables or disables use of the BMI2 `pdep` and `pext` instructions
+///        to pack and unpack bit fields outside of constant evaluation;
+///        defaults to `1` when the target supports BMI2.
+/// \sa CNL_BMI2_ENABLED
+#if defined(__BMI2__)
+#define CNL_USE_BMI2 1  // NOLINT(cppcoreguidelines-macro-usage)
+#else
+#define CNL_USE_BMI2 0  // NOLINT(cppcoreguidelines-macro-usage)
+#endif
+#endif
+
+#if CNL_USE_BMI2
+/// \def CNL_BMI2_ENABLED
+/// \brief non-zero iff CNL is configured to pack bit fields using BMI2 instructions
+/// \sa CNL_USE_BMI2
+#define CNL_BMI2_ENABLED
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // CNL_EXCEPTIONS_ENABLED macro definition
 
@@ -0,0 +1,49 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DIVIDE_BY_CONSTANT_H)
+#define CNL_IMPL_DIVIDE_BY_CONSTANT_H
+
+#include "../constant.h"
+#include "cstdint/types.h"
+
+#include <concepts>
+#include <limits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::divide_by_constant
+
+        // divides by a positive constant, rounding toward zero;
+        // specializations replace division with multiplication and shifting
+        // where the compiler would not do so
+        template<typename Numerator, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        struct divide_by_constant {
+            [[nodiscard]] constexpr auto operator()(Numerator const& numerator) const
+            {
+                return numerator / static_cast<Numerator>(Value);
+            }
+        };
+
+        template<std::integral Numerator, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        struct divide_by_constant<Numerator, Value> {
+            [[nodiscard]] constexpr auto operator()(Numerator const& numerator) const
+            {
+                // avoids a (possibly 128-bit) division in the type of the constant
+                if constexpr (
+                        static_cast<uintmax_t>(Value)
+                        <= static_cast<uintmax_t>(std::numeric_limits<Numerator>::max())) {
+                    return numerator / static_cast<Numerator>(Value);
+                } else {
+                    return static_cast<decltype(numerator / numerator)>(numerator / Value);
+                }
+            }
+        };
+    }
+}
+
+#endif  // CNL_IMPL_DIVIDE_BY_CONSTANT_H
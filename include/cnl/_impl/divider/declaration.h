@@ -0,0 +1,33 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief declaration of `cnl::divider` type
+
+#if !defined(CNL_IMPL_DIVIDER_DECLARATION_H)
+#define CNL_IMPL_DIVIDER_DECLARATION_H
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief divisor which is known only at run-time
+    /// and which is used to divide many numbers
+    /// \headerfile cnl/divider.h
+    ///
+    /// \tparam Divisor type of the divisor
+    ///
+    /// Division by a `divider` is replaced with multiplication and shifting,
+    /// and produces the same result as division by a value of type, `Divisor`.
+    /// Specializations are provided for fundamental integers,
+    /// \ref rounding_integer and \ref scaled_integer.
+    ///
+    /// \sa divide
+    template<typename Divisor>
+    class divider;
+
+    template<typename Divisor>
+    divider(Divisor) -> divider<Divisor>;
+}
+
+#endif  // CNL_IMPL_DIVIDER_DECLARATION_H
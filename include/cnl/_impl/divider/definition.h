@@ -0,0 +1,50 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::divider` type for fundamental integers
+
+#if !defined(CNL_IMPL_DIVIDER_DEFINITION_H)
+#define CNL_IMPL_DIVIDER_DEFINITION_H
+
+#include "declaration.h"
+#include "integer_divider.h"
+
+#include <concepts>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    template<std::integral Divisor>
+    class divider<Divisor> {
+    public:
+        /// type of `numerator / divisor` for any `numerator` of type, `Divisor`
+        using quotient_type = decltype(std::declval<Divisor>() / std::declval<Divisor>());
+
+        explicit constexpr divider(Divisor const& d)
+            : _divisor(d)
+            , _divider(static_cast<quotient_type>(d))
+        {
+        }
+
+        /// returns the value from which this object was constructed
+        [[nodiscard]] constexpr auto divisor() const -> Divisor
+        {
+            return _divisor;
+        }
+
+        /// returns the same value as `numerator / d.divisor()`
+        [[nodiscard]] friend constexpr auto operator/(Divisor const& numerator, divider const& d) -> quotient_type
+        {
+            return d._divider.divide(static_cast<quotient_type>(numerator));
+        }
+
+    private:
+        Divisor _divisor;
+        _impl::integer_divider<quotient_type> _divider;
+    };
+}
+
+#endif  // CNL_IMPL_DIVIDER_DEFINITION_H
@@ -0,0 +1,45 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief division of arrays of numbers by a `cnl::divider`
+
+#if !defined(CNL_IMPL_DIVIDER_DIVIDE_H)
+#define CNL_IMPL_DIVIDER_DIVIDE_H
+
+#include "../cnl_assert.h"
+#include "declaration.h"
+
+#include <cstddef>
+#include <span>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief divides each of a sequence of numerators by the same divisor
+    /// \headerfile cnl/divider.h
+    ///
+    /// \param numerators sequence of values to divide by `d`
+    /// \param d divisor of each numerator
+    /// \param quotients sequence of results with the same size as `numerators`
+    ///
+    /// \note For suitable types, the loop is eligible for auto-vectorization.
+    /// \sa divider
+    template<typename Numerator, std::size_t NumeratorExtent, typename Divisor, typename Quotient, std::size_t QuotientExtent>
+    constexpr void divide(
+            std::span<Numerator, NumeratorExtent> numerators,
+            divider<Divisor> const& d,
+            std::span<Quotient, QuotientExtent> quotients)
+    {
+        CNL_ASSERT(numerators.size() == quotients.size());
+
+        // local copy cannot alias the output
+        auto const local_divider{d};
+        for (auto index = std::size_t{0}; index != numerators.size(); ++index) {
+            quotients[index] = static_cast<Quotient>(numerators[index] / local_divider);
+        }
+    }
+}
+
+#endif  // CNL_IMPL_DIVIDER_DIVIDE_H
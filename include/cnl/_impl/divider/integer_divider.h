@@ -0,0 +1,145 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief truncating division of fundamental integers by an invariant divisor
+
+#if !defined(CNL_IMPL_DIVIDER_INTEGER_DIVIDER_H)
+#define CNL_IMPL_DIVIDER_INTEGER_DIVIDER_H
+
+#include "../cnl_assert.h"
+#include "../duplex_integer.h"
+#include "../duplex_integer/long_divide.h"
+#include "../num_traits/width.h"
+#include "../numbers/set_signedness.h"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // upper half of the double-width product of two unsigned words
+        template<std::unsigned_integral Word>
+        [[nodiscard]] constexpr auto multiply_high(Word const& lhs, Word const& rhs) -> Word
+        {
+            return long_product_upper<Word>(long_multiply<Word>{}(lhs, rhs));
+        }
+
+        // upper half of the double-width product of two signed words
+        template<std::signed_integral Word>
+        [[nodiscard]] constexpr auto multiply_high(Word const& lhs, Word const& rhs) -> Word
+        {
+            using unsigned_word = numbers::set_signedness_t<Word, false>;
+            constexpr auto sign_shift{width<Word> - 1};
+            auto const unsigned_lhs{static_cast<unsigned_word>(lhs)};
+            auto const unsigned_rhs{static_cast<unsigned_word>(rhs)};
+            auto const lhs_sign{static_cast<unsigned_word>(lhs >> sign_shift)};
+            auto const rhs_sign{static_cast<unsigned_word>(rhs >> sign_shift)};
+            return static_cast<Word>(
+                    multiply_high(unsigned_lhs, unsigned_rhs)
+                    - (lhs_sign & unsigned_rhs)
+                    - (rhs_sign & unsigned_lhs));
+        }
+
+        // cnl::_impl::integer_divider - replaces division by an invariant divisor
+        // with multiplication and shifting; in each case, the algorithm is branch-free
+        // so that it can be applied to arrays of numerators using SIMD instructions;
+        // see "Division by Invariant Integers using Multiplication", Granlund & Montgomery, 1994
+        template<std::integral Word>
+        class integer_divider;
+
+        // Figure 4.1
+        template<std::unsigned_integral Word>
+        class integer_divider<Word> {
+        public:
+            explicit constexpr integer_divider(Word const& divisor)
+            {
+                CNL_ASSERT(divisor != Word{});
+
+                // ceil(log2(divisor))
+                auto const log2_divisor{static_cast<int>(std::bit_width(static_cast<Word>(divisor - Word{1})))};
+
+                // 2^log2_divisor - divisor, which is less than divisor
+                auto const half_power{log2_divisor ? static_cast<Word>(Word{1} << (log2_divisor - 1)) : Word{}};
+                auto const excess{static_cast<Word>(
+                        log2_divisor ? static_cast<Word>(half_power - divisor) + half_power : Word{})};
+
+                _multiplier = static_cast<Word>(long_divide(excess, Word{}, divisor).quotient + Word{1});
+                _pre_shift = std::min(log2_divisor, 1);
+                _post_shift = std::max(log2_divisor - 1, 0);
+            }
+
+            [[nodiscard]] constexpr auto divide(Word const& numerator) const -> Word
+            {
+                auto const product{multiply_high(_multiplier, numerator)};
+                return static_cast<Word>(
+                        static_cast<Word>(static_cast<Word>(static_cast<Word>(numerator - product) >> _pre_shift) + product)
+                        >> _post_shift);
+            }
+
+        private:
+            Word _multiplier{};
+            int _pre_shift{};
+            int _post_shift{};
+        };
+
+        // Figure 5.2
+        template<std::signed_integral Word>
+        class integer_divider<Word> {
+            using unsigned_word = numbers::set_signedness_t<Word, false>;
+            static constexpr auto sign_shift{width<Word> - 1};
+
+        public:
+            explicit constexpr integer_divider(Word const& divisor)
+                : _sign(static_cast<Word>(divisor >> sign_shift))
+            {
+                CNL_ASSERT(divisor != Word{});
+
+                auto const magnitude{static_cast<unsigned_word>(
+                        (static_cast<unsigned_word>(divisor) ^ static_cast<unsigned_word>(_sign))
+                        - static_cast<unsigned_word>(_sign))};
+
+                // max(ceil(log2(magnitude)), 1)
+                auto const log2_magnitude{std::max(
+                        static_cast<int>(std::bit_width(static_cast<unsigned_word>(magnitude - unsigned_word{1}))),
+                        1)};
+
+                // 2^(width+log2_magnitude-1)/magnitude - 2^width + 1, modulo 2^width
+                auto const quotient{
+                        (magnitude == unsigned_word{1})
+                                ? unsigned_word{}
+                                : long_divide(
+                                          static_cast<unsigned_word>(unsigned_word{1} << (log2_magnitude - 1)),
+                                          unsigned_word{}, magnitude)
+                                          .quotient};
+                _multiplier = static_cast<Word>(static_cast<unsigned_word>(quotient + unsigned_word{1}));
+                _shift = log2_magnitude - 1;
+            }
+
+            [[nodiscard]] constexpr auto divide(Word const& numerator) const -> Word
+            {
+                // unsigned arithmetic avoids overflow where the divisor is ±1
+                auto const product{multiply_high(_multiplier, numerator)};
+                auto const sum{static_cast<Word>(
+                        static_cast<unsigned_word>(numerator) + static_cast<unsigned_word>(product))};
+                auto const magnitude{static_cast<unsigned_word>(
+                        static_cast<unsigned_word>(sum >> _shift)
+                        - static_cast<unsigned_word>(numerator >> sign_shift))};
+                return static_cast<Word>(
+                        static_cast<unsigned_word>(magnitude ^ static_cast<unsigned_word>(_sign))
+                        - static_cast<unsigned_word>(_sign));
+            }
+
+        private:
+            Word _multiplier{};
+            int _shift{};
+            Word _sign;
+        };
+    }
+}
+
+#endif  // CNL_IMPL_DIVIDER_INTEGER_DIVIDER_H
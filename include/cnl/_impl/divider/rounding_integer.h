@@ -0,0 +1,85 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::divider` type for `cnl::rounding_integer`
+
+#if !defined(CNL_IMPL_DIVIDER_ROUNDING_INTEGER_H)
+#define CNL_IMPL_DIVIDER_ROUNDING_INTEGER_H
+
+#include "../../rounding_integer.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../rounding/native_rounding_tag.h"
+#include "../rounding/nearest_rounding_tag.h"
+#include "../rounding/neg_inf_rounding_tag.h"
+#include "definition.h"
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<typename Tag>
+        inline constexpr auto is_divider_rounding_tag_v =
+                std::is_same_v<Tag, native_rounding_tag>
+                || std::is_same_v<Tag, nearest_rounding_tag>
+                || std::is_same_v<Tag, neg_inf_rounding_tag>;
+    }
+
+    template<std::integral Rep, rounding_tag Tag>
+    requires(_impl::is_divider_rounding_tag_v<Tag>) class divider<_impl::wrapper<Rep, Tag>> {
+        using divisor_type = _impl::wrapper<Rep, Tag>;
+        using rep_quotient_type = typename divider<Rep>::quotient_type;
+
+    public:
+        /// type of `numerator / divisor` for any `numerator` of type, `rounding_integer<Rep, Tag>`
+        using quotient_type = decltype(std::declval<divisor_type>() / std::declval<divisor_type>());
+
+        explicit constexpr divider(divisor_type const& d)
+            : _divisor(d)
+            , _rep_divider(static_cast<rep_quotient_type>(_impl::to_rep(d)))
+        {
+        }
+
+        /// returns the value from which this object was constructed
+        [[nodiscard]] constexpr auto divisor() const -> divisor_type
+        {
+            return _divisor;
+        }
+
+        /// returns the same value as `numerator / d.divisor()`
+        [[nodiscard]] friend constexpr auto operator/(divisor_type const& numerator, divider const& d)
+                -> quotient_type
+        {
+            return _impl::from_rep<quotient_type>(d.divide(_impl::to_rep(numerator)));
+        }
+
+    private:
+        // applies the rounding of custom_operator<divide_op, op_value<Rep, Tag>, op_value<Rep, Tag>>
+        [[nodiscard]] constexpr auto divide(Rep const& lhs) const -> rep_quotient_type
+        {
+            auto const rhs{_impl::to_rep(_divisor)};
+            if constexpr (std::is_same_v<Tag, nearest_rounding_tag>) {
+                auto const half{rhs / 2};
+                return (((lhs < 0) ^ (rhs < 0)) ? lhs - half : lhs + half) / _rep_divider;
+            } else if constexpr (std::is_same_v<Tag, neg_inf_rounding_tag>) {
+                auto const quotient{lhs / _rep_divider};
+                auto const remainder{static_cast<rep_quotient_type>(lhs - quotient * rhs)};
+                return static_cast<rep_quotient_type>(
+                        quotient - rep_quotient_type{(remainder != 0) && ((remainder < 0) != (rhs < 0))});
+            } else {
+                return lhs / _rep_divider;
+            }
+        }
+
+        divisor_type _divisor;
+        divider<rep_quotient_type> _rep_divider;
+    };
+}
+
+#endif  // CNL_IMPL_DIVIDER_ROUNDING_INTEGER_H
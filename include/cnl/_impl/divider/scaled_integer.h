@@ -0,0 +1,59 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::divider` type for `cnl::scaled_integer`
+
+#if !defined(CNL_IMPL_DIVIDER_SCALED_INTEGER_H)
+#define CNL_IMPL_DIVIDER_SCALED_INTEGER_H
+
+#include "../../scaled_integer.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "definition.h"
+
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    template<typename Rep, int Exponent, int Radix>
+    class divider<scaled_integer<Rep, power<Exponent, Radix>>> {
+        using divisor_type = scaled_integer<Rep, power<Exponent, Radix>>;
+
+    public:
+        /// type of `numerator / divisor` for any `numerator` of type, `scaled_integer<Rep, power<NumeratorExponent, Radix>>`
+        template<int NumeratorExponent>
+        using quotient_type = decltype(
+                std::declval<scaled_integer<Rep, power<NumeratorExponent, Radix>>>()
+                / std::declval<divisor_type>());
+
+        explicit constexpr divider(divisor_type const& d)
+            : _divisor(d)
+            , _rep_divider(_impl::to_rep(d))
+        {
+        }
+
+        /// returns the value from which this object was constructed
+        [[nodiscard]] constexpr auto divisor() const -> divisor_type
+        {
+            return _divisor;
+        }
+
+        /// returns the same value as `numerator / d.divisor()`
+        template<int NumeratorExponent>
+        [[nodiscard]] friend constexpr auto operator/(
+                scaled_integer<Rep, power<NumeratorExponent, Radix>> const& numerator, divider const& d)
+                -> quotient_type<NumeratorExponent>
+        {
+            return _impl::from_rep<quotient_type<NumeratorExponent>>(_impl::to_rep(numerator) / d._rep_divider);
+        }
+
+    private:
+        divisor_type _divisor;
+        divider<Rep> _rep_divider;
+    };
+}
+
+#endif  // CNL_IMPL_DIVIDER_SCALED_INTEGER_H
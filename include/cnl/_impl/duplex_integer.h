@@ -0,0 +1,28 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_H)
+#define CNL_IMPL_DUPLEX_INTEGER_H
+
+#include "duplex_integer/common_type.h"
+#include "duplex_integer/comparison.h"
+#include "duplex_integer/ctors.h"
+#include "duplex_integer/declaration.h"
+#include "duplex_integer/definition.h"
+#include "duplex_integer/digits.h"
+#include "duplex_integer/divide.h"
+#include "duplex_integer/from_value.h"
+#include "duplex_integer/integer.h"
+#include "duplex_integer/modulo.h"
+#include "duplex_integer/multiply.h"
+#include "duplex_integer/narrowest_integer.h"
+#include "duplex_integer/numbers.h"
+#include "duplex_integer/numeric_limits.h"
+#include "duplex_integer/operators.h"
+#include "duplex_integer/set_digits.h"
+#include "duplex_integer/shift.h"
+#include "duplex_integer/to_rep.h"
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_H
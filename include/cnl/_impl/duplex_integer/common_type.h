@@ -0,0 +1,56 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_COMMON_TYPE_H)
+#define CNL_IMPL_DUPLEX_INTEGER_COMMON_TYPE_H
+
+#include "../num_traits/digits.h"
+#include "../num_traits/width.h"
+#include "declaration.h"
+#include "digits.h"
+#include "narrowest_integer.h"
+
+#include <algorithm>
+#include <concepts>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // types which can be combined with a duplex_integer in a binary operation
+        template<typename T>
+        concept duplex_integer_operand = any_duplex_integer<T> || std::integral<T>;
+
+        // cnl::_impl::duplex_integer_common_type - type to which both operands
+        // of a heterogeneous binary operation involving a duplex_integer are converted
+        template<duplex_integer_operand Lhs, duplex_integer_operand Rhs>
+        struct duplex_integer_common_type;
+
+        // the wider of the two operands, favoring the duplex_integer
+        template<any_duplex_integer Lhs, std::integral Rhs>
+        struct duplex_integer_common_type<Lhs, Rhs>
+            : std::conditional<(width<Lhs> < width<Rhs>), Rhs, Lhs> {
+        };
+
+        template<std::integral Lhs, any_duplex_integer Rhs>
+        struct duplex_integer_common_type<Lhs, Rhs>
+            : std::conditional<(width<Rhs> < width<Lhs>), Lhs, Rhs> {
+        };
+
+        // duplex_integer with enough digits for either operand, composed of the common word type
+        template<any_duplex_integer Lhs, any_duplex_integer Rhs>
+        struct duplex_integer_common_type<Lhs, Rhs>
+            : narrowest_integer<
+                      std::max(digits_v<Lhs>, digits_v<Rhs>),
+                      decltype(std::declval<duplex_integer_upper_t<Lhs>>()
+                               + std::declval<duplex_integer_upper_t<Rhs>>())> {
+        };
+
+        template<duplex_integer_operand Lhs, duplex_integer_operand Rhs>
+        using duplex_integer_common_type_t = typename duplex_integer_common_type<Lhs, Rhs>::type;
+    }
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_COMMON_TYPE_H
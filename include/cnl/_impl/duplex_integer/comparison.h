@@ -0,0 +1,90 @@
+//          Copyright John McFarlane 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_COMPARISON_H)
+#define CNL_IMPL_DUPLEX_INTEGER_COMPARISON_H
+
+#include "../custom_operator/definition.h"
+#include "../custom_operator/op.h"
+#include "definition.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // compares the (upper, lower) pairs lexicographically
+        template<comparison_op Operator>
+        struct duplex_integer_comparison;
+
+        template<>
+        struct duplex_integer_comparison<equal_op> {
+            template<typename Upper, typename Lower>
+            [[nodiscard]] constexpr auto operator()(
+                    duplex_integer<Upper, Lower> const& lhs, duplex_integer<Upper, Lower> const& rhs) const
+            {
+                return lhs.upper() == rhs.upper() && lhs.lower() == rhs.lower();
+            }
+        };
+
+        template<>
+        struct duplex_integer_comparison<not_equal_op> {
+            template<typename Upper, typename Lower>
+            [[nodiscard]] constexpr auto operator()(
+                    duplex_integer<Upper, Lower> const& lhs, duplex_integer<Upper, Lower> const& rhs) const
+            {
+                return lhs.upper() != rhs.upper() || lhs.lower() != rhs.lower();
+            }
+        };
+
+        template<>
+        struct duplex_integer_comparison<less_than_op> {
+            template<typename Upper, typename Lower>
+            [[nodiscard]] constexpr auto operator()(
+                    duplex_integer<Upper, Lower> const& lhs, duplex_integer<Upper, Lower> const& rhs) const
+            {
+                return lhs.upper() < rhs.upper() || (lhs.upper() == rhs.upper() && lhs.lower() < rhs.lower());
+            }
+        };
+
+        template<>
+        struct duplex_integer_comparison<greater_than_op> {
+            template<typename Upper, typename Lower>
+            [[nodiscard]] constexpr auto operator()(
+                    duplex_integer<Upper, Lower> const& lhs, duplex_integer<Upper, Lower> const& rhs) const
+            {
+                return duplex_integer_comparison<less_than_op>{}(rhs, lhs);
+            }
+        };
+
+        template<>
+        struct duplex_integer_comparison<less_than_or_equal_op> {
+            template<typename Upper, typename Lower>
+            [[nodiscard]] constexpr auto operator()(
+                    duplex_integer<Upper, Lower> const& lhs, duplex_integer<Upper, Lower> const& rhs) const
+            {
+                return !duplex_integer_comparison<less_than_op>{}(rhs, lhs);
+            }
+        };
+
+        template<>
+        struct duplex_integer_comparison<greater_than_or_equal_op> {
+            template<typename Upper, typename Lower>
+            [[nodiscard]] constexpr auto operator()(
+                    duplex_integer<Upper, Lower> const& lhs, duplex_integer<Upper, Lower> const& rhs) const
+            {
+                return !duplex_integer_comparison<less_than_op>{}(lhs, rhs);
+            }
+        };
+    }
+
+    template<_impl::comparison_op Operator, typename Upper, typename Lower>
+    struct custom_operator<
+            Operator,
+            op_value<_impl::duplex_integer<Upper, Lower>>,
+            op_value<_impl::duplex_integer<Upper, Lower>>>
+        : _impl::duplex_integer_comparison<Operator> {
+    };
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_COMPARISON_H
@@ -11,25 +11,17 @@
 #include "definition.h"
 #include "operators.h"
 
+#include <cmath>
 #include <concepts>
-#include <limits>
 
 /// compositional numeric library
 namespace cnl {
     namespace _impl {
         // cnl::_impl::calculate_lower
         template<typename Lower, typename Integer>
-        requires(digits_v<Lower> >= digits_v<Integer>)
-                [[nodiscard]] constexpr auto calculate_lower(Integer const& input) -> Lower
-        {
-            return static_cast<Lower>(input) & std::numeric_limits<Lower>::max();
-        }
-
-        template<typename Lower, typename Integer>
-        requires(digits_v<Lower> < digits_v<Integer>)
-                [[nodiscard]] constexpr auto calculate_lower(Integer const& input) -> Lower
+        [[nodiscard]] constexpr auto calculate_lower(Integer const& input) -> Lower
         {
-            return static_cast<Lower>(input & static_cast<Integer>(std::numeric_limits<Lower>::max()));
+            return static_cast<Lower>(input);
         }
 
         // cnl::_impl::calculate upper
@@ -0,0 +1,48 @@
+//          Copyright John McFarlane 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_DECLARATION_H)
+#define CNL_IMPL_DUPLEX_INTEGER_DECLARATION_H
+
+#include "../custom_operator/definition.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // integer with twice the range of its components
+        template<typename Upper, typename Lower>
+        class duplex_integer;
+
+        // cnl::_impl::is_duplex_integer_v
+        template<typename T>
+        inline constexpr auto is_duplex_integer_v = false;
+
+        template<typename Upper, typename Lower>
+        inline constexpr auto is_duplex_integer_v<duplex_integer<Upper, Lower>> = true;
+
+        template<typename T>
+        concept any_duplex_integer = is_duplex_integer_v<T>;
+
+        // cnl::_impl::wants_generic_ops<any_duplex_integer>
+        template<any_duplex_integer T>
+        inline constexpr auto wants_generic_ops<T> = true;
+
+        // cnl::_impl::duplex_integer_upper_t - the most significant word of a duplex_integer
+        template<typename T>
+        struct duplex_integer_upper : std::type_identity<T> {
+        };
+
+        template<typename Upper, typename Lower>
+        struct duplex_integer_upper<duplex_integer<Upper, Lower>> : duplex_integer_upper<Upper> {
+        };
+
+        template<typename T>
+        using duplex_integer_upper_t = typename duplex_integer_upper<T>::type;
+    }
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_DECLARATION_H
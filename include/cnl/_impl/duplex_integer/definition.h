@@ -7,35 +7,102 @@
 #if !defined(CNL_IMPL_DUPLEX_INTEGER_DEFINITION_H)
 #define CNL_IMPL_DUPLEX_INTEGER_DEFINITION_H
 
+#include "../cnl_assert.h"
 #include "../num_traits/width.h"
 #include "../numbers/set_signedness.h"
 #include "../power_value.h"
-#include "../unreachable.h"
 #include "declaration.h"
 #include "digits.h"
+#include "integer.h"
 #include "numbers.h"
 
 #include <cmath>
 #include <concepts>
-#include <iterator>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
     namespace _impl {
+        // cnl::_impl::sensible_right_shift - right shift which is defined for any non-negative shift
+        template<typename Result, typename Value>
+        [[nodiscard]] constexpr auto sensible_right_shift(Value const& value, int shift) -> Result
+        {
+            CNL_ASSERT(shift >= 0);
+            using promoted_type = decltype(value >> shift);
+            if (shift < digits_v<promoted_type>) {
+                return static_cast<Result>(value >> shift);
+            }
+            if constexpr (numbers::signedness_v<Value>) {
+                if (value < Value{}) {
+                    return static_cast<Result>(~Result{});
+                }
+            }
+            return Result{};
+        }
+
+        // cnl::_impl::sensible_left_shift - left shift which is defined for any non-negative shift
+        // and which drops the bits of value which do not fit in Result
+        template<typename Result, typename Value>
+        [[nodiscard]] constexpr auto sensible_left_shift(Value const& value, int shift) -> Result
+        {
+            CNL_ASSERT(shift >= 0);
+            if (shift >= width<Result>) {
+                return Result{};
+            }
+            if constexpr (std::is_integral_v<Result>) {
+                using unsigned_type = decltype(numbers::set_signedness_t<Result, false>{} | 0U);
+                return static_cast<Result>(static_cast<unsigned_type>(static_cast<unsigned_type>(value) << shift));
+            } else {
+                return static_cast<Result>(static_cast<Result>(value) << shift);
+            }
+        }
+
+        // cnl::_impl::wrapping_add - modulo addition, i.e. without undefined behavior on overflow
+        template<typename Integer>
+        [[nodiscard]] constexpr auto wrapping_add(Integer const& lhs, Integer const& rhs) -> Integer
+        {
+            if constexpr (std::is_integral_v<Integer>) {
+                using unsigned_type = decltype(numbers::set_signedness_t<Integer, false>{} | 0U);
+                return static_cast<Integer>(static_cast<unsigned_type>(lhs) + static_cast<unsigned_type>(rhs));
+            } else {
+                return lhs + rhs;
+            }
+        }
+
+        // cnl::_impl::wrapping_subtract - modulo subtraction
         template<typename Integer>
-        [[nodiscard]] constexpr auto is_flushed(Integer const& value)
+        [[nodiscard]] constexpr auto wrapping_subtract(Integer const& lhs, Integer const& rhs) -> Integer
         {
-            return value == 0 || value == static_cast<Integer>(~Integer{});
+            if constexpr (std::is_integral_v<Integer>) {
+                using unsigned_type = decltype(numbers::set_signedness_t<Integer, false>{} | 0U);
+                return static_cast<Integer>(static_cast<unsigned_type>(lhs) - static_cast<unsigned_type>(rhs));
+            } else {
+                return lhs - rhs;
+            }
         }
 
+        // cnl::_impl::wrapping_multiply - modulo multiplication
+        template<typename Integer>
+        [[nodiscard]] constexpr auto wrapping_multiply(Integer const& lhs, Integer const& rhs) -> Integer
+        {
+            if constexpr (std::is_integral_v<Integer>) {
+                using unsigned_type = decltype(numbers::set_signedness_t<Integer, false>{} | 0U);
+                return static_cast<Integer>(static_cast<unsigned_type>(lhs) * static_cast<unsigned_type>(rhs));
+            } else {
+                return lhs * rhs;
+            }
+        }
+
+        // contribution of the upper component of a duplex_integer to its value when converted to Result;
+        // like conversion between fundamental integers, the value is truncated modulo 2^width<Result>
         template<typename Result, typename Upper, typename Lower>
         [[nodiscard]] constexpr auto upper_value(Upper const& upper) -> Result
         {
-            return (digits_v<Result> <= digits_v<Lower>)
-                         ? !is_flushed(upper)
-                                 ? unreachable<Result>("overflow in narrowing conversion")
-                                 : Result{}
-                         : Result{sensible_left_shift<Result>(upper, digits_v<Lower>)};
+            if constexpr (width<Result> <= width<Lower>) {
+                return Result{};
+            } else {
+                return sensible_left_shift<Result>(upper, width<Lower>);
+            }
         }
 
         // Class duplex_integer is bigendian because this is consistent with std::pair.
@@ -89,7 +156,7 @@ namespace cnl {
             template<integer Integer>
             [[nodiscard]] explicit constexpr operator Integer() const
             {
-                return upper_value<Integer, Upper, Lower>(_upper) | static_cast<Integer>(_lower);
+                return static_cast<Integer>(upper_value<Integer, Upper, Lower>(_upper) | static_cast<Integer>(_lower));
             }
 
             template<std::floating_point Number>
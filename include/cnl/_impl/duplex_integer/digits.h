@@ -0,0 +1,18 @@
+//          Copyright John McFarlane 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_DIGITS_H)
+#define CNL_IMPL_DUPLEX_INTEGER_DIGITS_H
+
+#include "../num_traits/digits.h"
+#include "declaration.h"
+
+/// compositional numeric library
+namespace cnl {
+    template<typename Upper, typename Lower>
+    inline constexpr int digits_v<_impl::duplex_integer<Upper, Lower>> = digits_v<Upper> + digits_v<Lower>;
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_DIGITS_H
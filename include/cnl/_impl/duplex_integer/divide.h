@@ -1,4 +1,3 @@
-
 //          Copyright John McFarlane 2018.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file ../LICENSE_1_0.txt or copy at
@@ -8,34 +7,47 @@
 #define CNL_IMPL_DUPLEX_INTEGER_DIVIDE_H
 
 #include "../custom_operator/definition.h"
-#include "../custom_operator/native_tag.h"
 #include "../custom_operator/op.h"
+#include "../num_traits/width.h"
 #include "../numbers/set_signedness.h"
-#include "../wide_integer/definition.h"
 #include "ctors.h"
 #include "definition.h"
+#include "long_divide.h"
 #include "numbers.h"
 #include "numeric_limits.h"
 
-#include <algorithm>
-#include <limits>
+#include <concepts>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
     namespace _impl {
-        // cnl::_impl::heterogeneous_duplex_divide_operator
-        template<typename Lhs, typename Rhs>
-        struct heterogeneous_duplex_divide_operator {
-            using common_type = rep_of_t<wide_integer<
-                    std::max(digits_v<Lhs>, digits_v<Rhs>),
-                    numbers::set_signedness_t<int, numbers::signedness_v<Lhs> | numbers::signedness_v<Rhs>>>>;
-
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> Lhs
-            {
-                return static_cast<Lhs>(
-                        static_cast<common_type>(lhs) / static_cast<common_type>(rhs));
-            }
-        };
+        // true iff T is Word or a tree of duplex_integer with leaves of type, Word
+        template<typename T, typename Word>
+        inline constexpr auto is_made_of_words = std::is_same_v<T, Word>;
+
+        template<typename Upper, typename Lower, typename Word>
+        inline constexpr auto is_made_of_words<duplex_integer<Upper, Lower>, Word> =
+                is_made_of_words<Upper, Word> && is_made_of_words<Lower, Word>;
+
+        // divides each word of value, most significant first, carrying the remainder to the next word
+        template<std::unsigned_integral Word>
+        [[nodiscard]] constexpr auto divide_words(
+                Word const& value, word_reciprocal<Word> const& divisor, Word& remainder) -> Word
+        {
+            auto const result{divisor.divide(remainder, value)};
+            remainder = result.remainder;
+            return result.quotient;
+        }
+
+        template<typename Upper, typename Lower, std::unsigned_integral Word>
+        [[nodiscard]] constexpr auto divide_words(
+                duplex_integer<Upper, Lower> const& value, word_reciprocal<Word> const& divisor, Word& remainder)
+                -> duplex_integer<Upper, Lower>
+        {
+            auto const upper{divide_words(value.upper(), divisor, remainder)};
+            return duplex_integer<Upper, Lower>{upper, divide_words(value.lower(), divisor, remainder)};
+        }
     }
 
     // duplex_integer<> / duplex_integer<>
@@ -47,31 +59,50 @@ namespace cnl {
     private:
         using duplex_integer = _impl::duplex_integer<Upper, Lower>;
         using unsigned_duplex_integer = numbers::set_signedness_t<duplex_integer, false>;
+        using unsigned_upper = numbers::set_signedness_t<Upper, false>;
 
     public:
         [[nodiscard]] constexpr auto operator()(
                 duplex_integer const& lhs, duplex_integer const& rhs) const -> duplex_integer
         {
-            return (lhs < duplex_integer{0}) ? (rhs < duplex_integer{0})
-                                                     ? non_negative_division(-lhs, -rhs)
-                                                     : -non_negative_division(-lhs, rhs)
-                 : (rhs < duplex_integer{0}) ? -non_negative_division(lhs, -rhs)
-                                             : non_negative_division(lhs, rhs);
+            if constexpr (numbers::signedness_v<duplex_integer>) {
+                auto const lhs_is_negative{lhs < duplex_integer{0}};
+                auto const rhs_is_negative{rhs < duplex_integer{0}};
+                auto const quotient{from_unsigned(non_negative_division(
+                        to_unsigned(lhs_is_negative ? -lhs : lhs),
+                        to_unsigned(rhs_is_negative ? -rhs : rhs)))};
+                return (lhs_is_negative != rhs_is_negative) ? -quotient : quotient;
+            } else {
+                return non_negative_division(lhs, rhs);
+            }
+        }
+
+    private:
+        [[nodiscard]] static constexpr auto to_unsigned(duplex_integer const& value)
+                -> unsigned_duplex_integer
+        {
+            return unsigned_duplex_integer(static_cast<unsigned_upper>(value.upper()), value.lower());
+        }
+
+        [[nodiscard]] static constexpr auto from_unsigned(unsigned_duplex_integer const& value)
+                -> duplex_integer
+        {
+            return duplex_integer(static_cast<Upper>(value.upper()), value.lower());
         }
 
         // lifted from:
         // https://github.com/torvalds/linux/blob/5ac94332248ee017964ba368cdda4ce647e3aba7/lib/math/div64.c#L142
-        static constexpr auto non_negative_division(
+        [[nodiscard]] static constexpr auto non_negative_division(
                 unsigned_duplex_integer const& dividend, unsigned_duplex_integer const& divisor)
                 -> unsigned_duplex_integer
         {
-            auto const high = divisor.upper();
+            auto const high{divisor.upper()};
             if (!high) {
                 return div_by_lower(dividend, divisor.lower());
             }
 
-            int n = fls(high);
-            auto quot = div_by_lower(dividend >> n, (divisor >> n).lower());
+            auto const n{_impl::duplex_integer_bit_width(high)};
+            auto quot{div_by_lower(dividend >> n, (divisor >> n).lower())};
 
             if (quot) {
                 --quot;
@@ -83,84 +114,24 @@ namespace cnl {
             return quot;
         }
 
-        static constexpr auto fls(Upper n) -> int
-        {
-            auto half_digits = std::numeric_limits<duplex_integer>::digits / 2;
-
-            if (!n) {
-                return 0;
-            }
-            auto const msd = Upper{1} << (half_digits - 1);
-            for (int r = half_digits;; n <<= 1, r--) {
-                if (n & msd) {
-                    return r;
-                }
-            }
-        };
-
-        // from Linux div64_32
-        static constexpr auto div_by_lower(
+        [[nodiscard]] static constexpr auto div_by_lower(
                 unsigned_duplex_integer const& dividend, Lower const& divisor)
                 -> unsigned_duplex_integer
         {
-            unsigned_duplex_integer rem = dividend;
-            unsigned_duplex_integer b = divisor;
-            unsigned_duplex_integer d = 1;
-
-            using unsigned_upper = numbers::set_signedness_t<Upper, false>;
-            auto high = rem.upper();
-
-            unsigned_duplex_integer quot = 0;
-            if (static_cast<unsigned_upper>(high) >= divisor) {
-                high /= divisor;  // NOLINT(clang-analyzer-core.DivideZero)
-                quot = unsigned_duplex_integer{high, 0};
-                rem -= unsigned_duplex_integer(high * divisor, 0);
-            }
-
-            while (b < rem) {
-                b <<= 1;
-                d <<= 1;
+            if constexpr (
+                    std::unsigned_integral<Lower> && _impl::any_duplex_integer<unsigned_upper>
+                    && _impl::is_made_of_words<unsigned_upper, Lower>) {
+                // three or more words are divided by the same divisor
+                auto remainder{Lower{}};
+                return _impl::divide_words(dividend, _impl::word_reciprocal<Lower>{divisor}, remainder);
+            } else {
+                auto const upper_quotient{static_cast<unsigned_upper>(dividend.upper() / divisor)};
+                auto const upper_remainder{static_cast<Lower>(dividend.upper() % divisor)};
+                return unsigned_duplex_integer{
+                        upper_quotient,
+                        _impl::long_divide(upper_remainder, dividend.lower(), divisor).quotient};
             }
-
-            do {
-                if (rem >= b) {
-                    rem -= b;
-                    quot += d;
-                }
-                b >>= 1;
-                d >>= 1;
-            } while (d);
-
-            return quot;
-        };
-    };
-
-    template<typename LhsUpper, typename LhsLower, typename RhsUpper, typename RhsLower>
-    struct custom_operator<
-            _impl::divide_op,
-            op_value<_impl::duplex_integer<LhsUpper, LhsLower>>,
-            op_value<_impl::duplex_integer<RhsUpper, RhsLower>>>
-        : _impl::heterogeneous_duplex_divide_operator<
-                  _impl::duplex_integer<LhsUpper, LhsLower>,
-                  _impl::duplex_integer<RhsUpper, RhsLower>> {
-    };
-
-    template<typename Lhs, typename RhsUpper, typename RhsLower>
-    struct custom_operator<
-            _impl::divide_op,
-            op_value<Lhs>,
-            op_value<_impl::duplex_integer<RhsUpper, RhsLower>>>
-        : _impl::heterogeneous_duplex_divide_operator<
-                  Lhs, _impl::duplex_integer<RhsUpper, RhsLower>> {
-    };
-
-    template<typename LhsUpper, typename LhsLower, typename Rhs>
-    struct custom_operator<
-            _impl::divide_op,
-            op_value<_impl::duplex_integer<LhsUpper, LhsLower>>,
-            op_value<Rhs>>
-        : _impl::heterogeneous_duplex_divide_operator<
-                  _impl::duplex_integer<LhsUpper, LhsLower>, Rhs> {
+        }
     };
 }
 
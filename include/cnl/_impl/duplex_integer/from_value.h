@@ -0,0 +1,38 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_FROM_VALUE_H)
+#define CNL_IMPL_DUPLEX_INTEGER_FROM_VALUE_H
+
+#include "../num_traits/digits.h"
+#include "../num_traits/from_value.h"
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
+#include "declaration.h"
+#include "narrowest_integer.h"
+
+#include <concepts>
+
+/// compositional numeric library
+namespace cnl {
+    template<typename Upper, typename Lower, std::integral Value>
+    struct from_value<_impl::duplex_integer<Upper, Lower>, Value>
+        : _impl::from_value_simple<
+                  _impl::narrowest_integer_t<
+                          digits_v<Value>,
+                          numbers::set_signedness_t<
+                                  _impl::duplex_integer_upper_t<Upper>, numbers::signedness_v<Value>>>,
+                  Value> {
+    };
+
+    template<typename Upper, typename Lower, typename ValueUpper, typename ValueLower>
+    struct from_value<_impl::duplex_integer<Upper, Lower>, _impl::duplex_integer<ValueUpper, ValueLower>>
+        : _impl::from_value_simple<
+                  _impl::duplex_integer<ValueUpper, ValueLower>,
+                  _impl::duplex_integer<ValueUpper, ValueLower>> {
+    };
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_FROM_VALUE_H
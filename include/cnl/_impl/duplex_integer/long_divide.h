@@ -0,0 +1,190 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief division of a double-word integer by a single word
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_LONG_DIVIDE_H)
+#define CNL_IMPL_DUPLEX_INTEGER_LONG_DIVIDE_H
+
+#include "../cnl_assert.h"
+#include "../config.h"
+#include "../cstdint/types.h"
+#include "../num_traits/set_width.h"
+#include "../num_traits/width.h"
+#include "definition.h"
+#include "multiply.h"
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // number of bits needed to represent the given non-negative value
+        template<std::unsigned_integral Integer>
+        [[nodiscard]] constexpr auto duplex_integer_bit_width(Integer const& value) -> int
+        {
+            return static_cast<int>(std::bit_width(value));
+        }
+
+        template<typename Upper, typename Lower>
+        [[nodiscard]] constexpr auto duplex_integer_bit_width(duplex_integer<Upper, Lower> const& value) -> int
+        {
+            return value.upper() ? width<Lower> + duplex_integer_bit_width(value.upper())
+                                 : duplex_integer_bit_width(value.lower());
+        }
+
+        // quotient and remainder of cnl::_impl::long_divide
+        template<typename Word>
+        struct long_divide_result {
+            Word quotient;
+            Word remainder;
+        };
+
+#if defined(CNL_HARDWARE_DIVIDE_ENABLED)
+        // divides upper:lower by divisor using a single instruction
+        [[nodiscard]] inline auto hardware_long_divide(
+                std::uint64_t upper, std::uint64_t lower, std::uint64_t divisor)
+                -> long_divide_result<std::uint64_t>
+        {
+            std::uint64_t quotient{};
+            std::uint64_t remainder{};
+            // NOLINTNEXTLINE(hicpp-no-assembler)
+            asm("divq %[divisor]"
+                : "=a"(quotient), "=d"(remainder)
+                : [divisor] "rm"(divisor), "a"(lower), "d"(upper)
+                : "cc");
+            return {quotient, remainder};
+        }
+#endif
+
+        // Knuth's Algorithm D using half-word digits;
+        // adapted from divlu in Hacker's Delight, 2nd Edition, Figure 9-3
+        template<typename Word>
+        [[nodiscard]] constexpr auto half_word_long_divide(
+                Word const& upper, Word const& lower, Word const& divisor) -> long_divide_result<Word>
+        {
+            constexpr auto word_width{width<Word>};
+            constexpr auto half_width{word_width / 2};
+            auto const half_radix{Word{1} << half_width};
+            auto const half_mask{static_cast<Word>(half_radix - Word{1})};
+
+            // normalize so that the most significant bit of the divisor is set
+            auto const shift{word_width - duplex_integer_bit_width(divisor)};
+            auto const normalized_divisor{static_cast<Word>(divisor << shift)};
+            auto const divisor_upper{static_cast<Word>(normalized_divisor >> half_width)};
+            auto const divisor_lower{static_cast<Word>(normalized_divisor & half_mask)};
+
+            auto const numerator_upper{
+                    shift ? static_cast<Word>((upper << shift) | (lower >> (word_width - shift))) : upper};
+            auto const numerator_lower{static_cast<Word>(lower << shift)};
+            auto const numerator_digit1{static_cast<Word>(numerator_lower >> half_width)};
+            auto const numerator_digit0{static_cast<Word>(numerator_lower & half_mask)};
+
+            // estimates a quotient digit and corrects it so that it is at most one too large
+            auto const divide_digit = [&](Word const& numerator, Word const& next_digit) {
+                auto quotient{static_cast<Word>(numerator / divisor_upper)};
+                auto remainder{static_cast<Word>(numerator - quotient * divisor_upper)};
+                while (quotient >= half_radix
+                       || quotient * divisor_lower > ((remainder << half_width) | next_digit)) {
+                    --quotient;
+                    remainder = static_cast<Word>(remainder + divisor_upper);
+                    if (remainder >= half_radix) {
+                        break;
+                    }
+                }
+                return quotient;
+            };
+
+            auto const quotient1{divide_digit(numerator_upper, numerator_digit1)};
+            auto const partial_remainder{static_cast<Word>(
+                    ((numerator_upper << half_width) | numerator_digit1) - quotient1 * normalized_divisor)};
+            auto const quotient0{divide_digit(partial_remainder, numerator_digit0)};
+            auto const remainder{static_cast<Word>(
+                    ((partial_remainder << half_width) | numerator_digit0) - quotient0 * normalized_divisor)};
+
+            return {static_cast<Word>((quotient1 << half_width) | quotient0),
+                    static_cast<Word>(remainder >> shift)};
+        }
+
+        // cnl::_impl::long_divide - divides upper:lower by divisor where upper < divisor
+        template<typename Word>
+        [[nodiscard]] constexpr auto long_divide(
+                Word const& upper, Word const& lower, Word const& divisor) -> long_divide_result<Word>
+        {
+            CNL_ASSERT(upper < divisor);
+#if defined(CNL_HARDWARE_DIVIDE_ENABLED)
+            if constexpr (std::unsigned_integral<Word> && width<Word> == width<std::uint64_t>) {
+                if (!std::is_constant_evaluated()) {
+                    auto const result{hardware_long_divide(upper, lower, divisor)};
+                    return {static_cast<Word>(result.quotient), static_cast<Word>(result.remainder)};
+                }
+            }
+#endif
+            if constexpr (std::unsigned_integral<Word> && width<Word> * 2 <= width<uintmax_t>) {
+                using double_word = set_width_t<Word, width<Word> * 2>;
+                auto const dividend{static_cast<double_word>((double_word{upper} << width<Word>) | lower)};
+                return {static_cast<Word>(dividend / divisor), static_cast<Word>(dividend % divisor)};
+            } else {
+                return half_word_long_divide(upper, lower, divisor);
+            }
+        }
+
+        // cnl::_impl::word_reciprocal - divides double words by an invariant word using multiplication;
+        // Algorithm 4 from "Improved division by invariant integers", Möller & Granlund, 2011
+        template<std::unsigned_integral Word>
+        class word_reciprocal {
+        public:
+            explicit constexpr word_reciprocal(Word const& divisor)
+                : _shift(width<Word> - duplex_integer_bit_width(divisor))
+                , _divisor(static_cast<Word>(divisor << _shift))
+                , _reciprocal(long_divide(static_cast<Word>(~_divisor), static_cast<Word>(~Word{}), _divisor).quotient)
+            {
+            }
+
+            // divides upper:lower by the divisor where upper < divisor
+            [[nodiscard]] constexpr auto divide(Word const& upper, Word const& lower) const
+                    -> long_divide_result<Word>
+            {
+                auto const numerator_upper{
+                        _shift ? static_cast<Word>((upper << _shift) | (lower >> (width<Word> - _shift))) : upper};
+                auto const numerator_lower{static_cast<Word>(lower << _shift)};
+
+                // estimate of quotient and fraction
+                auto const product{long_multiply<Word>{}(_reciprocal, numerator_upper)};
+                auto const product_lower{static_cast<Word>(product)};
+                auto const fraction{static_cast<Word>(product_lower + numerator_lower)};
+                auto quotient{static_cast<Word>(
+                        long_product_upper<Word>(product) + numerator_upper + Word{fraction < product_lower} + Word{1})};
+
+                auto remainder{static_cast<Word>(numerator_lower - static_cast<Word>(quotient * _divisor))};
+                if (remainder > fraction) {
+                    --quotient;
+                    remainder = static_cast<Word>(remainder + _divisor);
+                }
+                if (CNL_UNLIKELY(remainder >= _divisor)) {
+                    ++quotient;
+                    remainder = static_cast<Word>(remainder - _divisor);
+                }
+
+                return {quotient, static_cast<Word>(remainder >> _shift)};
+            }
+
+        private:
+            int _shift;
+            Word _divisor;
+            Word _reciprocal;
+        };
+
+        // reciprocal of a divisor which is known at compile time
+        template<std::unsigned_integral Word, auto Divisor>
+        inline constexpr auto constant_word_reciprocal = word_reciprocal<Word>{static_cast<Word>(Divisor)};
+    }
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_LONG_DIVIDE_H
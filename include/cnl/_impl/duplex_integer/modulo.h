@@ -0,0 +1,32 @@
+//          Copyright John McFarlane 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_MODULO_H)
+#define CNL_IMPL_DUPLEX_INTEGER_MODULO_H
+
+#include "../custom_operator/definition.h"
+#include "../custom_operator/op.h"
+#include "definition.h"
+#include "divide.h"
+#include "multiply.h"
+
+/// compositional numeric library
+namespace cnl {
+    // duplex_integer<> % duplex_integer<>
+    template<typename Upper, typename Lower>
+    struct custom_operator<
+            _impl::modulo_op,
+            op_value<_impl::duplex_integer<Upper, Lower>>,
+            op_value<_impl::duplex_integer<Upper, Lower>>> {
+        [[nodiscard]] constexpr auto operator()(
+                _impl::duplex_integer<Upper, Lower> const& lhs,
+                _impl::duplex_integer<Upper, Lower> const& rhs) const -> _impl::duplex_integer<Upper, Lower>
+        {
+            return lhs - (lhs / rhs) * rhs;
+        }
+    };
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_MODULO_H
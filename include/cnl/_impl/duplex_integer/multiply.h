@@ -1,4 +1,3 @@
-
 //          Copyright John McFarlane 2018.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file ../LICENSE_1_0.txt or copy at
@@ -7,38 +6,29 @@
 #if !defined(CNL_IMPL_DUPLEX_INTEGER_MULTIPLY_H)
 #define CNL_IMPL_DUPLEX_INTEGER_MULTIPLY_H
 
+#include "../cstdint/types.h"
 #include "../custom_operator/definition.h"
 #include "../custom_operator/op.h"
+#include "../num_traits/set_width.h"
 #include "../num_traits/width.h"
-#include "../type_traits/conditional3.h"
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
 #include "definition.h"
 #include "digits.h"
-#include "numeric_limits.h"
-#include "set_width.h"
+
+#include <concepts>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
     namespace _impl {
-        template<typename Lhs, typename Rhs>
-        struct heterogeneous_duplex_multiply_operator {
-            using common_type = conditional3_t<
-                    width<Lhs> - width<Rhs>, Lhs,
-                    conditional3_t<(numbers::signedness_v<Lhs> - numbers::signedness_v<Rhs>), Lhs, void, Rhs>,
-                    Rhs>;
-
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
-            {
-                return static_cast<common_type>(lhs) * static_cast<common_type>(rhs);
-            }
-        };
-
-        // long_multiply - T should be same width as operands
-        template<typename T>
+        // long_multiply - multiplies two values of type, Word, producing a result twice as wide
+        template<typename Word>
         struct long_multiply;
 
-        // std::int64_t
-        template<typename Word>
-        struct long_multiply {
+        // e.g. std::uint32_t * std::uint32_t -> std::uint64_t
+        template<std::integral Word>
+        requires(width<Word> * 2 <= width<uintmax_t>) struct long_multiply<Word> {
             template<typename Lhs, typename Rhs>
             using result_type = set_width_t<Word, width<Lhs> + width<Rhs>>;
 
@@ -51,60 +41,94 @@ namespace cnl {
             }
         };
 
-        // duplex_integer<std::int64_t, std::int64_t>
+        // e.g. std::uint64_t * std::uint64_t -> duplex_integer<std::uint64_t, std::uint64_t>
+        // where no fundamental type is wide enough to hold the product
+        template<std::unsigned_integral Word>
+        requires(width<Word> * 2 > width<uintmax_t>) struct long_multiply<Word> {
+            using result_type = duplex_integer<Word, Word>;
+
+            [[nodiscard]] constexpr auto operator()(Word const& lhs, Word const& rhs) const -> result_type
+            {
+                constexpr auto half_width{width<Word> / 2};
+                constexpr auto mask{static_cast<Word>(~Word{} >> half_width)};
+
+                auto const lhs_lower{static_cast<Word>(lhs & mask)};
+                auto const lhs_upper{static_cast<Word>(lhs >> half_width)};
+                auto const rhs_lower{static_cast<Word>(rhs & mask)};
+                auto const rhs_upper{static_cast<Word>(rhs >> half_width)};
+
+                auto const lower_lower{static_cast<Word>(lhs_lower * rhs_lower)};
+                auto const lower_upper{static_cast<Word>(lhs_lower * rhs_upper)};
+                auto const upper_lower{static_cast<Word>(lhs_upper * rhs_lower)};
+                auto const upper_upper{static_cast<Word>(lhs_upper * rhs_upper)};
+
+                // sum of three half-width values cannot overflow
+                auto const middle{static_cast<Word>(
+                        (lower_lower >> half_width) + (lower_upper & mask) + (upper_lower & mask))};
+
+                return result_type{
+                        static_cast<Word>(
+                                upper_upper + (lower_upper >> half_width) + (upper_lower >> half_width)
+                                + (middle >> half_width)),
+                        static_cast<Word>((lower_lower & mask) | static_cast<Word>(middle << half_width))};
+            }
+        };
+
+        // e.g. duplex_integer<std::uint32_t, std::uint32_t> * duplex_integer<std::uint32_t, std::uint32_t>
+        // -> duplex_integer<duplex_integer<std::uint32_t, std::uint32_t>, duplex_integer<std::uint32_t, std::uint32_t>>
         template<typename Upper, typename Lower>
         struct long_multiply<duplex_integer<Upper, Lower>> {
         private:
             using operand = duplex_integer<Upper, Lower>;
-            using result_type =
-                    duplex_integer<operand, duplex_integer<Lower, Lower>>;
+            static_assert(!numbers::signedness_v<operand>, "long_multiply is only defined for unsigned integers");
+
+            static constexpr auto lower_width{width<Lower>};
 
         public:
-            template<typename LhsUpper, typename LhsLower, typename RhsUpper, typename RhsLower>
-            [[nodiscard]] constexpr auto operator()(
-                    duplex_integer<LhsUpper, LhsLower> const& lhs,
-                    duplex_integer<RhsUpper, RhsLower> const& rhs) const -> result_type
+            using result_type = duplex_integer<operand, operand>;
+
+            template<typename Lhs, typename Rhs>
+            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result_type
             {
-                return multiply_components(lhs.upper(), lhs.lower(), rhs.upper(), rhs.lower());
+                return multiply_components(static_cast<operand>(lhs), static_cast<operand>(rhs));
             }
 
-            template<typename Lhs, typename RhsUpper, typename RhsLower>
-            [[nodiscard]] constexpr auto operator()(
-                    Lhs const& lhs, duplex_integer<RhsUpper, RhsLower> const& rhs) const
-                    -> result_type
+        private:
+            // long multiplication of two words of potentially different types
+            template<typename Lhs, typename Rhs>
+            [[nodiscard]] static constexpr auto multiply_words(Lhs const& lhs, Rhs const& rhs)
             {
-                return multiply_components(0, lhs, rhs.upper(), rhs.lower());
+                using word = std::conditional_t<(width<Lhs> < width<Rhs>), Rhs, Lhs>;
+                return long_multiply<word>{}(static_cast<word>(lhs), static_cast<word>(rhs));
             }
 
-            template<typename LhsUpper, typename LhsLower, typename Rhs>
-            [[nodiscard]] constexpr auto operator()(
-                    duplex_integer<LhsUpper, LhsLower> const& lhs, Rhs const& rhs) const
+            [[nodiscard]] static constexpr auto multiply_components(operand const& lhs, operand const& rhs)
                     -> result_type
             {
-                return multiply_components(lhs.upper(), lhs.lower(), 0, rhs);
+                auto const upper_upper{multiply_words(lhs.upper(), rhs.upper())};
+                auto const upper_lower{multiply_words(lhs.upper(), rhs.lower())};
+                auto const lower_upper{multiply_words(lhs.lower(), rhs.upper())};
+                auto const lower_lower{long_multiply<Lower>{}(lhs.lower(), rhs.lower())};
+                return (result_type(upper_upper) << (lower_width * 2))
+                     + (result_type(upper_lower) << lower_width)
+                     + (result_type(lower_upper) << lower_width)
+                     + result_type(lower_lower);
             }
+        };
 
-            template<typename LhsUpper, typename LhsLower, typename RhsUpper, typename RhsLower>
-            [[nodiscard]] static constexpr auto multiply_components(
-                    LhsUpper const& lhs_upper, LhsLower const& lhs_lower, RhsUpper const& rhs_upper,
-                    RhsLower const& rhs_lower) -> result_type
-            {
-                auto const upper_upper{_impl::long_multiply<Upper>{}(lhs_upper, rhs_upper)};
-                auto const upper_lower{_impl::long_multiply<Upper>{}(lhs_upper, rhs_lower)};
-                auto const lower_upper{_impl::long_multiply<Upper>{}(lhs_lower, rhs_upper)};
-                auto const lower_lower{_impl::long_multiply<Lower>{}(lhs_lower, rhs_lower)};
-                auto const upper{_impl::sensible_left_shift<result_type>(
-                        upper_upper,
-                        digits_v<LhsLower> + digits_v<RhsLower>)};
-                auto const mid{
-                        (result_type{upper_lower} << digits_v<LhsLower>)+(result_type{lower_upper} << digits_v<RhsLower>)};
-                auto const lower{lower_lower};
-                return upper + mid + lower;
+        // bits [width<Lower>, 2*width<Lower>) of the result of long_multiply<Lower>
+        template<typename Lower, typename Product>
+        [[nodiscard]] constexpr auto long_product_upper(Product const& product) -> Lower
+        {
+            if constexpr (is_duplex_integer_v<Product>) {
+                return static_cast<Lower>(product.upper());
+            } else {
+                return static_cast<Lower>(product >> width<Lower>);
             }
-        };
+        }
     }
 
-    // duplex_integer<> * duplex_integer<>>
+    // duplex_integer<> * duplex_integer<>
     template<typename Upper, typename Lower>
     struct custom_operator<
             _impl::multiply_op,
@@ -114,54 +138,28 @@ namespace cnl {
         using operand = _impl::duplex_integer<Upper, Lower>;
 
     public:
+        // (lhs_upper*2^w + lhs_lower) * (rhs_upper*2^w + rhs_lower) modulo 2^(width<Upper>+w)
+        // where w is the width of Lower; only the product of the lower components
+        // is needed in full
         [[nodiscard]] constexpr auto operator()(
                 operand const& lhs, operand const& rhs) const -> operand
         {
-            return multiply_components(lhs.upper(), lhs.lower(), rhs.upper(), rhs.lower());
-        }
-
-        [[nodiscard]] static constexpr auto multiply_components(
-                Upper const& lhs_upper, Lower const& lhs_lower, Upper const& rhs_upper,
-                Lower const& rhs_lower) -> operand
-        {
-            auto const upper_upper{_impl::long_multiply<Upper>{}(lhs_upper, rhs_upper)};
-            auto const upper_lower{_impl::long_multiply<Upper>{}(lhs_upper, rhs_lower)};
-            auto const lower_upper{_impl::long_multiply<Upper>{}(lhs_lower, rhs_upper)};
-            auto const lower_lower{_impl::long_multiply<Lower>{}(lhs_lower, rhs_lower)};
-            auto const upper{_impl::sensible_left_shift<operand>(upper_upper, digits_v<Lower> * 2)};
-            auto const mid{(upper_lower + lower_upper) << digits_v<Lower>};
-            auto const lower{lower_lower};
-            return upper + mid + lower;
+            constexpr auto lower_width{_impl::width<Lower>};
+
+            auto const lower_lower{_impl::long_multiply<Lower>{}(lhs.lower(), rhs.lower())};
+            auto const upper_lower{_impl::wrapping_multiply(lhs.upper(), static_cast<Upper>(rhs.lower()))};
+            auto const lower_upper{_impl::wrapping_multiply(static_cast<Upper>(lhs.lower()), rhs.upper())};
+            auto const carry{static_cast<Upper>(_impl::long_product_upper<Lower>(lower_lower))};
+            auto upper{_impl::wrapping_add(_impl::wrapping_add(upper_lower, lower_upper), carry)};
+            if constexpr (_impl::width<Upper> > lower_width) {
+                upper = _impl::wrapping_add(
+                        upper,
+                        _impl::sensible_left_shift<Upper>(
+                                _impl::wrapping_multiply(lhs.upper(), rhs.upper()), lower_width));
+            }
+            return operand(upper, static_cast<Lower>(lower_lower));
         }
     };
-
-    template<typename LhsUpper, typename LhsLower, typename RhsUpper, typename RhsLower>
-    struct custom_operator<
-            _impl::multiply_op,
-            op_value<_impl::duplex_integer<LhsUpper, LhsLower>>,
-            op_value<_impl::duplex_integer<RhsUpper, RhsLower>>>
-        : _impl::heterogeneous_duplex_multiply_operator<
-                  _impl::duplex_integer<LhsUpper, LhsLower>,
-                  _impl::duplex_integer<RhsUpper, RhsLower>> {
-    };
-
-    template<typename LhsUpper, typename LhsLower, typename Rhs>
-    struct custom_operator<
-            _impl::multiply_op,
-            op_value<_impl::duplex_integer<LhsUpper, LhsLower>>,
-            op_value<Rhs>>
-        : _impl::heterogeneous_duplex_multiply_operator<
-                  _impl::duplex_integer<LhsUpper, LhsLower>, Rhs> {
-    };
-
-    template<typename Lhs, typename RhsUpper, typename RhsLower>
-    struct custom_operator<
-            _impl::multiply_op,
-            op_value<Lhs>,
-            op_value<_impl::duplex_integer<RhsUpper, RhsLower>>>
-        : _impl::heterogeneous_duplex_multiply_operator<
-                  Lhs, _impl::duplex_integer<RhsUpper, RhsLower>> {
-    };
 }
 
 #endif  // CNL_IMPL_DUPLEX_INTEGER_MULTIPLY_H
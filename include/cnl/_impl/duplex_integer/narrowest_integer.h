@@ -0,0 +1,58 @@
+//          Copyright John McFarlane 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_NARROWEST_INTEGER_H)
+#define CNL_IMPL_DUPLEX_INTEGER_NARROWEST_INTEGER_H
+
+#include "../num_traits/digits.h"
+#include "../num_traits/width.h"
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
+#include "declaration.h"
+
+#include <bit>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<int Digits, typename Narrowest>
+        struct narrowest_integer;
+
+        template<int Digits, typename Narrowest>
+        using narrowest_integer_t = typename narrowest_integer<Digits, Narrowest>::type;
+
+        // a tree of duplex_integer with Narrowest-sized leaves;
+        // the upper branch is the largest power-of-two number of words which leaves the lower branch non-empty
+        template<int Digits, typename Narrowest>
+        struct instantiate_duplex_integer {
+        private:
+            static constexpr auto is_signed{numbers::signedness_v<Narrowest>};
+            static constexpr auto word_width{width<Narrowest>};
+            static constexpr auto num_words{(Digits + is_signed + word_width - 1) / word_width};
+            static constexpr auto upper_num_words{static_cast<int>(std::bit_floor(unsigned(num_words - 1)))};
+            static constexpr auto lower_num_words{num_words - upper_num_words};
+
+            using unsigned_word = numbers::set_signedness_t<Narrowest, false>;
+            using upper = narrowest_integer_t<upper_num_words * word_width - is_signed, Narrowest>;
+            using lower = narrowest_integer_t<lower_num_words * word_width, unsigned_word>;
+
+        public:
+            using type = duplex_integer<upper, lower>;
+        };
+
+        // the narrowest integer made up of words of type, Narrowest,
+        // which has at least the given number of digits
+        template<int Digits, typename Narrowest>
+        struct narrowest_integer
+            : std::conditional_t<
+                      (Digits <= digits_v<Narrowest>),
+                      std::type_identity<Narrowest>,
+                      instantiate_duplex_integer<Digits, Narrowest>> {
+        };
+    }
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_NARROWEST_INTEGER_H
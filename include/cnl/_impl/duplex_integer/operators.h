@@ -1,4 +1,3 @@
-
 //          Copyright John McFarlane 2018.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file ../LICENSE_1_0.txt or copy at
@@ -7,15 +6,13 @@
 #if !defined(CNL_IMPL_DUPLEX_INTEGER_OPERATORS_H)
 #define CNL_IMPL_DUPLEX_INTEGER_OPERATORS_H
 
-#include "../../integer.h"
-#include "../../wide_integer.h"
 #include "../charconv/to_chars.h"
 #include "../config.h"
 #include "../custom_operator/definition.h"
 #include "../custom_operator/op.h"
 #include "../likely.h"
 #include "../num_traits/width.h"
-#include "../type_traits/common_type.h"
+#include "common_type.h"
 #include "comparison.h"
 #include "ctors.h"
 #include "definition.h"
@@ -23,12 +20,16 @@
 #include "divide.h"
 #include "modulo.h"
 #include "multiply.h"
+#include "narrowest_integer.h"
 #include "numbers.h"
 #include "numeric_limits.h"
 #include "set_digits.h"
 #include "shift.h"
+#include "to_rep.h"
 
+#include <concepts>
 #include <limits>
+#include <type_traits>
 #if defined(CNL_IOSTREAMS_ENABLED)
 #include <ostream>
 #endif
@@ -52,63 +53,22 @@ namespace cnl {
             }
         };
 
-        // add_op and subtract_op
-        template<binary_arithmetic_op Operator, any_duplex_integer Lhs, any_duplex_integer Rhs>
-        struct first_degree_binary_arithmetic_operator {
-        };
-
-        template<binary_arithmetic_op Operator, typename Upper, typename Lower>
-        struct first_degree_binary_arithmetic_operator<
-                Operator, duplex_integer<Upper, Lower>, duplex_integer<Upper, Lower>> {
+        // operands of different types are converted to a common type
+        template<op Operator, typename Lhs, typename Rhs>
+        struct heterogeneous_duplex_integer_operator {
         private:
-            using operand = duplex_integer<Upper, Lower>;
-
-            static constexpr auto lower_digits = digits_v<Lower>;
-            using wide_lower = set_digits_t<numbers::set_signedness_t<Lower, true>, lower_digits + 1>;
+            using common_type = duplex_integer_common_type_t<Lhs, Rhs>;
 
         public:
-            [[nodiscard]] constexpr auto operator()(
-                    operand const& lhs, operand const& rhs) const -> operand
-            {
-                return from_sums(
-                        static_cast<Upper>(Operator{}(lhs.upper(), rhs.upper())),
-                        wide_lower(Operator{}(wide_lower{lhs.lower()}, wide_lower{rhs.lower()})));
-            }
-
-            [[nodiscard]] static constexpr auto from_sums(
-                    Upper const& upper_sum, wide_lower const& lower_sum) -> operand
+            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
-                return operand{
-                        static_cast<Upper>(
-                                upper_sum
-                                + static_cast<Upper>(lower_sum >> constant<lower_digits>{})),
-                        static_cast<Lower>(lower_sum)};
-            }
-        };
-
-        template<
-                binary_arithmetic_op Operator,
-                integer LhsUpper, integer LhsLower,
-                integer RhsUpper, integer RhsLower>
-        struct first_degree_binary_arithmetic_operator<
-                Operator,
-                duplex_integer<LhsUpper, LhsLower>,
-                duplex_integer<RhsUpper, RhsLower>> {
-            using lhs_type = duplex_integer<LhsUpper, LhsLower>;
-            using rhs_type = duplex_integer<RhsUpper, RhsLower>;
-
-            using lhs_upper_word = duplex_integer_upper_t<LhsUpper>;
-            using rhs_upper_word = duplex_integer_upper_t<RhsUpper>;
-            using common_word = decltype(std::declval<lhs_upper_word>() + std::declval<rhs_upper_word>());
-            static constexpr int max_digits = std::max(digits_v<lhs_type>, digits_v<rhs_type>);
-            using common_duplex_integer = narrowest_integer_t<max_digits, common_word>;
-
-            [[nodiscard]] constexpr auto operator()(
-                    lhs_type const& lhs, rhs_type const& rhs) const
-                    -> common_duplex_integer
-            {
-                return first_degree_binary_arithmetic_operator<
-                        Operator, common_duplex_integer, common_duplex_integer>{}(lhs, rhs);
+                auto const result{Operator{}(static_cast<common_type>(lhs), static_cast<common_type>(rhs))};
+                if constexpr (std::is_same_v<Operator, divide_op> || std::is_same_v<Operator, modulo_op>) {
+                    // like fundamental integers, quotient and remainder take the type of the dividend
+                    return static_cast<Lhs>(result);
+                } else {
+                    return result;
+                }
             }
         };
     }
@@ -120,18 +80,17 @@ namespace cnl {
         [[nodiscard]] constexpr auto operator()(_impl::duplex_integer<Upper, Lower> const& rhs)
                 const -> _impl::duplex_integer<Upper, Lower>
         {
-            return _impl::duplex_integer<Upper, Lower>(~rhs.upper(), ~rhs.lower());
+            return _impl::duplex_integer<Upper, Lower>(
+                    static_cast<Upper>(~rhs.upper()), static_cast<Lower>(~rhs.lower()));
         }
     };
 
-    // binary arithmetic
     template<typename Upper, typename Lower>
     struct custom_operator<_impl::minus_op, op_value<_impl::duplex_integer<Upper, Lower>>> {
         [[nodiscard]] constexpr auto operator()(_impl::duplex_integer<Upper, Lower> const& rhs)
                 const -> _impl::duplex_integer<Upper, Lower>
         {
-            return _impl::operate<_impl::bitwise_not_op>{}(
-                    rhs - _impl::duplex_integer<Upper, Lower>{1});
+            return _impl::duplex_integer<Upper, Lower>{} - rhs;
         }
     };
 
@@ -140,39 +99,40 @@ namespace cnl {
         [[nodiscard]] constexpr auto operator()(_impl::duplex_integer<Upper, Lower> const& rhs)
                 const -> _impl::duplex_integer<Upper, Lower>
         {
-            return _impl::duplex_integer<Upper, Lower>(+rhs.upper(), +rhs.lower());
+            return rhs;
         }
     };
 
-    template<_impl::binary_arithmetic_op Operator, _impl::any_duplex_integer Lhs, integer Rhs>
-    requires(!_impl::is_duplex_integer_v<Rhs>) struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
-        {
-            return _impl::operate<Operator>{}(lhs, Lhs{rhs});
-        }
-    };
-
-    template<_impl::binary_arithmetic_op Operator, integer Lhs, _impl::any_duplex_integer Rhs>
-    requires(!_impl::is_duplex_integer_v<Lhs>) struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
-        {
-            return _impl::operate<Operator>{}(lhs, rhs);
-        }
-    };
-
-    template<_impl::any_duplex_integer Lhs, _impl::any_duplex_integer Rhs>
-    struct custom_operator<_impl::add_op, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+    // binary arithmetic
+    template<typename Upper, typename Lower>
+    struct custom_operator<
+            _impl::add_op,
+            op_value<_impl::duplex_integer<Upper, Lower>>,
+            op_value<_impl::duplex_integer<Upper, Lower>>> {
+        [[nodiscard]] constexpr auto operator()(
+                _impl::duplex_integer<Upper, Lower> const& lhs,
+                _impl::duplex_integer<Upper, Lower> const& rhs) const -> _impl::duplex_integer<Upper, Lower>
         {
-            return _impl::first_degree_binary_arithmetic_operator<_impl::add_op, Lhs, Rhs>{}(lhs, rhs);
+            auto const lower{static_cast<Lower>(_impl::wrapping_add(lhs.lower(), rhs.lower()))};
+            auto const carry{static_cast<Upper>(lower < lhs.lower())};
+            return _impl::duplex_integer<Upper, Lower>(
+                    _impl::wrapping_add(_impl::wrapping_add(lhs.upper(), rhs.upper()), carry), lower);
         }
     };
 
-    template<_impl::any_duplex_integer Lhs, _impl::any_duplex_integer Rhs>
-    struct custom_operator<_impl::subtract_op, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+    template<typename Upper, typename Lower>
+    struct custom_operator<
+            _impl::subtract_op,
+            op_value<_impl::duplex_integer<Upper, Lower>>,
+            op_value<_impl::duplex_integer<Upper, Lower>>> {
+        [[nodiscard]] constexpr auto operator()(
+                _impl::duplex_integer<Upper, Lower> const& lhs,
+                _impl::duplex_integer<Upper, Lower> const& rhs) const -> _impl::duplex_integer<Upper, Lower>
         {
-            return _impl::first_degree_binary_arithmetic_operator<_impl::subtract_op, Lhs, Rhs>{}(lhs, rhs);
+            auto const borrow{static_cast<Upper>(lhs.lower() < rhs.lower())};
+            return _impl::duplex_integer<Upper, Lower>(
+                    _impl::wrapping_subtract(_impl::wrapping_subtract(lhs.upper(), rhs.upper()), borrow),
+                    static_cast<Lower>(_impl::wrapping_subtract(lhs.lower(), rhs.lower())));
         }
     };
 
@@ -200,49 +160,43 @@ namespace cnl {
         : _impl::default_binary_arithmetic_operator<_impl::bitwise_xor_op, Upper, Lower> {
     };
 
-    template<
-            _impl::comparison_op Operator, typename LhsUpper, typename LhsLower, typename RhsUpper,
-            typename RhsLower>
-    struct custom_operator<
-            Operator,
-            op_value<_impl::duplex_integer<LhsUpper, LhsLower>>,
-            op_value<_impl::duplex_integer<RhsUpper, RhsLower>>> {
-        [[nodiscard]] constexpr auto operator()(
-                _impl::duplex_integer<LhsUpper, LhsLower> const& lhs,
-                _impl::duplex_integer<RhsUpper, RhsLower> const& rhs) const -> bool
-        {
-            using common_type = _impl::duplex_integer<
-                    _impl::common_type_t<LhsUpper, RhsUpper>,
-                    _impl::common_type_t<LhsLower, RhsLower>>;
-            return _impl::operate<Operator>{}(common_type{lhs}, common_type{rhs});
-        }
+    // duplex_integer<> OP integer or integer OP duplex_integer<> of a different type
+    template<_impl::binary_arithmetic_op Operator, _impl::duplex_integer_operand Lhs, _impl::duplex_integer_operand Rhs>
+    requires((_impl::any_duplex_integer<Lhs> || _impl::any_duplex_integer<Rhs>) && !std::same_as<Lhs, Rhs>) struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>>
+        : _impl::heterogeneous_duplex_integer_operator<Operator, Lhs, Rhs> {
+    };
+
+    template<_impl::comparison_op Operator, _impl::duplex_integer_operand Lhs, _impl::duplex_integer_operand Rhs>
+    requires((_impl::any_duplex_integer<Lhs> || _impl::any_duplex_integer<Rhs>) && !std::same_as<Lhs, Rhs>) struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>>
+        : _impl::heterogeneous_duplex_integer_operator<Operator, Lhs, Rhs> {
     };
 
     // prefix operators
     template<typename Upper, typename Lower>
     struct custom_operator<
             _impl::pre_increment_op, op_value<_impl::duplex_integer<Upper, Lower>>> {
-        [[nodiscard]] constexpr auto operator()(_impl::duplex_integer<Upper, Lower>& rhs) const
-                -> _impl::duplex_integer<Upper, Lower>
+        constexpr auto operator()(_impl::duplex_integer<Upper, Lower>& rhs) const
+                -> _impl::duplex_integer<Upper, Lower>&
         {
-            return CNL_UNLIKELY(rhs.lower() == std::numeric_limits<Lower>::max())
-                         ? _impl::duplex_integer<
-                                 Upper, Lower>{++rhs.upper(), std::numeric_limits<Lower>::lowest()}
-                         : _impl::duplex_integer<Upper, Lower>{rhs.upper(), ++rhs.lower()};
+            if (CNL_UNLIKELY(rhs.lower() == std::numeric_limits<Lower>::max())) {
+                rhs.upper() = _impl::wrapping_add(rhs.upper(), Upper{1});
+            }
+            rhs.lower() = _impl::wrapping_add(rhs.lower(), Lower{1});
+            return rhs;
         }
     };
 
     template<typename Upper, typename Lower>
     struct custom_operator<
             _impl::pre_decrement_op, op_value<_impl::duplex_integer<Upper, Lower>>> {
-        [[nodiscard]] constexpr auto operator()(_impl::duplex_integer<Upper, Lower>& rhs) const
-                -> _impl::duplex_integer<Upper, Lower>
+        constexpr auto operator()(_impl::duplex_integer<Upper, Lower>& rhs) const
+                -> _impl::duplex_integer<Upper, Lower>&
         {
-            return CNL_UNLIKELY(rhs.lower() == std::numeric_limits<Lower>::lowest())
-                         ? _impl::duplex_integer<
-                                 Upper,
-                                 Lower>{static_cast<Upper>(--rhs.upper()), std::numeric_limits<Lower>::max()}
-                         : _impl::duplex_integer<Upper, Lower>{rhs.upper(), --rhs.lower()};
+            if (CNL_UNLIKELY(rhs.lower() == std::numeric_limits<Lower>::lowest())) {
+                rhs.upper() = _impl::wrapping_subtract(rhs.upper(), Upper{1});
+            }
+            rhs.lower() = _impl::wrapping_subtract(rhs.lower(), Lower{1});
+            return rhs;
         }
     };
 
@@ -0,0 +1,84 @@
+//          Copyright John McFarlane 2018.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_SHIFT_H)
+#define CNL_IMPL_DUPLEX_INTEGER_SHIFT_H
+
+#include "../../integer.h"
+#include "../custom_operator/definition.h"
+#include "../custom_operator/op.h"
+#include "../num_traits/width.h"
+#include "definition.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<typename Upper, typename Lower>
+        struct duplex_integer_shift {
+            using operand = duplex_integer<Upper, Lower>;
+            static constexpr auto lower_width{width<Lower>};
+
+            [[nodiscard]] static constexpr auto left(operand const& lhs, int rhs) -> operand
+            {
+                if (!rhs) {
+                    return lhs;
+                }
+                if (rhs >= lower_width) {
+                    return operand(sensible_left_shift<Upper>(lhs.lower(), rhs - lower_width), Lower{});
+                }
+                return operand(
+                        static_cast<Upper>(
+                                sensible_left_shift<Upper>(lhs.upper(), rhs)
+                                | static_cast<Upper>(lhs.lower() >> (lower_width - rhs))),
+                        sensible_left_shift<Lower>(lhs.lower(), rhs));
+            }
+
+            [[nodiscard]] static constexpr auto right(operand const& lhs, int rhs) -> operand
+            {
+                if (!rhs) {
+                    return lhs;
+                }
+                if (rhs >= lower_width) {
+                    return operand(
+                            sensible_right_shift<Upper>(lhs.upper(), rhs),
+                            sensible_right_shift<Lower>(lhs.upper(), rhs - lower_width));
+                }
+                return operand(
+                        sensible_right_shift<Upper>(lhs.upper(), rhs),
+                        static_cast<Lower>(
+                                static_cast<Lower>(lhs.lower() >> rhs)
+                                | sensible_left_shift<Lower>(lhs.upper(), lower_width - rhs)));
+            }
+        };
+    }
+
+    template<typename Upper, typename Lower, integer Rhs>
+    struct custom_operator<
+            _impl::shift_left_op,
+            op_value<_impl::duplex_integer<Upper, Lower>>,
+            op_value<Rhs>> {
+        [[nodiscard]] constexpr auto operator()(
+                _impl::duplex_integer<Upper, Lower> const& lhs, Rhs const& rhs) const
+                -> _impl::duplex_integer<Upper, Lower>
+        {
+            return _impl::duplex_integer_shift<Upper, Lower>::left(lhs, static_cast<int>(rhs));
+        }
+    };
+
+    template<typename Upper, typename Lower, integer Rhs>
+    struct custom_operator<
+            _impl::shift_right_op,
+            op_value<_impl::duplex_integer<Upper, Lower>>,
+            op_value<Rhs>> {
+        [[nodiscard]] constexpr auto operator()(
+                _impl::duplex_integer<Upper, Lower> const& lhs, Rhs const& rhs) const
+                -> _impl::duplex_integer<Upper, Lower>
+        {
+            return _impl::duplex_integer_shift<Upper, Lower>::right(lhs, static_cast<int>(rhs));
+        }
+    };
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_SHIFT_H
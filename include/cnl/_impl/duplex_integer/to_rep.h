@@ -0,0 +1,20 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_TO_REP_H)
+#define CNL_IMPL_DUPLEX_INTEGER_TO_REP_H
+
+#include "../num_traits/to_rep.h"
+#include "declaration.h"
+
+/// compositional numeric library
+namespace cnl {
+    // like fundamental integers, duplex_integer is its own representation
+    template<_impl::any_duplex_integer Number>
+    struct to_rep<Number> : _impl::default_to_rep<Number> {
+    };
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_TO_REP_H
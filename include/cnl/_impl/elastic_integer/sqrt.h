@@ -16,7 +16,7 @@ namespace cnl {
     /// \brief \ref elastic_integer overload of cnl::sqrt
     /// \headerfile cnl/elastic_integer.h
     /// \return square root of `x`
-    /// \note This function has O(n) complexity where n is the number of significant digits.
+    /// \note The complexity is that of the integer overload of cnl::sqrt applied to the rep of `x`.
     /// \pre `x` must be non-negative
 
     template<int Digits, class Narrowest>
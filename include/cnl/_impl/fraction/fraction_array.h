@@ -0,0 +1,244 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::fraction_array definition
+
+#if !defined(CNL_IMPL_FRACTION_FRACTION_ARRAY_H)
+#define CNL_IMPL_FRACTION_FRACTION_ARRAY_H
+
+#include "../../fixed_point.h"
+#include "../cnl_assert.h"
+#include "ctors.h"
+#include "definition.h"
+#include "gcd.h"
+#include "operators.h"
+#include "reduce.h"
+
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief resizable sequence of fractions, stored as an array of numerators and an array of denominators
+    /// \headerfile cnl/fraction.h
+    ///
+    /// \tparam Numerator the type of each numerator
+    /// \tparam Denominator the type of each denominator
+    ///
+    /// \note Unlike a sequence of \ref cnl::fraction, whose numerators and denominators are interleaved,
+    /// this layout lets arithmetic on whole arrays, e.g. `+`, `*` and \ref cnl::compare, use SIMD instructions.
+    /// Each operation gives the same results as the corresponding \ref cnl::fraction operation
+    /// applied element by element.
+    template<fixed_point Numerator = int, fixed_point Denominator = Numerator>
+    class fraction_array {
+    public:
+        using value_type = fraction<Numerator, Denominator>;
+        using numerator_type = Numerator;
+        using denominator_type = Denominator;
+        using size_type = std::size_t;
+
+        fraction_array() = default;
+
+        /// creates an array of the given number of zero-valued fractions, `0/1`
+        explicit constexpr fraction_array(size_type size)
+            : _numerators(size)
+            , _denominators(size, Denominator{1})
+        {
+        }
+
+        /// creates an array holding the given fractions
+        explicit constexpr fraction_array(std::span<value_type const> fractions)
+            : _numerators(fractions.size())
+            , _denominators(fractions.size())
+        {
+            for (auto index{size_type{0}}; index != fractions.size(); ++index) {
+                _numerators[index] = fractions[index].numerator;
+                _denominators[index] = fractions[index].denominator;
+            }
+        }
+
+        /// creates an array from its numerators and denominators, which must be equal in number
+        constexpr fraction_array(std::vector<Numerator> numerators, std::vector<Denominator> denominators)
+            : _numerators(std::move(numerators))
+            , _denominators(std::move(denominators))
+        {
+            CNL_ASSERT(_numerators.size() == _denominators.size());
+        }
+
+        [[nodiscard]] constexpr auto size() const
+        {
+            return _numerators.size();
+        }
+
+        [[nodiscard]] constexpr auto empty() const
+        {
+            return _numerators.empty();
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type index) const
+        {
+            CNL_ASSERT(index < size());
+            return value_type{_numerators[index], _denominators[index]};
+        }
+
+        /// \brief the numerator of every fraction
+        [[nodiscard]] constexpr auto numerators()
+        {
+            return std::span<Numerator>{_numerators};
+        }
+
+        [[nodiscard]] constexpr auto numerators() const
+        {
+            return std::span<Numerator const>{_numerators};
+        }
+
+        /// \brief the denominator of every fraction
+        [[nodiscard]] constexpr auto denominators()
+        {
+            return std::span<Denominator>{_denominators};
+        }
+
+        [[nodiscard]] constexpr auto denominators() const
+        {
+            return std::span<Denominator const>{_denominators};
+        }
+
+        /// \brief converts every fraction to its quotient
+        ///
+        /// \tparam Quotient type of the results, e.g. a \ref cnl::scaled_integer specialization
+        /// \param destination receives the quotients; must be as long as the array
+        ///
+        /// \note Each quotient is converted as by `Quotient{fraction}`,
+        /// writing straight into the destination without creating intermediate \ref cnl::fraction objects.
+        template<class Quotient>
+        constexpr void quotients(std::span<Quotient> destination) const
+        {
+            CNL_ASSERT(destination.size() == size());
+            auto const* const numerators{_numerators.data()};
+            auto const* const denominators{_denominators.data()};
+            for (auto index{size_type{0}}; index != destination.size(); ++index) {
+                destination[index] = Quotient{value_type{numerators[index], denominators[index]}};
+            }
+        }
+
+    private:
+        std::vector<Numerator> _numerators;
+        std::vector<Denominator> _denominators;
+    };
+
+    namespace _impl {
+        // the fraction_array whose elements are of the given fraction type
+        template<class Fraction>
+        using fraction_array_of = fraction_array<typename Fraction::numerator_type, typename Fraction::denominator_type>;
+
+        // the fraction_array holding operation(lhs[0], rhs[0]), operation(lhs[1], rhs[1]), ...
+        template<class Lhs, class Rhs, class Operation>
+        [[nodiscard]] constexpr auto transform_fractions(Lhs const& lhs, Rhs const& rhs, Operation operation)
+        {
+            CNL_ASSERT(lhs.size() == rhs.size());
+            using result_fraction = decltype(operation(lhs[0], rhs[0]));
+
+            // the loop reads and writes the arrays through pointers which are known not to change
+            auto const lhs_numerators{lhs.numerators()};
+            auto const lhs_denominators{lhs.denominators()};
+            auto const rhs_numerators{rhs.numerators()};
+            auto const rhs_denominators{rhs.denominators()};
+            auto result{fraction_array_of<result_fraction>(lhs.size())};
+            auto const result_numerators{result.numerators()};
+            auto const result_denominators{result.denominators()};
+
+            for (auto index{std::size_t{0}}; index != result_numerators.size(); ++index) {
+                auto const element{operation(
+                        typename Lhs::value_type{lhs_numerators[index], lhs_denominators[index]},
+                        typename Rhs::value_type{rhs_numerators[index], rhs_denominators[index]})};
+                result_numerators[index] = element.numerator;
+                result_denominators[index] = element.denominator;
+            }
+            return result;
+        }
+
+        template<typename Numerator, typename Denominator>
+        [[nodiscard]] constexpr auto reduce(fraction_array<Numerator, Denominator> const& f)
+        {
+            using fraction_type = fraction<Numerator, Denominator>;
+            auto const numerators{f.numerators()};
+            auto const denominators{f.denominators()};
+
+            // every divisor is found before any division so that the divisions are independent of one another
+            auto divisors = std::vector<decltype(gcd(std::declval<fraction_type>()))>(f.size());
+            for (auto index{std::size_t{0}}; index != divisors.size(); ++index) {
+                divisors[index] = gcd(fraction_type{numerators[index], denominators[index]});
+            }
+
+            using result_fraction = decltype(reduce(std::declval<fraction_type>()));
+            auto result{fraction_array_of<result_fraction>(f.size())};
+            auto const result_numerators{result.numerators()};
+            auto const result_denominators{result.denominators()};
+            for (auto index{std::size_t{0}}; index != divisors.size(); ++index) {
+                auto const element{
+                        reduce_from_gcd(fraction_type{numerators[index], denominators[index]}, divisors[index])};
+                result_numerators[index] = element.numerator;
+                result_denominators[index] = element.denominator;
+            }
+            return result;
+        }
+    }
+
+    /// \brief adds the corresponding elements of two \ref cnl::fraction_array objects of equal size
+    template<class LhsNumerator, class LhsDenominator, class RhsNumerator, class RhsDenominator>
+    [[nodiscard]] constexpr auto operator+(
+            fraction_array<LhsNumerator, LhsDenominator> const& lhs,
+            fraction_array<RhsNumerator, RhsDenominator> const& rhs)
+    {
+        return _impl::transform_fractions(lhs, rhs, [](auto const& l, auto const& r) { return l + r; });
+    }
+
+    /// \brief subtracts the corresponding elements of two \ref cnl::fraction_array objects of equal size
+    template<class LhsNumerator, class LhsDenominator, class RhsNumerator, class RhsDenominator>
+    [[nodiscard]] constexpr auto operator-(
+            fraction_array<LhsNumerator, LhsDenominator> const& lhs,
+            fraction_array<RhsNumerator, RhsDenominator> const& rhs)
+    {
+        return _impl::transform_fractions(lhs, rhs, [](auto const& l, auto const& r) { return l - r; });
+    }
+
+    /// \brief multiplies the corresponding elements of two \ref cnl::fraction_array objects of equal size
+    template<class LhsNumerator, class LhsDenominator, class RhsNumerator, class RhsDenominator>
+    [[nodiscard]] constexpr auto operator*(
+            fraction_array<LhsNumerator, LhsDenominator> const& lhs,
+            fraction_array<RhsNumerator, RhsDenominator> const& rhs)
+    {
+        return _impl::transform_fractions(lhs, rhs, [](auto const& l, auto const& r) { return l * r; });
+    }
+
+    /// \brief compares the corresponding elements of two \ref cnl::fraction_array objects of equal size
+    /// \headerfile cnl/fraction.h
+    ///
+    /// \param lhs, rhs fractions to compare
+    /// \param result receives `-1`, `0` or `1` where the element of `lhs` is
+    /// less than, equal to or greater than the element of `rhs`; must be as long as `lhs` and `rhs`
+    template<class LhsNumerator, class LhsDenominator, class RhsNumerator, class RhsDenominator>
+    constexpr void compare(
+            fraction_array<LhsNumerator, LhsDenominator> const& lhs,
+            fraction_array<RhsNumerator, RhsDenominator> const& rhs,
+            std::span<int> result)
+    {
+        CNL_ASSERT(lhs.size() == rhs.size() && result.size() == lhs.size());
+        auto const lhs_numerators{lhs.numerators()};
+        auto const lhs_denominators{lhs.denominators()};
+        auto const rhs_numerators{rhs.numerators()};
+        auto const rhs_denominators{rhs.denominators()};
+        for (auto index{std::size_t{0}}; index != result.size(); ++index) {
+            auto const lhs_element{fraction<LhsNumerator, LhsDenominator>{lhs_numerators[index], lhs_denominators[index]}};
+            auto const rhs_element{fraction<RhsNumerator, RhsDenominator>{rhs_numerators[index], rhs_denominators[index]}};
+            result[index] = int{lhs_element > rhs_element} - int{lhs_element < rhs_element};
+        }
+    }
+}
+
+#endif  // CNL_IMPL_FRACTION_FRACTION_ARRAY_H
@@ -7,18 +7,61 @@
 #if !defined(CNL_IMPL_FRACTION_GCD_H)
 #define CNL_IMPL_FRACTION_GCD_H
 
+#include "../num_traits/digits.h"
 #include "definition.h"
 
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
 #include <numeric>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
     namespace _impl {
+        // Stein's algorithm, with a loop which is free of unpredictable branches
+        [[nodiscard]] constexpr auto binary_gcd(std::uint32_t u, std::uint32_t v) -> std::uint32_t
+        {
+            if (u == 0) {
+                return v;
+            }
+            if (v == 0) {
+                return u;
+            }
+
+            auto const shift{std::countr_zero(u | v)};
+            u >>= std::countr_zero(u);
+            do {
+                v >>= std::countr_zero(v);
+                auto const difference{std::int64_t{v} - std::int64_t{u}};
+                u = std::min(u, v);
+                v = static_cast<std::uint32_t>(difference < 0 ? -difference : difference);
+            } while (v != 0);
+            return u << shift;
+        }
+
+        // the magnitude of an integer of up to 32 bits
+        template<std::integral Integer>
+        [[nodiscard]] constexpr auto magnitude32(Integer const& i) -> std::uint32_t
+        {
+            auto const bits{static_cast<std::uint32_t>(i)};
+            return (i < Integer{0}) ? std::uint32_t{0} - bits : bits;
+        }
+
         template<typename Numerator, typename Denominator>
         [[nodiscard]] constexpr auto gcd(fraction<Numerator, Denominator> const& f)
         {
-            using std::gcd;
-            return gcd(f.numerator, f.denominator);
+            if constexpr (
+                    std::integral<Numerator> && std::integral<Denominator>
+                    && !std::is_same_v<Numerator, bool> && !std::is_same_v<Denominator, bool>
+                    && digits_v<Numerator> <= 32 && digits_v<Denominator> <= 32) {
+                return static_cast<std::common_type_t<Numerator, Denominator>>(
+                        binary_gcd(magnitude32(f.numerator), magnitude32(f.denominator)));
+            } else {
+                using std::gcd;
+                return gcd(f.numerator, f.denominator);
+            }
         }
     }
 }
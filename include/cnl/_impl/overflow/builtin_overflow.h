@@ -8,11 +8,22 @@
 #define CNL_IMPL_OVERFLOW_BUILTIN_OVERFLOW_H
 
 #include "../config.h"
+#include "../cstdint/types.h"
 #include "../custom_operator/op.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/rep_of.h"
+#include "../num_traits/tag_of.h"
+#include "../num_traits/to_rep.h"
+#include "../numbers/signedness.h"
 #include "../polarity.h"
+#include "../scaled/is_scaled_tag.h"
+#include "../wrapper/is_wrapper.h"
 #include "overflow_operator.h"
 
 #include <concepts>
+#include <limits>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
@@ -68,25 +79,85 @@ namespace cnl {
             }
         };
 
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_builtin_operand
+
+        template<typename Operand>
+        struct is_builtin_operand : std::is_integral<Operand> {
+        };
+
+#if defined(CNL_INT128_ENABLED)
+        // not integral in strict ISO mode, but accepted by the builtins
+        template<>
+        struct is_builtin_operand<int128_t> : std::true_type {
+        };
+
+        template<>
+        struct is_builtin_operand<uint128_t> : std::true_type {
+        };
+#endif
+
         ////////////////////////////////////////////////////////////////////////////////
         // cnl::_impl::are_builtin_operands
 
         template<typename Lhs, typename Rhs>
         struct are_builtin_operands
             : std::integral_constant<
-                      bool, std::is_integral_v<Lhs> && std::is_integral_v<Rhs>> {
+                      bool, is_builtin_operand<Lhs>::value && is_builtin_operand<Rhs>::value> {
         };
 
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::builtin_overflow_operand
+
+        // a wrapper whose value is the value of its rep, i.e. any but scaled_integer
+        template<typename T>
+        concept unscaled_wrapper = any_wrapper<T> && !scaled_tag<tag_of_t<T>>;
+
+        // the value in which overflow of operand is detected;
+        // the arithmetic operators of wrappers produce the values of the same operators applied to their reps
+        template<typename Operand>
+        [[nodiscard]] constexpr auto const& builtin_overflow_operand(Operand const& operand)
+        {
+            if constexpr (unscaled_wrapper<Operand>) {
+                return to_rep(operand);
+            } else {
+                return operand;
+            }
+        }
+
+        template<typename Operand>
+        using builtin_overflow_operand_t = std::remove_cvref_t<decltype(builtin_overflow_operand(std::declval<Operand>()))>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_outside_range
+
+        // true iff the rep of Number, rep, holds a value outside the range of Number,
+        // e.g. because Number is a wide_integer whose rep has more digits
+        template<any_wrapper Number>
+        [[nodiscard]] constexpr auto is_outside_range(rep_of_t<Number> const& rep)
+        {
+            using rep_type = rep_of_t<Number>;
+            constexpr auto max{rep_type{to_rep(std::numeric_limits<Number>::max())}};
+            constexpr auto lowest{rep_type{to_rep(std::numeric_limits<Number>::lowest())}};
+            if constexpr (max == std::numeric_limits<rep_type>::max() && lowest == std::numeric_limits<rep_type>::lowest()) {
+                return false;
+            } else {
+                return static_cast<bool>(static_cast<int>(rep > max) | static_cast<int>(rep < lowest));
+            }
+        }
+
         ////////////////////////////////////////////////////////////////////////////////
         // cnl::_impl::builtin_overflow_operator
 
+        // Lhs and Rhs are operands of Operator whose overflow into a given result is detected without
+        // examining their values beforehand, e.g. using compiler builtins
         template<binary_arithmetic_op Operator, typename Lhs, typename Rhs>
         struct builtin_overflow_operator : std::false_type {
         };
 
 #if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
         template<typename Lhs, typename Rhs>
-        struct builtin_overflow_operator<add_op, Lhs, Rhs> : are_builtin_operands<Lhs, Rhs> {
+        requires are_builtin_operands<Lhs, Rhs>::value struct builtin_overflow_operator<add_op, Lhs, Rhs> : std::true_type {
             template<typename Result>
             [[nodiscard]] constexpr auto operator()(
                     Lhs const& lhs, Rhs const& rhs, Result& result) const
@@ -96,7 +167,7 @@ namespace cnl {
         };
 
         template<typename Lhs, typename Rhs>
-        struct builtin_overflow_operator<subtract_op, Lhs, Rhs> : are_builtin_operands<Lhs, Rhs> {
+        requires are_builtin_operands<Lhs, Rhs>::value struct builtin_overflow_operator<subtract_op, Lhs, Rhs> : std::true_type {
             template<typename Result>
             [[nodiscard]] constexpr auto operator()(
                     Lhs const& lhs, Rhs const& rhs, Result& result) const
@@ -106,7 +177,7 @@ namespace cnl {
         };
 
         template<typename Lhs, typename Rhs>
-        struct builtin_overflow_operator<multiply_op, Lhs, Rhs> : are_builtin_operands<Lhs, Rhs> {
+        requires are_builtin_operands<Lhs, Rhs>::value struct builtin_overflow_operator<multiply_op, Lhs, Rhs> : std::true_type {
             template<typename Result>
             [[nodiscard]] constexpr auto operator()(
                     Lhs const& lhs, Rhs const& rhs, Result& result) const
@@ -115,6 +186,70 @@ namespace cnl {
             }
         };
 #endif
+
+        // wrappers are unwrapped until their reps are builtin operands;
+        // the result is then checked against the range of its wrapper;
+        // operations whose results are wider than their operands, e.g. of elastic_integer, are left to
+        // is_overflow, which determines at compile time that they do not overflow
+        template<binary_arithmetic_op Operator, typename Lhs, typename Rhs>
+        requires(unscaled_wrapper<Lhs> || unscaled_wrapper<Rhs>) struct builtin_overflow_operator<Operator, Lhs, Rhs>
+            : std::bool_constant<
+                      builtin_overflow_operator<Operator, builtin_overflow_operand_t<Lhs>, builtin_overflow_operand_t<Rhs>>::value
+                      && (std::is_same_v<op_result<Operator, Lhs, Rhs>, Lhs> || std::is_same_v<op_result<Operator, Lhs, Rhs>, Rhs>)> {
+            template<unscaled_wrapper Result>
+            [[nodiscard]] constexpr auto operator()(
+                    Lhs const& lhs, Rhs const& rhs, Result& result) const
+            {
+                using rep_operator = builtin_overflow_operator<
+                        Operator, builtin_overflow_operand_t<Lhs>, builtin_overflow_operand_t<Rhs>>;
+                auto rep{rep_of_t<Result>{}};
+                auto const overflowed{rep_operator{}(
+                        builtin_overflow_operand(lhs), builtin_overflow_operand(rhs), rep)};
+                result = from_rep<Result>(rep);
+                return static_cast<bool>(static_cast<int>(overflowed) | static_cast<int>(is_outside_range<Result>(rep)));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::builtin_overflow_convert
+
+        // Source is converted to Destination and overflow is detected without examining its value beforehand
+        template<typename Source, typename Destination>
+        struct builtin_overflow_convert : std::false_type {
+        };
+
+#if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
+        template<typename Source, typename Destination>
+        requires are_builtin_operands<Source, Destination>::value struct builtin_overflow_convert<Source, Destination> : std::true_type {
+            [[nodiscard]] constexpr auto operator()(Source const& from, Destination& to) const
+            {
+                return __builtin_add_overflow(from, Source{0}, &to);
+            }
+        };
+#endif
+
+        template<typename Source, typename Destination>
+        requires(unscaled_wrapper<Source> || unscaled_wrapper<Destination>) struct builtin_overflow_convert<Source, Destination>
+            : builtin_overflow_convert<builtin_overflow_operand_t<Source>, builtin_overflow_operand_t<Destination>> {
+            [[nodiscard]] constexpr auto operator()(Source const& from, Destination& to) const
+            {
+                using rep_convert = builtin_overflow_convert<
+                        builtin_overflow_operand_t<Source>, builtin_overflow_operand_t<Destination>>;
+                if constexpr (unscaled_wrapper<Destination>) {
+                    auto rep{rep_of_t<Destination>{}};
+                    auto const overflowed{rep_convert{}(builtin_overflow_operand(from), rep)};
+                    to = from_rep<Destination>(rep);
+                    if constexpr (digits_v<Source> <= digits_v<Destination> && (numbers::signedness_v<Destination> || !numbers::signedness_v<Source>)) {
+                        // every value of Source is in the range of Destination
+                        return overflowed;
+                    } else {
+                        return static_cast<bool>(static_cast<int>(overflowed) | static_cast<int>(is_outside_range<Destination>(rep)));
+                    }
+                } else {
+                    return rep_convert{}(builtin_overflow_operand(from), to);
+                }
+            }
+        };
     }
 }
 
@@ -9,6 +9,7 @@
 
 #include "../custom_operator/definition.h"
 #include "../polarity.h"
+#include "../unreachable.h"
 #include "builtin_overflow.h"
 #include "is_overflow.h"
 #include "is_overflow_tag.h"
@@ -44,7 +45,33 @@ namespace cnl {
 
     /// \cond
     template<typename Source, tag SrcTag, typename Destination, tag DestTag>
-    requires(_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, DestTag>> {
+    requires((_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value) && _impl::builtin_overflow_convert<Source, Destination>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, DestTag>> {
+        using overflow_tag = _impl::common_overflow_tag_t<DestTag, SrcTag>;
+
+        [[nodiscard]] constexpr auto operator()(Source const& from) const -> Destination
+        {
+            Destination to{};
+            if (!_impl::builtin_overflow_convert<Source, Destination>{}(from, to)) {
+                return to;
+            }
+
+            switch (_impl::overflow_polarity<_impl::convert_op>{}.template operator()<Destination>(from)) {
+            case _impl::polarity::positive:
+                return _impl::overflow_operator<
+                               _impl::convert_op, overflow_tag, _impl::polarity::positive>{}
+                        .template operator()<Destination>(from);
+            case _impl::polarity::negative:
+                return _impl::overflow_operator<
+                               _impl::convert_op, overflow_tag, _impl::polarity::negative>{}
+                        .template operator()<Destination>(from);
+            default:
+                return _impl::unreachable<Destination>("CNL internal error");
+            }
+        }
+    };
+
+    template<typename Source, tag SrcTag, typename Destination, tag DestTag>
+    requires((_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value) && !_impl::builtin_overflow_convert<Source, Destination>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, DestTag>> {
         using overflow_tag = _impl::common_overflow_tag_t<DestTag, SrcTag>;
 
         [[nodiscard]] constexpr auto operator()(Source const& from) const
@@ -79,7 +106,6 @@ namespace cnl {
         }
     };
 
-#if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
     template<_impl::binary_arithmetic_op Operator, typename Lhs, overflow_tag LhsTag, typename Rhs, overflow_tag RhsTag>
     requires _impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value struct custom_operator<Operator, op_value<Lhs, LhsTag>, op_value<Rhs, RhsTag>> {
         using result_type = _impl::op_result<Operator, Lhs, Rhs>;
@@ -105,7 +131,6 @@ namespace cnl {
             }
         }
     };
-#endif
 
     template<_impl::binary_arithmetic_op Operator, typename Lhs, overflow_tag LhsTag, typename Rhs, overflow_tag RhsTag>
     requires(!_impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value) struct custom_operator<Operator, op_value<Lhs, LhsTag>, op_value<Rhs, RhsTag>> {
@@ -7,12 +7,19 @@
 #if !defined(CNL_IMPL_OVERFLOW_SATURATED_H)
 #define CNL_IMPL_OVERFLOW_SATURATED_H
 
+#include "../custom_operator/definition.h"
+#include "../custom_operator/op.h"
+#include "../num_traits/digits.h"
 #include "../polarity.h"
+#include "builtin_overflow.h"
+#include "custom_operator.h"
+#include "is_overflow.h"
 #include "is_overflow_tag.h"
 #include "is_tag.h"
 #include "overflow_operator.h"
 
 #include <limits>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
@@ -63,7 +70,107 @@ namespace cnl {
                 return std::numeric_limits<op_result<Operator, Operands...>>::lowest();
             }
         };
+
+        // conversion between integers which clamps instead of branching on each polarity of overflow
+        template<typename Source, typename Destination>
+        struct saturated_convert_operator {
+            [[nodiscard]] constexpr auto operator()(Source const& from) const
+            {
+                // the limits of Destination, or of Source where they are narrower
+                constexpr auto max{
+                        overflow_digits<Destination, polarity::positive>::value
+                                        < overflow_digits<Source, polarity::positive>::value
+                                ? static_cast<Source>(std::numeric_limits<Destination>::max())
+                                : std::numeric_limits<Source>::max()};
+                constexpr auto lowest{
+                        overflow_digits<Destination, polarity::negative>::value
+                                        < overflow_digits<Source, polarity::negative>::value
+                                ? static_cast<Source>(std::numeric_limits<Destination>::lowest())
+                                : std::numeric_limits<Source>::lowest()};
+                return static_cast<Destination>((from > max) ? max : (from < lowest) ? lowest : from);
+            }
+        };
+
+        // arithmetic on integers of one type, which does not promote, and which selects the
+        // saturated value instead of branching on overflow; compilers emit conditional moves
+        // or, in loops, vector blends
+        template<typename Operator, typename Integer>
+        struct saturated_integer_operator : std::false_type {
+        };
+
+        template<typename Integer, typename Operator>
+        concept saturated_integer_operand = std::is_integral_v<Integer> && std::is_same_v<op_result<Operator, Integer, Integer>, Integer>;
+
+        // the saturated value with the sign of operand
+        template<typename Integer>
+        [[nodiscard]] constexpr auto saturated_value(Integer const& operand)
+        {
+            return static_cast<Integer>((operand >> digits_v<Integer>) ^ std::numeric_limits<Integer>::max());
+        }
+
+        template<saturated_integer_operand<add_op> Integer>
+        struct saturated_integer_operator<add_op, Integer> : std::true_type {
+            [[nodiscard]] constexpr auto operator()(Integer const& lhs, Integer const& rhs) const
+            {
+                using unsigned_integer = std::make_unsigned_t<Integer>;
+                auto const sum{static_cast<Integer>(
+                        static_cast<unsigned_integer>(static_cast<unsigned_integer>(lhs) + static_cast<unsigned_integer>(rhs)))};
+                if constexpr (std::is_signed_v<Integer>) {
+                    // operands which overflow have the same sign
+                    return (((lhs ^ sum) & (rhs ^ sum)) < 0) ? saturated_value(lhs) : sum;
+                } else {
+                    return (sum < lhs) ? std::numeric_limits<Integer>::max() : sum;
+                }
+            }
+        };
+
+        template<saturated_integer_operand<subtract_op> Integer>
+        struct saturated_integer_operator<subtract_op, Integer> : std::true_type {
+            [[nodiscard]] constexpr auto operator()(Integer const& lhs, Integer const& rhs) const
+            {
+                using unsigned_integer = std::make_unsigned_t<Integer>;
+                auto const difference{static_cast<Integer>(
+                        static_cast<unsigned_integer>(static_cast<unsigned_integer>(lhs) - static_cast<unsigned_integer>(rhs)))};
+                if constexpr (std::is_signed_v<Integer>) {
+                    // operands which overflow have different signs
+                    return (((lhs ^ rhs) & (lhs ^ difference)) < 0) ? saturated_value(lhs) : difference;
+                } else {
+                    return (lhs < rhs) ? Integer{0} : difference;
+                }
+            }
+        };
+
+        template<saturated_integer_operand<multiply_op> Integer>
+        requires builtin_overflow_operator<multiply_op, Integer, Integer>::value struct saturated_integer_operator<multiply_op, Integer> : std::true_type {
+            [[nodiscard]] constexpr auto operator()(Integer const& lhs, Integer const& rhs) const
+            {
+                auto product{Integer{}};
+                auto const overflowed{builtin_overflow_operator<multiply_op, Integer, Integer>{}(lhs, rhs, product)};
+                if constexpr (std::is_signed_v<Integer>) {
+                    return overflowed ? saturated_value(static_cast<Integer>(lhs ^ rhs)) : product;
+                } else {
+                    return overflowed ? std::numeric_limits<Integer>::max() : product;
+                }
+            }
+        };
     }
+
+    /// \cond
+    template<typename Source, tag SrcTag, typename Destination>
+    requires(std::is_integral_v<Source> && std::is_integral_v<Destination> && (!_impl::is_overflow_tag<SrcTag>::value || std::is_same_v<SrcTag, saturated_overflow_tag>)) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, saturated_overflow_tag>>
+        : _impl::saturated_convert_operator<Source, Destination> {
+    };
+
+    template<typename Source, typename Destination, tag DestTag>
+    requires(std::is_integral_v<Source> && std::is_integral_v<Destination> && !_impl::is_overflow_tag<DestTag>::value) struct custom_operator<_impl::convert_op, op_value<Source, saturated_overflow_tag>, op_value<Destination, DestTag>>
+        : _impl::saturated_convert_operator<Source, Destination> {
+    };
+
+    template<_impl::binary_arithmetic_op Operator, typename Integer>
+    requires _impl::saturated_integer_operator<Operator, Integer>::value struct custom_operator<Operator, op_value<Integer, saturated_overflow_tag>, op_value<Integer, saturated_overflow_tag>>
+        : _impl::saturated_integer_operator<Operator, Integer> {
+    };
+    /// \endcond
 }
 
 #endif  // CNL_IMPL_OVERFLOW_SATURATED_H
@@ -0,0 +1,197 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief addition and subtraction of sequences of saturated integers
+
+#if !defined(CNL_IMPL_OVERFLOW_SATURATED_SPAN_H)
+#define CNL_IMPL_OVERFLOW_SATURATED_SPAN_H
+
+#include "../cnl_assert.h"
+#include "../config.h"
+#include "../custom_operator/op.h"
+#include "../wrapper.h"
+#include "saturated.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#if defined(CNL_SIMD_SATURATE_ENABLED)
+#include <immintrin.h>
+#endif
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<typename Rep>
+        using saturated_integer = wrapper<Rep, saturated_overflow_tag>;
+
+#if defined(CNL_SIMD_SATURATE_ENABLED)
+        // true iff the target has saturating vector instructions for Rep
+        template<typename Rep>
+        inline constexpr auto is_saturated_vector_rep{
+                std::is_same_v<Rep, std::int8_t> || std::is_same_v<Rep, std::uint8_t>
+                || std::is_same_v<Rep, std::int16_t> || std::is_same_v<Rep, std::uint16_t>};
+
+#if defined(__AVX2__)
+        using saturated_vector = __m256i;
+
+        [[nodiscard]] inline auto load_saturated_vector(void const* source) -> saturated_vector
+        {
+            return _mm256_loadu_si256(static_cast<saturated_vector const*>(source));
+        }
+
+        inline void store_saturated_vector(void* destination, saturated_vector value)
+        {
+            _mm256_storeu_si256(static_cast<saturated_vector*>(destination), value);
+        }
+
+        // the element-wise sum or difference of lhs and rhs, each a vector of Rep values
+        template<class Operator, typename Rep>
+        [[nodiscard]] inline auto saturated_vector_operate(saturated_vector lhs, saturated_vector rhs)
+                -> saturated_vector
+        {
+            if constexpr (std::is_same_v<Operator, add_op>) {
+                if constexpr (std::is_same_v<Rep, std::int8_t>) {
+                    return _mm256_adds_epi8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::uint8_t>) {
+                    return _mm256_adds_epu8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::int16_t>) {
+                    return _mm256_adds_epi16(lhs, rhs);
+                } else {
+                    return _mm256_adds_epu16(lhs, rhs);
+                }
+            } else {
+                static_assert(std::is_same_v<Operator, subtract_op>);
+                if constexpr (std::is_same_v<Rep, std::int8_t>) {
+                    return _mm256_subs_epi8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::uint8_t>) {
+                    return _mm256_subs_epu8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::int16_t>) {
+                    return _mm256_subs_epi16(lhs, rhs);
+                } else {
+                    return _mm256_subs_epu16(lhs, rhs);
+                }
+            }
+        }
+#else
+        using saturated_vector = __m128i;
+
+        [[nodiscard]] inline auto load_saturated_vector(void const* source) -> saturated_vector
+        {
+            return _mm_loadu_si128(static_cast<saturated_vector const*>(source));
+        }
+
+        inline void store_saturated_vector(void* destination, saturated_vector value)
+        {
+            _mm_storeu_si128(static_cast<saturated_vector*>(destination), value);
+        }
+
+        // the element-wise sum or difference of lhs and rhs, each a vector of Rep values
+        template<class Operator, typename Rep>
+        [[nodiscard]] inline auto saturated_vector_operate(saturated_vector lhs, saturated_vector rhs)
+                -> saturated_vector
+        {
+            if constexpr (std::is_same_v<Operator, add_op>) {
+                if constexpr (std::is_same_v<Rep, std::int8_t>) {
+                    return _mm_adds_epi8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::uint8_t>) {
+                    return _mm_adds_epu8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::int16_t>) {
+                    return _mm_adds_epi16(lhs, rhs);
+                } else {
+                    return _mm_adds_epu16(lhs, rhs);
+                }
+            } else {
+                static_assert(std::is_same_v<Operator, subtract_op>);
+                if constexpr (std::is_same_v<Rep, std::int8_t>) {
+                    return _mm_subs_epi8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::uint8_t>) {
+                    return _mm_subs_epu8(lhs, rhs);
+                } else if constexpr (std::is_same_v<Rep, std::int16_t>) {
+                    return _mm_subs_epi16(lhs, rhs);
+                } else {
+                    return _mm_subs_epu16(lhs, rhs);
+                }
+            }
+        }
+#endif
+#endif
+
+        // applies Operator to corresponding elements of lhs and rhs, a vector of elements at a time
+        // where the target allows, and then one element at a time
+        template<class Operator, typename Rep>
+        constexpr void saturated_transform(
+                std::span<saturated_integer<Rep> const> lhs,
+                std::span<saturated_integer<Rep> const> rhs,
+                std::span<saturated_integer<Rep>> result)
+        {
+            CNL_ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+            auto index{std::size_t{0}};
+#if defined(CNL_SIMD_SATURATE_ENABLED)
+            if constexpr (is_saturated_vector_rep<Rep>) {
+                static_assert(sizeof(saturated_integer<Rep>) == sizeof(Rep));
+                if (!std::is_constant_evaluated()) {
+                    constexpr auto lanes{sizeof(saturated_vector) / sizeof(Rep)};
+                    for (; index + lanes <= result.size(); index += lanes) {
+                        store_saturated_vector(
+                                result.data() + index,
+                                saturated_vector_operate<Operator, Rep>(
+                                        load_saturated_vector(lhs.data() + index),
+                                        load_saturated_vector(rhs.data() + index)));
+                    }
+                }
+            }
+#endif
+            for (; index != result.size(); ++index) {
+                result[index] = saturated_integer<Rep>{Operator{}(lhs[index], rhs[index])};
+            }
+        }
+    }
+
+    /// \brief adds the corresponding elements of two sequences of saturated \ref overflow_integer values
+    /// \headerfile cnl/overflow_integer.h
+    ///
+    /// \param lhs, rhs addends
+    /// \param result sequence of sums with the same size as `lhs` and `rhs`; may be `lhs` or `rhs`
+    ///
+    /// \note Every result is identical to the corresponding sum converted to
+    /// `overflow_integer<Rep, saturated_overflow_tag>`.
+    /// Where \ref CNL_SIMD_SATURATE_ENABLED is defined, 8- and 16-bit integers are added
+    /// a vector at a time using saturating instructions, e.g. `paddsw`.
+    template<typename Rep, std::size_t LhsExtent, std::size_t RhsExtent, std::size_t ResultExtent>
+    constexpr void add(
+            std::span<_impl::wrapper<Rep, saturated_overflow_tag> const, LhsExtent> lhs,
+            std::span<_impl::wrapper<Rep, saturated_overflow_tag> const, RhsExtent> rhs,
+            std::span<_impl::wrapper<Rep, saturated_overflow_tag>, ResultExtent> result)
+    {
+        _impl::saturated_transform<_impl::add_op, Rep>(lhs, rhs, result);
+    }
+
+    /// \brief subtracts the corresponding elements of two sequences of saturated \ref overflow_integer values
+    /// \headerfile cnl/overflow_integer.h
+    ///
+    /// \param lhs minuends
+    /// \param rhs subtrahends
+    /// \param result sequence of differences with the same size as `lhs` and `rhs`; may be `lhs` or `rhs`
+    ///
+    /// \note Every result is identical to the corresponding difference converted to
+    /// `overflow_integer<Rep, saturated_overflow_tag>`.
+    /// Where \ref CNL_SIMD_SATURATE_ENABLED is defined, 8- and 16-bit integers are subtracted
+    /// a vector at a time using saturating instructions, e.g. `psubsw`.
+    template<typename Rep, std::size_t LhsExtent, std::size_t RhsExtent, std::size_t ResultExtent>
+    constexpr void subtract(
+            std::span<_impl::wrapper<Rep, saturated_overflow_tag> const, LhsExtent> lhs,
+            std::span<_impl::wrapper<Rep, saturated_overflow_tag> const, RhsExtent> rhs,
+            std::span<_impl::wrapper<Rep, saturated_overflow_tag>, ResultExtent> result)
+    {
+        _impl::saturated_transform<_impl::subtract_op, Rep>(lhs, rhs, result);
+    }
+}
+
+#endif  // CNL_IMPL_OVERFLOW_SATURATED_SPAN_H
@@ -0,0 +1,209 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_OVERFLOW_STICKY_H)
+#define CNL_IMPL_OVERFLOW_STICKY_H
+
+#include "../abort.h"
+#include "../custom_operator/definition.h"
+#include "../custom_operator/op.h"
+#include "../polarity.h"
+#include "builtin_overflow.h"
+#include "custom_operator.h"
+#include "is_overflow.h"
+#include "is_overflow_tag.h"
+#include "is_tag.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag to record overflow in arithmetic operations without changing their results
+    ///
+    /// Arithmetic operations using this tag return the same result as \ref native_overflow_tag.
+    /// When the result exceeds the range of the result type, a flag is raised which remains raised
+    /// until \ref clear_sticky_overflow is called. Thus, as with IEEE 754 exception flags,
+    /// a batch of operations can be checked for overflow once, after the last operation.
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \note The flag belongs to the calling thread.
+    /// Overflow during constant evaluation is a compile-time error.
+    /// \note Integer addition and subtraction results wrap, as do other results where the compiler
+    /// provides overflow-checking builtins; otherwise, overflowing operations on fundamental types
+    /// have undefined behavior.
+    /// \sa overflow_integer, convert, native_overflow_tag, saturated_overflow_tag,
+    /// test_sticky_overflow, clear_sticky_overflow, trapping_overflow_tag
+    struct sticky_overflow_tag
+        : _impl::homogeneous_deduction_tag_base
+        , _impl::homogeneous_operator_tag_base {
+    };
+
+    namespace _impl {
+        template<>
+        struct is_overflow_tag<sticky_overflow_tag> : std::true_type {
+        };
+
+        // the status word into which operations which use sticky_overflow_tag on this thread
+        // record overflow; a word, rather than a bool, lets loops of operations vectorize
+        inline auto sticky_overflow_status() noexcept -> unsigned&
+        {
+            thread_local unsigned status{0};
+            return status;
+        }
+
+        // raises the flag if overflowed; does not branch on overflowed at run-time
+        constexpr void raise_sticky_overflow(bool overflowed)
+        {
+            if (std::is_constant_evaluated()) {
+                if (overflowed) {
+                    abort<void>("overflow");
+                }
+            } else {
+                sticky_overflow_status() |= static_cast<unsigned>(overflowed);
+            }
+        }
+
+        // true iff either polarity of overflow is detected; both are evaluated to avoid branching
+        template<typename Operator, typename... Operands>
+        [[nodiscard]] constexpr auto is_either_overflow(Operands const&... operands)
+        {
+            return static_cast<bool>(
+                    static_cast<int>(is_overflow<Operator, polarity::positive>{}(operands...))
+                    | static_cast<int>(is_overflow<Operator, polarity::negative>{}(operands...)));
+        }
+
+        // integer addition and subtraction whose overflow is detected from the wrapped result;
+        // unlike __builtin_add_overflow, these expressions are vectorized by compilers
+        template<typename Operator, typename Lhs, typename Rhs>
+        struct sticky_wrapping_operator : std::false_type {
+        };
+
+        template<typename Integer>
+        requires(std::is_integral_v<Integer> && std::is_same_v<op_result<add_op, Integer, Integer>, Integer>) struct sticky_wrapping_operator<add_op, Integer, Integer> : std::true_type {
+            [[nodiscard]] constexpr auto operator()(Integer const& lhs, Integer const& rhs) const
+            {
+                using unsigned_integer = std::make_unsigned_t<Integer>;
+                auto const result{static_cast<Integer>(
+                        static_cast<unsigned_integer>(static_cast<unsigned_integer>(lhs) + static_cast<unsigned_integer>(rhs)))};
+                if constexpr (std::is_signed_v<Integer>) {
+                    raise_sticky_overflow(((lhs ^ result) & (rhs ^ result)) < 0);
+                } else {
+                    raise_sticky_overflow(result < lhs);
+                }
+                return result;
+            }
+        };
+
+        template<typename Integer>
+        requires(std::is_integral_v<Integer> && std::is_same_v<op_result<subtract_op, Integer, Integer>, Integer>) struct sticky_wrapping_operator<subtract_op, Integer, Integer> : std::true_type {
+            [[nodiscard]] constexpr auto operator()(Integer const& lhs, Integer const& rhs) const
+            {
+                using unsigned_integer = std::make_unsigned_t<Integer>;
+                auto const result{static_cast<Integer>(
+                        static_cast<unsigned_integer>(static_cast<unsigned_integer>(lhs) - static_cast<unsigned_integer>(rhs)))};
+                if constexpr (std::is_signed_v<Integer>) {
+                    raise_sticky_overflow(((lhs ^ rhs) & (lhs ^ result)) < 0);
+                } else {
+                    raise_sticky_overflow(lhs < rhs);
+                }
+                return result;
+            }
+        };
+    }
+
+    /// \brief tests whether any operation using \ref sticky_overflow_tag on this thread has
+    /// overflowed since the flag was last cleared
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \sa clear_sticky_overflow
+    [[nodiscard]] inline auto test_sticky_overflow() noexcept
+    {
+        return _impl::sticky_overflow_status() != 0;
+    }
+
+    /// \brief lowers the flag raised by overflowing operations which use \ref sticky_overflow_tag
+    /// on this thread
+    ///
+    /// \return true iff the flag was raised
+    /// \headerfile cnl/overflow.h
+    /// \sa test_sticky_overflow
+    inline auto clear_sticky_overflow() noexcept
+    {
+        auto& status{_impl::sticky_overflow_status()};
+        auto const raised{status != 0};
+        status = 0;
+        return raised;
+    }
+
+    namespace _impl {
+        template<typename Source, typename Destination>
+        struct sticky_convert_operator {
+            [[nodiscard]] constexpr auto operator()(Source const& from) const
+            {
+                raise_sticky_overflow(static_cast<bool>(
+                        static_cast<int>(is_overflow<convert_op, polarity::positive>{}
+                                                 .template operator()<Destination>(from))
+                        | static_cast<int>(is_overflow<convert_op, polarity::negative>{}
+                                                   .template operator()<Destination>(from))));
+                return static_cast<Destination>(from);
+            }
+        };
+    }
+
+    /// \cond
+    template<typename Source, tag SrcTag, typename Destination>
+    requires(!_impl::is_overflow_tag<SrcTag>::value || std::is_same_v<SrcTag, sticky_overflow_tag>) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, sticky_overflow_tag>>
+        : _impl::sticky_convert_operator<Source, Destination> {
+    };
+
+    template<typename Source, typename Destination, tag DestTag>
+    requires(!_impl::is_overflow_tag<DestTag>::value) struct custom_operator<_impl::convert_op, op_value<Source, sticky_overflow_tag>, op_value<Destination, DestTag>>
+        : _impl::sticky_convert_operator<Source, Destination> {
+    };
+
+    template<_impl::unary_arithmetic_op Operator, typename Operand>
+    struct custom_operator<Operator, op_value<Operand, sticky_overflow_tag>> {
+        [[nodiscard]] constexpr auto operator()(Operand const& rhs) const
+                -> _impl::op_result<Operator, Operand>
+        {
+            _impl::raise_sticky_overflow(_impl::is_either_overflow<Operator>(rhs));
+            return Operator{}(rhs);
+        }
+    };
+
+    template<_impl::binary_arithmetic_op Operator, typename Lhs, typename Rhs>
+    struct custom_operator<Operator, op_value<Lhs, sticky_overflow_tag>, op_value<Rhs, sticky_overflow_tag>> {
+        using result_type = _impl::op_result<Operator, Lhs, Rhs>;
+
+        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result_type
+        {
+            if constexpr (_impl::sticky_wrapping_operator<Operator, Lhs, Rhs>::value) {
+                return _impl::sticky_wrapping_operator<Operator, Lhs, Rhs>{}(lhs, rhs);
+            } else if constexpr (_impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value) {
+                result_type result{};
+                _impl::raise_sticky_overflow(
+                        _impl::builtin_overflow_operator<Operator, Lhs, Rhs>{}(lhs, rhs, result));
+                return result;
+            } else {
+                _impl::raise_sticky_overflow(_impl::is_either_overflow<Operator>(lhs, rhs));
+                return Operator{}(lhs, rhs);
+            }
+        }
+    };
+
+    template<_impl::shift_op Operator, typename Lhs, typename Rhs, tag RhsTag>
+    struct custom_operator<Operator, op_value<Lhs, sticky_overflow_tag>, op_value<Rhs, RhsTag>> {
+        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+                -> _impl::op_result<Operator, Lhs, Rhs>
+        {
+            _impl::raise_sticky_overflow(_impl::is_either_overflow<Operator>(lhs, rhs));
+            return Operator{}(lhs, rhs);
+        }
+    };
+    /// \endcond
+}
+
+#endif  // CNL_IMPL_OVERFLOW_STICKY_H
@@ -0,0 +1,161 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief access to bit fields stored back-to-back in an array of words
+
+#if !defined(CNL_IMPL_PACKED_BIT_FIELDS_H)
+#define CNL_IMPL_PACKED_BIT_FIELDS_H
+
+#include "../config.h"
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if defined(CNL_BMI2_ENABLED)
+#include <immintrin.h>
+#endif
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        inline constexpr int bit_field_word_digits{64};
+
+        // a word with the lowest width bits set
+        [[nodiscard]] constexpr auto low_bits(int width) -> std::uint64_t
+        {
+            return width == bit_field_word_digits ? ~std::uint64_t{} : (std::uint64_t{1} << width) - 1;
+        }
+
+        // number of words which hold size fields of the given width,
+        // plus a word of padding so that a field can be read from any two consecutive words
+        [[nodiscard]] constexpr auto bit_field_words(std::size_t size, int width) -> std::size_t
+        {
+            return (size * static_cast<std::size_t>(width) + bit_field_word_digits - 1) / bit_field_word_digits + 1;
+        }
+
+        // the Width-bit field which starts bit bits into words
+        template<int Width>
+        [[nodiscard]] constexpr auto load_bit_field(std::uint64_t const* words, std::size_t bit) -> std::uint64_t
+        {
+            auto const word{bit / bit_field_word_digits};
+            auto const shift{static_cast<int>(bit % bit_field_word_digits)};
+
+            // the high part is zero unless the field straddles two words
+            auto const low{words[word] >> shift};
+            auto const high{(words[word + 1] << 1) << (bit_field_word_digits - 1 - shift)};
+            return (low | high) & low_bits(Width);
+        }
+
+        // overwrites the Width-bit field which starts bit bits into words
+        template<int Width>
+        constexpr void store_bit_field(std::uint64_t* words, std::size_t bit, std::uint64_t field)
+        {
+            auto const word{bit / bit_field_word_digits};
+            auto const shift{static_cast<int>(bit % bit_field_word_digits)};
+            auto const high_shift{bit_field_word_digits - 1 - shift};
+            constexpr auto mask{low_bits(Width)};
+
+            // the high part is zero unless the field straddles two words
+            words[word] = (words[word] & ~(mask << shift)) | (field << shift);
+            words[word + 1] = (words[word + 1] & ~((mask >> 1) >> high_shift)) | ((field >> 1) >> high_shift);
+        }
+
+        // number of fields in a block, which occupies exactly Width words
+        inline constexpr int bit_field_block_size{bit_field_word_digits};
+
+        // calls visit(index, field) for each of the Width-bit fields held by the block which starts at words
+        template<int Width, class Visitor>
+        constexpr void visit_bit_field_block(std::uint64_t const* words, Visitor&& visit)
+        {
+            // each field is at a constant position so every shift is a constant
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                (visit(Index, load_bit_field<Width>(words, Index * Width)), ...);
+            }(std::make_index_sequence<bit_field_block_size>{});
+        }
+
+        // overwrites the block of Width-bit fields which starts at words with field(0), field(1), ...
+        template<int Width, class Generator>
+        constexpr void fill_bit_field_block(std::uint64_t* words, Generator&& field)
+        {
+            auto const store{[&]<std::size_t Index>(std::integral_constant<std::size_t, Index>) {
+                constexpr auto word{Index * Width / bit_field_word_digits};
+                constexpr auto shift{static_cast<int>(Index * Width % bit_field_word_digits)};
+                auto const value{field(Index)};
+                words[word] |= value << shift;
+                if constexpr (shift + Width > bit_field_word_digits) {
+                    words[word + 1] |= value >> (bit_field_word_digits - shift);
+                }
+            }};
+
+            std::fill_n(words, Width, std::uint64_t{});
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                (store(std::integral_constant<std::size_t, Index>{}), ...);
+            }(std::make_index_sequence<bit_field_block_size>{});
+        }
+
+        // describes how a group of consecutive Width-bit fields is spread into lanes of a single word
+        template<int Width>
+        struct bit_field_lanes {
+            // each field occupies the low bits of a lane
+            static constexpr int lane_width{static_cast<int>(std::bit_ceil(static_cast<unsigned>(Width)))};
+
+            // the group, plus up to CHAR_BIT-1 bits of misalignment, fits in one unaligned word
+            static constexpr int count{std::min(
+                    bit_field_word_digits / lane_width,
+                    (bit_field_word_digits - (CHAR_BIT - 1)) / Width)};
+
+            static constexpr bool enabled{count >= 2};
+
+            // the bits of each lane which hold a field
+            static constexpr auto mask{[]() {
+                auto lanes_mask{std::uint64_t{}};
+                for (auto lane{0}; lane != count; ++lane) {
+                    lanes_mask |= low_bits(Width) << (lane * lane_width);
+                }
+                return lanes_mask;
+            }()};
+        };
+
+#if defined(CNL_BMI2_ENABLED)
+        // the group of Width-bit fields which starts bit bits into bytes, one field per lane
+        template<int Width>
+        [[nodiscard]] inline auto load_bit_field_lanes(std::byte const* bytes, std::size_t bit) -> std::uint64_t
+        {
+            using lanes = bit_field_lanes<Width>;
+            static_assert(lanes::enabled);
+
+            auto fields{std::uint64_t{}};
+            std::memcpy(&fields, bytes + bit / CHAR_BIT, sizeof(fields));
+            return _pdep_u64(fields >> (bit % CHAR_BIT), lanes::mask);
+        }
+
+        // overwrites the group of Width-bit fields which starts bit bits into bytes with the fields in lanes
+        template<int Width>
+        inline void store_bit_field_lanes(std::byte* bytes, std::size_t bit, std::uint64_t lanes_fields)
+        {
+            using lanes = bit_field_lanes<Width>;
+            static_assert(lanes::enabled);
+
+            auto* const first{bytes + bit / CHAR_BIT};
+            auto const shift{static_cast<int>(bit % CHAR_BIT)};
+            constexpr auto group_mask{low_bits(lanes::count * Width)};
+
+            auto fields{std::uint64_t{}};
+            std::memcpy(&fields, first, sizeof(fields));
+            fields = (fields & ~(group_mask << shift)) | (_pext_u64(lanes_fields, lanes::mask) << shift);
+            std::memcpy(first, &fields, sizeof(fields));
+        }
+#endif
+    }
+}
+
+#endif  // CNL_IMPL_PACKED_BIT_FIELDS_H
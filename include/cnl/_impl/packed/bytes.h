@@ -0,0 +1,152 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief fixed-width binary encoding of numbers
+
+#if !defined(CNL_IMPL_PACKED_BYTES_H)
+#define CNL_IMPL_PACKED_BYTES_H
+
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "../numbers/signedness.h"
+#include "packed_size.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief result of \ref cnl::to_bytes and \ref cnl::to_varint
+    struct to_bytes_result {
+        /// one past the last byte written or, on failure, `last`
+        std::byte* ptr;
+
+        /// `std::errc{}` on success or `std::errc::value_too_large` if the encoding does not fit
+        std::errc ec;
+
+        friend constexpr auto operator==(to_bytes_result const&, to_bytes_result const&) -> bool = default;
+    };
+
+    /// \brief result of \ref cnl::from_bytes and \ref cnl::from_varint
+    struct from_bytes_result {
+        /// one past the last byte read or, on failure, the position of the error
+        std::byte const* ptr;
+
+        /// `std::errc{}` on success, `std::errc::invalid_argument` if the encoding is incomplete
+        /// or `std::errc::result_out_of_range` if the encoded value does not fit
+        std::errc ec;
+
+        friend constexpr auto operator==(from_bytes_result const&, from_bytes_result const&) -> bool = default;
+    };
+
+    namespace _impl {
+        // true iff rep has no significant digits beyond those of Number
+        template<typename Number, typename Rep>
+        [[nodiscard]] constexpr auto packed_in_range(Rep const& rep)
+        {
+            if constexpr (digits_v<Number> < digits_v<Rep>) {
+                auto const excess{rep >> digits_v<Number>};
+                if constexpr (numbers::signedness_v<Number>) {
+                    return excess == Rep{0} || excess == Rep{-1};
+                } else {
+                    return excess == Rep{0};
+                }
+            } else {
+                return true;
+            }
+        }
+    }
+
+    namespace _impl {
+        // the representation whose Size least significant bytes are at first
+        template<typename Rep, int Size, bool IsSigned>
+        [[nodiscard]] constexpr auto packed_rep_from_bytes(std::byte const* first)
+        {
+            if constexpr (std::is_integral_v<Rep> && sizeof(Rep) == Size && std::endian::native == std::endian::little) {
+                // load the whole representation at once
+                std::array<std::byte, Size> rep_bytes{};
+                std::copy_n(first, Size, rep_bytes.begin());
+                return std::bit_cast<Rep>(rep_bytes);
+            } else {
+                // sign-extend from the most significant byte
+                auto const most_significant{std::to_integer<unsigned char>(first[Size - 1])};
+                auto rep{
+                        IsSigned ? static_cast<Rep>(static_cast<signed char>(most_significant))
+                                 : static_cast<Rep>(most_significant)};
+                for (auto index{Size - 2}; index >= 0; --index) {
+                    rep = static_cast<Rep>(
+                            (rep << CHAR_BIT) | static_cast<Rep>(std::to_integer<unsigned char>(first[index])));
+                }
+                return rep;
+            }
+        }
+    }
+
+    /// \brief writes the binary encoding of a number
+    /// \headerfile cnl/packed.h
+    ///
+    /// \param first beginning of the destination
+    /// \param last end of the destination
+    /// \param value number to encode
+    ///
+    /// \note Exactly \ref cnl::packed_size_v bytes are written, least significant first,
+    /// regardless of the endianness of the target.
+    /// Only the value's representation is encoded; its type must be known to the reader.
+    /// \return a \ref cnl::to_bytes_result with the same semantics as the result of std::to_chars
+    template<typename Number>
+    [[nodiscard]] constexpr auto to_bytes(std::byte* const first, std::byte* const last, Number const& value)
+    {
+        constexpr auto size{packed_size_v<Number>};
+        if (last - first < size) {
+            return to_bytes_result{last, std::errc::value_too_large};
+        }
+
+        auto rep{unwrap(value)};
+        for (auto index{0}; index != size - 1; ++index) {
+            first[index] = static_cast<std::byte>(static_cast<unsigned char>(rep));
+            rep >>= CHAR_BIT;
+        }
+        first[size - 1] = static_cast<std::byte>(static_cast<unsigned char>(rep));
+
+        return to_bytes_result{first + size, std::errc{}};
+    }
+
+    /// \brief reads the binary encoding of a number written by \ref cnl::to_bytes
+    /// \headerfile cnl/packed.h
+    ///
+    /// \param first beginning of the encoding
+    /// \param last end of the available bytes
+    /// \param value number to which the result is assigned on success
+    ///
+    /// \return a \ref cnl::from_bytes_result with the same semantics as the result of std::from_chars
+    template<typename Number>
+    [[nodiscard]] constexpr auto from_bytes(std::byte const* const first, std::byte const* const last, Number& value)
+    {
+        constexpr auto size{packed_size_v<Number>};
+        if (last - first < size) {
+            return from_bytes_result{first, std::errc::invalid_argument};
+        }
+
+        using rep = _impl::packed_rep_t<Number>;
+        auto const bits{_impl::packed_rep_from_bytes<rep, size, numbers::signedness_v<Number>>(first)};
+
+        if (!_impl::packed_in_range<Number>(bits)) {
+            return from_bytes_result{first + size, std::errc::result_out_of_range};
+        }
+
+        value = wrap<Number>(bits);
+        return from_bytes_result{first + size, std::errc{}};
+    }
+}
+
+#endif  // CNL_IMPL_PACKED_BYTES_H
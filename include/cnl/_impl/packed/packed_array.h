@@ -0,0 +1,433 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::packed_array definition
+
+#if !defined(CNL_IMPL_PACKED_PACKED_ARRAY_H)
+#define CNL_IMPL_PACKED_PACKED_ARRAY_H
+
+#include "../cnl_assert.h"
+#include "../config.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "../numbers/signedness.h"
+#include "bit_fields.h"
+#include "packed_size.h"
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // number types whose every value fits in a single word of bit fields
+        template<typename Number>
+        concept bit_packable = std::integral<packed_rep_t<Number>> && packed_width_v<Number> <= bit_field_word_digits;
+
+        // the two's complement bits of value, truncated to the width in which it is packed
+        template<typename Number>
+        [[nodiscard]] constexpr auto to_bit_field(Number const& value) -> std::uint64_t
+        {
+            return static_cast<std::uint64_t>(cnl::unwrap(value)) & low_bits(packed_width_v<Number>);
+        }
+
+        // the number whose packed bits are the low bits of field
+        template<typename Number>
+        [[nodiscard]] constexpr auto from_bit_field(std::uint64_t field) -> Number
+        {
+            constexpr auto width{packed_width_v<Number>};
+            using rep = packed_rep_t<Number>;
+            auto const bits{field & low_bits(width)};
+            if constexpr (numbers::signedness_v<Number>) {
+                auto const sign{std::uint64_t{1} << (width - 1)};
+                return cnl::wrap<Number>(static_cast<rep>(static_cast<std::int64_t>((bits ^ sign) - sign)));
+            } else {
+                return cnl::wrap<Number>(static_cast<rep>(bits));
+            }
+        }
+    }
+
+    /// \brief resizable sequence of numbers, each stored in exactly as many bits as it needs
+    /// \headerfile cnl/packed.h
+    ///
+    /// \tparam Number type of the elements, e.g. `elastic_integer<12>` or
+    /// `scaled_integer<elastic_integer<12>, power<-8>>`
+    ///
+    /// \note Each element occupies \ref cnl::packed_width_v bits, e.g. 13 bits for `elastic_integer<12>`,
+    /// so that elements may straddle bytes and words.
+    /// Elements are accessed through proxy references;
+    /// \ref unpack and \ref pack transfer runs of elements more quickly,
+    /// 64 elements, i.e. a whole number of words, at a time.
+    /// Shorter runs use the BMI2 `pdep` and `pext` instructions where \ref CNL_BMI2_ENABLED is defined.
+    ///
+    /// \sa packed_view
+    template<_impl::bit_packable Number>
+    class packed_array {
+    public:
+        using value_type = Number;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        /// number of bits in which each element is stored
+        static constexpr auto element_width{packed_width_v<Number>};
+
+        /// \brief proxy for a single element of a \ref cnl::packed_array
+        class reference {
+        public:
+            constexpr reference(std::uint64_t* words, size_type index)
+                : _words(words)
+                , _bit(index * element_width)
+            {
+            }
+
+            reference(reference const&) = default;
+
+            constexpr auto operator=(reference const& rhs) const -> reference const&
+            {
+                _impl::store_bit_field<element_width>(
+                        _words, _bit, _impl::load_bit_field<element_width>(rhs._words, rhs._bit));
+                return *this;
+            }
+
+            constexpr auto operator=(Number const& value) const -> reference const&
+            {
+                _impl::store_bit_field<element_width>(_words, _bit, _impl::to_bit_field(value));
+                return *this;
+            }
+
+            // NOLINTNEXTLINE(hicpp-explicit-conversions)
+            [[nodiscard]] constexpr operator Number() const
+            {
+                return _impl::from_bit_field<Number>(_impl::load_bit_field<element_width>(_words, _bit));
+            }
+
+        private:
+            std::uint64_t* _words;
+            size_type _bit;
+        };
+
+    private:
+        template<bool IsConst>
+        class basic_iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Number;
+            using difference_type = std::ptrdiff_t;
+
+            using words_pointer = std::conditional_t<IsConst, std::uint64_t const*, std::uint64_t*>;
+
+            basic_iterator() = default;
+
+            constexpr basic_iterator(words_pointer words, size_type index)
+                : _words(words)
+                , _index(index)
+            {
+            }
+
+            // NOLINTNEXTLINE(hicpp-explicit-conversions)
+            template<bool OtherIsConst>
+            requires(IsConst && !OtherIsConst) constexpr basic_iterator(basic_iterator<OtherIsConst> const& other)
+                : _words(other._words)
+                , _index(other._index)
+            {
+            }
+
+            [[nodiscard]] constexpr auto operator*() const
+            {
+                if constexpr (IsConst) {
+                    return value();
+                } else {
+                    return reference{_words, _index};
+                }
+            }
+
+            // moves a value out of the element, rather than a proxy
+            [[nodiscard]] friend constexpr auto iter_move(basic_iterator const& i) -> Number
+            {
+                return i.value();
+            }
+
+            [[nodiscard]] constexpr auto operator[](difference_type n) const
+            {
+                return *(*this + n);
+            }
+
+            constexpr auto operator++() -> basic_iterator&
+            {
+                ++_index;
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> basic_iterator
+            {
+                auto const previous{*this};
+                ++*this;
+                return previous;
+            }
+
+            constexpr auto operator--() -> basic_iterator&
+            {
+                --_index;
+                return *this;
+            }
+
+            constexpr auto operator--(int) -> basic_iterator
+            {
+                auto const previous{*this};
+                --*this;
+                return previous;
+            }
+
+            constexpr auto operator+=(difference_type n) -> basic_iterator&
+            {
+                _index += static_cast<size_type>(n);
+                return *this;
+            }
+
+            constexpr auto operator-=(difference_type n) -> basic_iterator&
+            {
+                _index -= static_cast<size_type>(n);
+                return *this;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(basic_iterator i, difference_type n)
+            {
+                return i += n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(difference_type n, basic_iterator i)
+            {
+                return i += n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(basic_iterator i, difference_type n)
+            {
+                return i -= n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(basic_iterator const& lhs, basic_iterator const& rhs)
+                    -> difference_type
+            {
+                return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+            }
+
+            [[nodiscard]] friend constexpr auto operator==(basic_iterator const&, basic_iterator const&)
+                    -> bool = default;
+            [[nodiscard]] friend constexpr auto operator<=>(basic_iterator const&, basic_iterator const&) = default;
+
+        private:
+            friend class basic_iterator<true>;
+
+            [[nodiscard]] constexpr auto value() const -> Number
+            {
+                return _impl::from_bit_field<Number>(
+                        _impl::load_bit_field<element_width>(_words, _index * element_width));
+            }
+
+            words_pointer _words = nullptr;
+            size_type _index = 0;
+        };
+
+    public:
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        packed_array() = default;
+
+        /// creates an array of the given number of zero-valued elements
+        explicit constexpr packed_array(size_type size)
+            : _words(_impl::bit_field_words(size, element_width))
+            , _size(size)
+        {
+        }
+
+        /// creates an array holding copies of the given elements
+        explicit constexpr packed_array(std::span<Number const> elements)
+            : packed_array(elements.size())
+        {
+            pack(0, elements);
+        }
+
+        [[nodiscard]] constexpr auto size() const
+        {
+            return _size;
+        }
+
+        [[nodiscard]] constexpr auto empty() const
+        {
+            return _size == 0;
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type index)
+        {
+            CNL_ASSERT(index < _size);
+            return reference{_words.data(), index};
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type index) const
+        {
+            CNL_ASSERT(index < _size);
+            return _impl::from_bit_field<Number>(
+                    _impl::load_bit_field<element_width>(_words.data(), index * element_width));
+        }
+
+        [[nodiscard]] constexpr auto begin()
+        {
+            return iterator{_words.data(), 0};
+        }
+
+        [[nodiscard]] constexpr auto begin() const
+        {
+            return const_iterator{_words.data(), 0};
+        }
+
+        [[nodiscard]] constexpr auto end()
+        {
+            return iterator{_words.data(), _size};
+        }
+
+        [[nodiscard]] constexpr auto end() const
+        {
+            return const_iterator{_words.data(), _size};
+        }
+
+        /// \brief the words in which the elements are stored, least significant bits first
+        [[nodiscard]] constexpr auto words() const
+        {
+            return std::span<std::uint64_t const>{_words};
+        }
+
+        /// \brief copies a run of elements out of the array
+        ///
+        /// \param first index of the first element to copy
+        /// \param destination receives elements `first` to `first + destination.size()`
+        constexpr void unpack(size_type first, std::span<Number> destination) const
+        {
+            CNL_ASSERT(first <= _size && destination.size() <= _size - first);
+
+            auto index{head_size(first, destination.size())};
+            for (auto head_index{size_type{0}}; head_index != index; ++head_index) {
+                destination[head_index] = (*this)[first + head_index];
+            }
+
+            for (; destination.size() - index >= block_size && has_block_words(first + index); index += block_size) {
+                _impl::visit_bit_field_block<element_width>(
+                        block_words(first + index), [&](std::size_t lane, std::uint64_t field) {
+                            destination[index + lane] = _impl::from_bit_field<Number>(field);
+                        });
+            }
+
+#if defined(CNL_BMI2_ENABLED)
+            using lanes = _impl::bit_field_lanes<element_width>;
+            if constexpr (lanes::enabled) {
+                if (!std::is_constant_evaluated()) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                    auto const* const bytes{reinterpret_cast<std::byte const*>(_words.data())};
+                    for (; destination.size() - index >= lanes::count; index += lanes::count) {
+                        auto const fields{_impl::load_bit_field_lanes<element_width>(
+                                bytes, (first + index) * element_width)};
+                        for (auto lane{0}; lane != lanes::count; ++lane) {
+                            destination[index + lane] =
+                                    _impl::from_bit_field<Number>(fields >> (lane * lanes::lane_width));
+                        }
+                    }
+                }
+            }
+#endif
+            for (; index != destination.size(); ++index) {
+                destination[index] = (*this)[first + index];
+            }
+        }
+
+        /// \brief overwrites a run of elements of the array
+        ///
+        /// \param first index of the first element to overwrite
+        /// \param source values of elements `first` to `first + source.size()`
+        constexpr void pack(size_type first, std::span<Number const> source)
+        {
+            CNL_ASSERT(first <= _size && source.size() <= _size - first);
+
+            auto index{head_size(first, source.size())};
+            for (auto head_index{size_type{0}}; head_index != index; ++head_index) {
+                (*this)[first + head_index] = source[head_index];
+            }
+
+            for (; source.size() - index >= block_size && has_block_words(first + index); index += block_size) {
+                _impl::fill_bit_field_block<element_width>(block_words(first + index), [&](std::size_t lane) {
+                    return _impl::to_bit_field(source[index + lane]);
+                });
+            }
+
+#if defined(CNL_BMI2_ENABLED)
+            using lanes = _impl::bit_field_lanes<element_width>;
+            if constexpr (lanes::enabled) {
+                if (!std::is_constant_evaluated()) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                    auto* const bytes{reinterpret_cast<std::byte*>(_words.data())};
+                    for (; source.size() - index >= lanes::count; index += lanes::count) {
+                        auto fields{std::uint64_t{}};
+                        for (auto lane{0}; lane != lanes::count; ++lane) {
+                            fields |= _impl::to_bit_field(source[index + lane]) << (lane * lanes::lane_width);
+                        }
+                        _impl::store_bit_field_lanes<element_width>(bytes, (first + index) * element_width, fields);
+                    }
+                }
+            }
+#endif
+            for (; index != source.size(); ++index) {
+                (*this)[first + index] = source[index];
+            }
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(packed_array const& lhs, packed_array const& rhs) -> bool
+        {
+            // bits beyond the last element are never set
+            return lhs._size == rhs._size && lhs._words == rhs._words;
+        }
+
+    private:
+        static constexpr auto block_size{size_type{_impl::bit_field_block_size}};
+
+        // number of elements of the run, [first, first + size), which precede the first whole block
+        [[nodiscard]] static constexpr auto head_size(size_type first, size_type size)
+        {
+            return std::min(size, (block_size - first % block_size) % block_size);
+        }
+
+        // true iff all the words of the block which starts with element, first, are stored;
+        // implied by the block's elements being stored but spelled out so that the compiler can
+        // see that whole-block accesses stay within the words
+        [[nodiscard]] constexpr auto has_block_words(size_type first) const
+        {
+            return first / block_size * element_width + element_width <= _words.size();
+        }
+
+        // the words of the block which starts with element, first
+        [[nodiscard]] constexpr auto block_words(size_type first)
+        {
+            return _words.data() + first / block_size * element_width;
+        }
+
+        [[nodiscard]] constexpr auto block_words(size_type first) const
+        {
+            return _words.data() + first / block_size * element_width;
+        }
+
+        std::vector<std::uint64_t> _words = std::vector<std::uint64_t>(1);
+        size_type _size = 0;
+    };
+}
+
+#endif  // CNL_IMPL_PACKED_PACKED_ARRAY_H
@@ -0,0 +1,45 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::packed_size_v definition
+
+#if !defined(CNL_IMPL_PACKED_PACKED_SIZE_H)
+#define CNL_IMPL_PACKED_PACKED_SIZE_H
+
+#include "../num_traits/digits.h"
+#include "../num_traits/unwrap.h"
+#include "../numbers/signedness.h"
+
+#include <climits>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief number of bytes in the binary encoding of the given number type
+    ///
+    /// \note the encoding is the two's complement representation of the number's
+    /// innermost integer, least significant byte first, truncated to the fewest bytes
+    /// which hold every digit and the sign bit, e.g. 2 bytes for `elastic_integer<10>`
+    ///
+    /// \sa to_bytes, from_bytes, packed_view
+    template<typename Number>
+    inline constexpr int packed_size_v = (digits_v<Number> + numbers::signedness_v<Number> + CHAR_BIT - 1) / CHAR_BIT;
+
+    /// \brief number of bits in which \ref cnl::packed_array stores each element of the given number type
+    ///
+    /// \note every digit and the sign bit, e.g. 11 bits for `elastic_integer<10>`
+    template<typename Number>
+    inline constexpr int packed_width_v = digits_v<Number> + numbers::signedness_v<Number>;
+
+    namespace _impl {
+        // the innermost integer of Number, e.g. int for scaled_integer<elastic_integer<10>>
+        template<typename Number>
+        using packed_rep_t = std::remove_cvref_t<decltype(cnl::unwrap(std::declval<Number>()))>;
+    }
+}
+
+#endif  // CNL_IMPL_PACKED_PACKED_SIZE_H
@@ -0,0 +1,182 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::packed_view definition
+
+#if !defined(CNL_IMPL_PACKED_PACKED_VIEW_H)
+#define CNL_IMPL_PACKED_PACKED_VIEW_H
+
+#include "../cnl_assert.h"
+#include "bytes.h"
+#include "packed_size.h"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief read-only random-access range of numbers encoded back-to-back by \ref cnl::to_bytes
+    /// \headerfile cnl/packed.h
+    ///
+    /// \tparam Number type of the elements
+    ///
+    /// \note The bytes are not copied, e.g. they may belong to a memory-mapped file,
+    /// and need not be aligned. Elements are decoded when they are accessed.
+    /// Trailing bytes which do not make up a whole element are ignored.
+    ///
+    /// \pre Every element accessed through an iterator holds a value of `Number`,
+    /// as written by \ref cnl::to_bytes; use \ref read to decode bytes which may not.
+    template<typename Number>
+    class packed_view : public std::ranges::view_interface<packed_view<Number>> {
+    public:
+        static constexpr auto element_size{packed_size_v<Number>};
+
+        class iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Number;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            explicit constexpr iterator(std::byte const* ptr)
+                : _ptr(ptr)
+            {
+            }
+
+            /// \pre the element holds a value of `Number`
+            [[nodiscard]] constexpr auto operator*() const
+            {
+                auto element{Number{}};
+                [[maybe_unused]] auto const result{from_bytes(_ptr, _ptr + element_size, element)};
+                CNL_ASSERT(result.ec == std::errc{});
+                return element;
+            }
+
+            [[nodiscard]] constexpr auto operator[](difference_type n) const
+            {
+                return *(*this + n);
+            }
+
+            constexpr auto operator++() -> iterator&
+            {
+                _ptr += element_size;
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> iterator
+            {
+                auto const previous{*this};
+                ++*this;
+                return previous;
+            }
+
+            constexpr auto operator--() -> iterator&
+            {
+                _ptr -= element_size;
+                return *this;
+            }
+
+            constexpr auto operator--(int) -> iterator
+            {
+                auto const previous{*this};
+                --*this;
+                return previous;
+            }
+
+            constexpr auto operator+=(difference_type n) -> iterator&
+            {
+                _ptr += n * element_size;
+                return *this;
+            }
+
+            constexpr auto operator-=(difference_type n) -> iterator&
+            {
+                _ptr -= n * element_size;
+                return *this;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(iterator i, difference_type n)
+            {
+                return i += n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(difference_type n, iterator i)
+            {
+                return i += n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(iterator i, difference_type n)
+            {
+                return i -= n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(iterator const& lhs, iterator const& rhs) -> difference_type
+            {
+                return (lhs._ptr - rhs._ptr) / element_size;
+            }
+
+            [[nodiscard]] friend constexpr auto operator==(iterator const&, iterator const&) -> bool = default;
+            [[nodiscard]] friend constexpr auto operator<=>(iterator const&, iterator const&) = default;
+
+        private:
+            std::byte const* _ptr = nullptr;
+        };
+
+        packed_view() = default;
+
+        /// views the whole elements at the start of the given bytes
+        explicit constexpr packed_view(std::span<std::byte const> bytes)
+            : _first(bytes.data())
+            , _size(static_cast<std::ptrdiff_t>(bytes.size()) / element_size)
+        {
+        }
+
+        [[nodiscard]] constexpr auto begin() const
+        {
+            return iterator{_first};
+        }
+
+        [[nodiscard]] constexpr auto end() const
+        {
+            return iterator{_first + _size * element_size};
+        }
+
+        [[nodiscard]] constexpr auto size() const
+        {
+            return static_cast<std::size_t>(_size);
+        }
+
+        /// \brief decodes an element, checking that its value fits in `Number`
+        ///
+        /// \param index position of the element; must be less than \ref size
+        /// \param value number to which the element is assigned on success
+        ///
+        /// \return the result of \ref cnl::from_bytes for the element's bytes
+        [[nodiscard]] constexpr auto read(std::size_t index, Number& value) const
+        {
+            CNL_ASSERT(index < size());
+            auto const* const element_first{_first + static_cast<std::ptrdiff_t>(index) * element_size};
+            return from_bytes(element_first, element_first + element_size, value);
+        }
+
+    private:
+        std::byte const* _first = nullptr;
+        std::ptrdiff_t _size = 0;
+    };
+}
+
+/// \cond
+template<typename Number>
+inline constexpr bool std::ranges::enable_borrowed_range<cnl::packed_view<Number>> = true;
+/// \endcond
+
+#endif  // CNL_IMPL_PACKED_PACKED_VIEW_H
@@ -0,0 +1,127 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief variable-width binary encoding of numbers
+
+#if !defined(CNL_IMPL_PACKED_VARINT_H)
+#define CNL_IMPL_PACKED_VARINT_H
+
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "../numbers/signedness.h"
+#include "bytes.h"
+#include "packed_size.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // maps signed values to unsigned values so that small magnitudes have few digits:
+        // 0, -1, 1, -2, 2, ... -> 0, 1, 2, 3, 4, ...
+        [[nodiscard]] constexpr auto zigzag_encode(std::int64_t value)
+        {
+            return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+        }
+
+        [[nodiscard]] constexpr auto zigzag_decode(std::uint64_t bits)
+        {
+            return static_cast<std::int64_t>(bits >> 1) ^ -static_cast<std::int64_t>(bits & 1);
+        }
+
+        template<typename Number>
+        concept varint_packable = packed_size_v<Number> <= 8;
+    }
+
+    /// \brief writes the variable-width binary encoding of a number
+    /// \headerfile cnl/packed.h
+    ///
+    /// \param first beginning of the destination
+    /// \param last end of the destination
+    /// \param value number to encode
+    ///
+    /// \note The encoding is LEB128: seven bits per byte, least significant first,
+    /// with the top bit of each byte set if another byte follows.
+    /// Signed values are zigzag-encoded first so that small magnitudes take few bytes.
+    /// A value takes between one and ten bytes and is typically shorter than \ref cnl::to_bytes
+    /// when it uses only a small fraction of its type's digits.
+    /// \return a \ref cnl::to_bytes_result with the same semantics as the result of std::to_chars
+    template<_impl::varint_packable Number>
+    [[nodiscard]] constexpr auto to_varint(std::byte* const first, std::byte* const last, Number const& value)
+    {
+        auto const rep{unwrap(value)};
+        auto bits{
+                numbers::signedness_v<Number>
+                        ? _impl::zigzag_encode(static_cast<std::int64_t>(rep))
+                        : static_cast<std::uint64_t>(rep)};
+
+        auto out{first};
+        do {
+            if (out == last) {
+                return to_bytes_result{last, std::errc::value_too_large};
+            }
+            auto const low_bits{static_cast<unsigned char>(bits & 0x7f)};
+            bits >>= 7;
+            *out++ = static_cast<std::byte>(bits ? low_bits | 0x80 : low_bits);
+        } while (bits);
+
+        return to_bytes_result{out, std::errc{}};
+    }
+
+    /// \brief reads the variable-width binary encoding of a number written by \ref cnl::to_varint
+    /// \headerfile cnl/packed.h
+    ///
+    /// \param first beginning of the encoding
+    /// \param last end of the available bytes
+    /// \param value number to which the result is assigned on success
+    ///
+    /// \return a \ref cnl::from_bytes_result with the same semantics as the result of std::from_chars
+    template<_impl::varint_packable Number>
+    [[nodiscard]] constexpr auto from_varint(std::byte const* const first, std::byte const* const last, Number& value)
+    {
+        auto bits{std::uint64_t{0}};
+        auto overflow{false};
+        auto in{first};
+        for (auto shift{0};; shift += 7) {
+            if (in == last) {
+                return from_bytes_result{first, std::errc::invalid_argument};
+            }
+
+            auto const byte{std::to_integer<std::uint64_t>(*in++)};
+            auto const payload{byte & 0x7f};
+            if (shift < 64) {
+                bits |= payload << shift;
+                overflow |= shift && (payload >> (64 - shift));
+            } else {
+                overflow |= payload != 0;
+            }
+
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+
+        using rep = _impl::packed_rep_t<Number>;
+        if constexpr (numbers::signedness_v<Number>) {
+            auto const decoded{_impl::zigzag_decode(bits)};
+            if (overflow || !_impl::packed_in_range<Number>(decoded)) {
+                return from_bytes_result{in, std::errc::result_out_of_range};
+            }
+            value = wrap<Number>(static_cast<rep>(decoded));
+        } else {
+            if (overflow || !_impl::packed_in_range<Number>(bits)) {
+                return from_bytes_result{in, std::errc::result_out_of_range};
+            }
+            value = wrap<Number>(static_cast<rep>(bits));
+        }
+
+        return from_bytes_result{in, std::errc{}};
+    }
+}
+
+#endif  // CNL_IMPL_PACKED_VARINT_H
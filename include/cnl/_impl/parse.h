@@ -8,6 +8,7 @@
 #define CNL_IMPL_PARSE_H
 
 #include "charconv/constants.h"
+#include "charconv/parse_digits.h"
 #include "charconv/descale.h"
 #include "cnl_assert.h"
 #include "config.h"
@@ -20,6 +21,7 @@
 #include <algorithm>
 #include <cstring>
 #include <numeric>
+#include <type_traits>
 #include <tuple>
 #include <utility>
 
@@ -252,16 +254,41 @@ namespace cnl {
         ////////////////////////////////////////////////////////////////////////////////
         // parse_string
 
+        // accumulates blocks of BlockDigits decimal digits into sum for as long as n digits remain to be parsed
+        // and the next BlockDigits characters are all digits
+        template<int BlockDigits>
+        inline void parse_int64_blocks(char const*& first, int& n, std::int64_t& sum, bool is_negative)
+        {
+            constexpr auto block_base{BlockDigits == 8 ? std::int64_t{100'000'000} : std::int64_t{10'000'000'000'000'000}};
+            while (n >= BlockDigits) {
+                auto const block{parse_decimal_block<BlockDigits>(first)};
+                if (!block) {
+                    return;
+                }
+                auto const value{static_cast<std::int64_t>(*block)};
+                sum = sum * block_base + (is_negative ? -value : value);
+                first += BlockDigits;
+                n -= BlockDigits;
+            }
+        }
+
         template<typename Result>
         [[nodiscard]] constexpr auto parse_string(
                 char const* first, int num_digits, bool is_negative, int base, int stride)
         {
-            auto const parse_int64 = [&num_digits, &first,
+            auto const parse_int64 = [&num_digits, &first, is_negative, base,
                                       char_to_digit = make_char_to_digit(is_negative, base),
                                       scale_op = make_scale_op(base)](int n) {
                 std::int64_t init{};
                 num_digits -= n;
                 CNL_ASSERT(num_digits >= 0);
+                if constexpr (swar_parse_enabled) {
+                    // at run time, uninterrupted runs of decimal digits are parsed a block at a time
+                    if (base == 10 && !std::is_constant_evaluated()) {
+                        parse_int64_blocks<16>(first, n, init, is_negative);
+                        parse_int64_blocks<8>(first, n, init, is_negative);
+                    }
+                }
                 while (n) {
                     auto const digit{*first++};
                     CNL_ASSERT(digit);
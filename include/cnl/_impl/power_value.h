@@ -11,6 +11,7 @@
 #include "narrow_cast.h"
 #include "num_traits/digits.h"
 #include "num_traits/from_value.h"
+#include "radix_powers.h"
 
 #include <limits>
 #include <type_traits>
@@ -58,7 +59,26 @@ namespace cnl {
         struct power_value_fn<S, Exponent, Radix, true, OddExponent, false> {
             [[nodiscard]] constexpr auto operator()() const
             {
-                return power_value_fn<S, (Exponent - 1), Radix>{}() * Radix;
+                if constexpr (is_tabulated()) {
+                    return static_cast<result_type>(radix_powers<radix_power_word, Radix>[Exponent]);
+                } else {
+                    return power_value_fn<S, (Exponent - 1), Radix>{}() * Radix;
+                }
+            }
+
+        private:
+            // same type as the product of the recursive case, e.g. int for short
+            using result_type = decltype(std::declval<S>() * Radix);
+
+            // true iff the result can be read from a table, rather than calculated recursively
+            [[nodiscard]] static constexpr auto is_tabulated()
+            {
+                if constexpr (std::is_integral_v<S> && is_tabulated_radix_power<Exponent, Radix>) {
+                    return radix_powers<radix_power_word, Radix>[Exponent]
+                        <= static_cast<radix_power_word>(std::numeric_limits<result_type>::max());
+                } else {
+                    return false;
+                }
             }
         };
 
@@ -0,0 +1,57 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tables of the powers of a radix, generated at compile time
+
+#if !defined(CNL_IMPL_RADIX_POWERS_H)
+#define CNL_IMPL_RADIX_POWERS_H
+
+#include "cstdint/types.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/// compositional numeric library
+namespace cnl::_impl {
+    // the number of powers of Radix, i.e. Radix^0, Radix^1, ..., which are representable in Unsigned
+    template<typename Unsigned, int Radix>
+    inline constexpr auto num_radix_powers{[]() {
+        static_assert(Radix > 1);
+        auto const radix{static_cast<Unsigned>(Radix)};
+        auto count{1};
+        for (auto power{Unsigned{1}}; power <= std::numeric_limits<Unsigned>::max() / radix; power *= radix) {
+            ++count;
+        }
+        return count;
+    }()};
+
+    // Radix^0, Radix^1, ... Radix^(num_radix_powers - 1), e.g. 1, 10, ..., 10^19 for std::uint64_t;
+    // Unsigned may be any unsigned integer type with constexpr arithmetic, including cnl::wide_integer
+    template<typename Unsigned, int Radix>
+    inline constexpr auto radix_powers{[]() {
+        auto const radix{static_cast<Unsigned>(Radix)};
+        std::array<Unsigned, num_radix_powers<Unsigned, Radix>> powers{};
+        auto power{Unsigned{1}};
+        for (auto index{0}; index != num_radix_powers<Unsigned, Radix>; ++index) {
+            powers[index] = power;
+            if (index + 1 != num_radix_powers<Unsigned, Radix>) {
+                power *= radix;
+            }
+        }
+        return powers;
+    }()};
+
+    // the widest fundamental type in which radix powers are tabulated, e.g. holding up to 10^38
+    using radix_power_word = uintmax_t;
+
+    // true iff Radix^Exponent is in the table of radix_power_word values
+    template<int Exponent, int Radix>
+    inline constexpr bool is_tabulated_radix_power{
+            Exponent >= 0 && Exponent < num_radix_powers<radix_power_word, Radix>};
+}
+
+#endif  // CNL_IMPL_RADIX_POWERS_H
@@ -18,6 +18,8 @@
 #include "rounding/native_rounding_tag.h"
 #include "rounding/nearest_rounding_tag.h"
 #include "rounding/neg_inf_rounding_tag.h"
+#include "rounding/stochastic_rounding_tag.h"
+#include "rounding/tie_to_even_rounding_tag.h"
 #include "rounding/tie_to_pos_inf_rounding_tag.h"
 
 /// compositional numeric library
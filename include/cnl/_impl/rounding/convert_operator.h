@@ -11,6 +11,8 @@
 #include "native_rounding_tag.h"
 #include "nearest_rounding_tag.h"
 #include "neg_inf_rounding_tag.h"
+#include "stochastic_rounding_tag.h"
+#include "tie_to_even_rounding_tag.h"
 #include "tie_to_pos_inf_rounding_tag.h"
 
 #include <limits>
@@ -82,6 +84,34 @@ namespace cnl {
         }
     };
 
+    template<typename Source, tag SrcTag, typename Destination>
+    requires(!_impl::is_rounding_tag<SrcTag>::value && _impl::are_arithmetic_or_integer<Destination, Source>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, tie_to_even_rounding_tag>> {
+    private:
+        [[nodiscard]] static constexpr auto floor(Source x)
+        {
+            auto const x_whole{static_cast<Destination>(x)};
+            return static_cast<Destination>(x_whole - static_cast<Destination>(x < static_cast<Source>(x_whole)));
+        }
+        [[nodiscard]] static constexpr auto round(Source x)
+        {
+            auto const x_floor{floor(x)};
+            auto const fraction{x - static_cast<Source>(x_floor)};
+            auto const half{static_cast<Source>(.5L)};
+            return static_cast<Destination>(
+                    x_floor + static_cast<Destination>(fraction > half || (fraction == half && x_floor % 2 != 0)));
+        }
+
+    public:
+        [[nodiscard]] constexpr auto operator()(Source const& from) const
+        {
+            if constexpr (std::numeric_limits<Destination>::is_integer && std::is_floating_point<Source>::value) {
+                return round(from);
+            } else {
+                return static_cast<Destination>(from);
+            }
+        }
+    };
+
     template<typename Source, tag SrcTag, typename Destination>
     requires(!_impl::is_rounding_tag<SrcTag>::value && _impl::are_arithmetic_or_integer<Destination, Source>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, neg_inf_rounding_tag>> {
     private:
@@ -106,6 +136,19 @@ namespace cnl {
                          : static_cast<Destination>(from);
         }
     };
+
+    template<typename Source, tag SrcTag, typename Destination, class Generator>
+    requires(!_impl::is_rounding_tag<SrcTag>::value && _impl::are_arithmetic_or_integer<Destination, Source>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, stochastic_rounding_tag<Generator>>> {
+        [[nodiscard]] constexpr auto operator()(Source const& from) const
+        {
+            if constexpr (std::numeric_limits<Destination>::is_integer && std::is_floating_point<Source>::value) {
+                return _impl::stochastic_round_floating<Destination>(
+                        from, _impl::stochastic_rounding_bits<Generator>());
+            } else {
+                return static_cast<Destination>(from);
+            }
+        }
+    };
     /// \endcond
 
     template<typename Source, rounding_tag SrcTag, typename Destination>
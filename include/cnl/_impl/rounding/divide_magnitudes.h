@@ -0,0 +1,65 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ROUNDING_DIVIDE_MAGNITUDES_H)
+#define CNL_IMPL_ROUNDING_DIVIDE_MAGNITUDES_H
+
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // the result of divide_magnitudes
+        template<typename Quotient>
+        struct magnitude_division {
+            using magnitude_type = numbers::set_signedness_t<Quotient, false>;
+
+            // truncated toward zero
+            Quotient quotient;
+
+            magnitude_type remainder;
+            magnitude_type divisor;
+
+            // true iff the quotient is rounded away from zero by subtracting one
+            bool signs_differ;
+        };
+
+        // the magnitude of value in the unsigned counterpart of its type,
+        // in which the magnitude of the minimum signed value is representable
+        template<typename Integer>
+        [[nodiscard]] constexpr auto unsigned_magnitude(Integer const& value)
+        {
+            using magnitude_type = numbers::set_signedness_t<Integer, false>;
+            if constexpr (numbers::signedness_v<Integer>) {
+                if (value < 0) {
+                    return static_cast<magnitude_type>(magnitude_type{0} - static_cast<magnitude_type>(value));
+                }
+            }
+            return static_cast<magnitude_type>(value);
+        }
+
+        // lhs / rhs, truncated toward zero, with the magnitudes of the remainder and divisor,
+        // from which rounding operators decide whether to round the quotient away from zero
+        template<typename Lhs, typename Rhs>
+        [[nodiscard]] constexpr auto divide_magnitudes(Lhs const& lhs, Rhs const& rhs)
+        {
+            using result_type = decltype(lhs / rhs);
+            auto const divisor{static_cast<result_type>(rhs)};
+            auto signs_differ{false};
+            if constexpr (numbers::signedness_v<result_type>) {
+                signs_differ = (lhs < 0) != (divisor < 0);
+            }
+            return magnitude_division<result_type>{
+                    static_cast<result_type>(lhs / rhs),
+                    unsigned_magnitude(static_cast<result_type>(lhs % rhs)),
+                    unsigned_magnitude(divisor),
+                    signs_differ};
+        }
+    }
+}
+
+#endif  // CNL_IMPL_ROUNDING_DIVIDE_MAGNITUDES_H
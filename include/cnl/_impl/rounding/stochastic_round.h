@@ -0,0 +1,168 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief conversion of sequences of numbers to numbers which round stochastically
+
+#if !defined(CNL_IMPL_ROUNDING_STOCHASTIC_ROUND_H)
+#define CNL_IMPL_ROUNDING_STOCHASTIC_ROUND_H
+
+#include "../cnl_assert.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../power_value.h"
+#include "../scaled/declaration.h"
+#include "../wrapper.h"
+#include "stochastic_rounding_tag.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // a rounding_integer, or a scaled_integer of rounding_integer, which rounds stochastically
+        // and whose value is an integer, rep, scaled by 2^exponent
+        template<typename Number>
+        struct stochastic_destination : std::false_type {
+        };
+
+        template<std::integral Rep, class Generator>
+        struct stochastic_destination<wrapper<Rep, stochastic_rounding_tag<Generator>>> : std::true_type {
+            using rep = Rep;
+            using generator = Generator;
+            static constexpr int exponent{0};
+
+            [[nodiscard]] static constexpr auto make(Rep const& r)
+            {
+                return from_rep<wrapper<Rep, stochastic_rounding_tag<Generator>>>(r);
+            }
+        };
+
+        template<std::integral Rep, class Generator, int Exponent>
+        struct stochastic_destination<wrapper<wrapper<Rep, stochastic_rounding_tag<Generator>>, power<Exponent, 2>>>
+            : std::true_type {
+            using rep = Rep;
+            using generator = Generator;
+            static constexpr int exponent{Exponent};
+
+            [[nodiscard]] static constexpr auto make(Rep const& r)
+            {
+                using rounding_rep = wrapper<Rep, stochastic_rounding_tag<Generator>>;
+                return from_rep<wrapper<rounding_rep, power<Exponent, 2>>>(from_rep<rounding_rep>(r));
+            }
+        };
+
+        // an integer, or a scaled_integer of an integer, whose value is an integer, rep,
+        // scaled by 2^exponent
+        template<typename Number>
+        struct binary_fixed_point : std::false_type {
+        };
+
+        template<std::integral Rep>
+        struct binary_fixed_point<Rep> : std::true_type {
+            using rep = Rep;
+            static constexpr int exponent{0};
+        };
+
+        template<std::integral Rep, int Exponent>
+        struct binary_fixed_point<wrapper<Rep, power<Exponent, 2>>> : std::true_type {
+            using rep = Rep;
+            static constexpr int exponent{Exponent};
+        };
+
+        // true iff Source is converted to Destination with a single random number
+        // and without branches, so that sequences of conversions can be vectorized
+        template<typename Destination, typename Source>
+        inline constexpr bool is_stochastic_vector_convertible{[]() {
+            if constexpr (std::is_floating_point_v<Source>) {
+                return true;
+            } else if constexpr (binary_fixed_point<Source>::value) {
+                constexpr auto shift{stochastic_destination<Destination>::exponent - binary_fixed_point<Source>::exponent};
+                using source_rep = typename binary_fixed_point<Source>::rep;
+                return shift > 0 && shift < digits_v<source_rep>;
+            } else {
+                return false;
+            }
+        }()};
+
+        // the rep of the result of converting from to Destination, rounded using the random number, bits
+        template<typename Destination, typename Source>
+        [[nodiscard]] constexpr auto stochastic_convert_rep(Source const& from, std::uint32_t bits)
+        {
+            using destination = stochastic_destination<Destination>;
+            using rep = typename destination::rep;
+            if constexpr (std::is_floating_point_v<Source>) {
+                return stochastic_round_floating<rep>(from * power_value<Source, -destination::exponent, 2>(), bits);
+            } else {
+                constexpr auto shift{destination::exponent - binary_fixed_point<Source>::exponent};
+                return static_cast<rep>(stochastic_shift_right<shift>(to_rep(from), bits));
+            }
+        }
+    }
+
+    /// \brief converts a sequence of numbers to a sequence of numbers which round stochastically
+    /// \headerfile cnl/rounding_integer.h
+    ///
+    /// \param from numbers to convert
+    /// \param to sequence of \ref rounding_integer values, or of \ref scaled_integer values of
+    /// \ref rounding_integer, which use \ref stochastic_rounding_tag, with the same size as `from`
+    ///
+    /// \note Every result is identical to the corresponding element of `from` converted to `Destination`
+    /// using the next random number in the calling thread's sequence.
+    /// Where `from` contains floating-point numbers, or binary fixed-point numbers with more fractional digits
+    /// than `Destination`, the conversions are performed without branches, so that the compiler can vectorize them.
+    template<typename Source, std::size_t SourceExtent, typename Destination, std::size_t DestinationExtent>
+    requires _impl::stochastic_destination<Destination>::value constexpr void stochastic_round(
+            std::span<Source const, SourceExtent> from,
+            std::span<Destination, DestinationExtent> to)
+    {
+        CNL_ASSERT(from.size() == to.size());
+        if constexpr (_impl::is_stochastic_vector_convertible<Destination, Source>) {
+            using destination = _impl::stochastic_destination<Destination>;
+            if (std::is_constant_evaluated()) {
+                for (auto index{std::size_t{0}}; index != to.size(); ++index) {
+                    to[index] = destination::make(
+                            _impl::stochastic_convert_rep<Destination>(from[index], _impl::half_random_bits));
+                }
+                return;
+            }
+
+            // reserve a random number for each element
+            using generator = typename destination::generator;
+            auto& stream{_impl::thread_stochastic_rounding_stream<generator>()};
+            auto const key{stream.key};
+            auto const counter{stream.counter};
+            stream.counter += to.size();
+
+            // the elements are converted in chunks over which the key is invariant
+            for (auto first{std::size_t{0}}; first != to.size();) {
+                auto const first_counter{counter + first};
+                auto const chunk_key{_impl::stochastic_rounding_key(key, first_counter)};
+                auto const lower{static_cast<std::uint32_t>(first_counter)};
+                auto const last{first + static_cast<std::size_t>(std::min(
+                                                std::uint64_t{to.size() - first},
+                                                (std::uint64_t{1} << digits_v<std::uint32_t>) - lower))};
+                for (auto index{first}; index != last; ++index) {
+                    auto const bits{generator{}(chunk_key, static_cast<std::uint32_t>(lower + (index - first)))};
+                    to[index] = destination::make(_impl::stochastic_convert_rep<Destination>(from[index], bits));
+                }
+                first = last;
+            }
+        } else {
+            for (auto index{std::size_t{0}}; index != to.size(); ++index) {
+                to[index] = static_cast<Destination>(from[index]);
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_ROUNDING_STOCHASTIC_ROUND_H
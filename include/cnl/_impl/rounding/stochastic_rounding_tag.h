@@ -0,0 +1,240 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_TAG_H)
+#define CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_TAG_H
+
+#include "../custom_operator/definition.h"
+#include "../custom_operator/native_tag.h"
+#include "../num_traits/digits.h"
+#include "../power_value.h"
+#include "divide_magnitudes.h"
+#include "is_rounding_tag.h"
+#include "is_tag.h"
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief counter-based generator of the random numbers used by \ref stochastic_rounding_tag
+    ///
+    /// Given a 64-bit key and a 32-bit counter, returns 32 random bits by hashing the counter
+    /// with the lowbias32 integer hash. Because each number is a function of its position in the sequence,
+    /// a sequence of numbers can be generated several at a time, e.g. in the lanes of a vector.
+    /// Only 32-bit multiplications are used and the hash of the key is invariant over a sequence.
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \sa stochastic_rounding_tag, seed_stochastic_rounding
+    struct counter_hash_generator {
+        [[nodiscard]] constexpr auto operator()(std::uint64_t key, std::uint32_t counter) const
+                -> std::uint32_t
+        {
+            auto const stream{hash(
+                    static_cast<std::uint32_t>(key) ^ hash(static_cast<std::uint32_t>(key >> 32) + 0x9e3779b9U))};
+            return hash(static_cast<std::uint32_t>(counter + stream));
+        }
+
+    private:
+        [[nodiscard]] static constexpr auto hash(std::uint32_t x) -> std::uint32_t
+        {
+            x ^= x >> 16;
+            x *= 0x7feb352dU;
+            x ^= x >> 15;
+            x *= 0x846ca68bU;
+            x ^= x >> 16;
+            return x;
+        }
+    };
+
+    /// \brief tag to specify stochastic rounding behavior in arithmetic operations
+    ///
+    /// Arithmetic operations using this tag round a value which lies between two representable
+    /// values to one or other of them at random, with a probability proportional to its proximity.
+    /// Thus, the expected value of the result is the precise value and, unlike with
+    /// \ref nearest_rounding_tag, rounding errors do not accumulate in long sums of
+    /// low-precision numbers.
+    ///
+    /// \tparam Generator function object which returns 32 random bits given a 64-bit key and
+    /// a 32-bit counter; defaults to \ref counter_hash_generator
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \note Each thread draws from its own sequence of random numbers, which is seeded using
+    /// \ref seed_stochastic_rounding. During constant evaluation, values are rounded to nearest,
+    /// with ties rounded toward negative infinity.
+    /// \sa rounding_integer, convert, nearest_rounding_tag, stochastic_round
+    template<class Generator = counter_hash_generator>
+    struct stochastic_rounding_tag
+        : _impl::homogeneous_deduction_tag_base
+        , _impl::homogeneous_operator_tag_base {
+    };
+
+    namespace _impl {
+        template<class Generator>
+        struct is_rounding_tag<stochastic_rounding_tag<Generator>> : std::true_type {
+        };
+
+        // the key and the counter from which a Generator produces the next random number
+        struct stochastic_rounding_stream {
+            std::uint64_t key;
+            std::uint64_t counter;
+        };
+
+        template<class Generator>
+        inline auto thread_stochastic_rounding_stream() noexcept -> stochastic_rounding_stream&
+        {
+            thread_local auto stream{stochastic_rounding_stream{0, 0}};
+            return stream;
+        }
+
+        // random bits which cause a value to be rounded to nearest
+        inline constexpr auto half_random_bits{std::uint32_t{1} << 31};
+
+        // the key passed to a Generator with the lower word of counter;
+        // a new key is used every 2^32 random numbers
+        [[nodiscard]] constexpr auto stochastic_rounding_key(std::uint64_t key, std::uint64_t counter)
+                -> std::uint64_t
+        {
+            return key + (counter >> digits_v<std::uint32_t>) * 0x9e3779b97f4a7c15U;
+        }
+
+        // the next random number from the calling thread's sequence
+        template<class Generator>
+        [[nodiscard]] constexpr auto stochastic_rounding_bits() -> std::uint32_t
+        {
+            if (std::is_constant_evaluated()) {
+                return half_random_bits;
+            }
+            auto& stream{thread_stochastic_rounding_stream<Generator>()};
+            auto const counter{stream.counter++};
+            return Generator{}(stochastic_rounding_key(stream.key, counter), static_cast<std::uint32_t>(counter));
+        }
+
+        // a number in the range [0, bound) which is uniformly distributed if bits are
+        template<typename Magnitude>
+        [[nodiscard]] constexpr auto random_below(Magnitude const& bound, std::uint32_t bits) -> Magnitude
+        {
+            constexpr auto bits_digits{digits_v<std::uint32_t>};
+            auto const lower{static_cast<std::uint64_t>(
+                    (static_cast<std::uint64_t>(static_cast<std::uint32_t>(bound)) * bits) >> bits_digits)};
+            if constexpr (digits_v<Magnitude> <= bits_digits) {
+                return static_cast<Magnitude>(lower);
+            } else {
+                return static_cast<Magnitude>((bound >> bits_digits) * static_cast<Magnitude>(bits) + static_cast<Magnitude>(lower));
+            }
+        }
+
+        // value / 2^Shift rounded up with probability equal to the discarded fraction;
+        // without branches, so that sequences of values can be vectorized
+        template<int Shift, typename Integer>
+        [[nodiscard]] constexpr auto stochastic_shift_right(Integer const& value, std::uint32_t bits)
+        {
+            static_assert(Shift > 0 && Shift < digits_v<Integer>);
+            constexpr auto bits_digits{digits_v<std::uint32_t>};
+            constexpr auto mask{static_cast<Integer>((Integer{1} << Shift) - 1)};
+            auto const random{[bits]() {
+                if constexpr (Shift <= bits_digits) {
+                    return static_cast<Integer>(bits >> (bits_digits - Shift));
+                } else {
+                    return static_cast<Integer>(static_cast<Integer>(bits) << (Shift - bits_digits));
+                }
+            }()};
+
+            // the fraction, value & mask, and mask - random add up to 2^Shift or more
+            // iff random < fraction
+            return static_cast<Integer>((value >> Shift) + (((value & mask) + (mask - random)) >> Shift));
+        }
+
+        // lhs / rhs rounded up with probability equal to the fractional part of the quotient
+        template<typename Lhs, typename Rhs>
+        [[nodiscard]] constexpr auto stochastic_divide(Lhs const& lhs, Rhs const& rhs, std::uint32_t bits)
+        {
+            auto const division{divide_magnitudes(lhs, rhs)};
+            using result_type = decltype(division.quotient);
+            using magnitude_type = typename decltype(division)::magnitude_type;
+
+            // round toward negative infinity, so that the remainder has the sign of the divisor
+            auto quotient{division.quotient};
+            auto remainder{division.remainder};
+            if (division.signs_differ && remainder != 0) {
+                --quotient;
+                remainder = static_cast<magnitude_type>(division.divisor - remainder);
+            }
+            return static_cast<result_type>(
+                    quotient + static_cast<result_type>(random_below(division.divisor, bits) < remainder));
+        }
+
+        // from rounded up to an integer with probability equal to its fractional part;
+        // the fraction and the random number are compared as 31-bit integers,
+        // which conversions between vectors of floating-point and integer values support
+        template<typename Integer, std::floating_point Float>
+        [[nodiscard]] constexpr auto stochastic_round_floating(Float const& from, std::uint32_t bits)
+        {
+            constexpr auto random_digits{digits_v<std::int32_t>};
+            auto const truncated{static_cast<Integer>(from)};
+            auto const floor{static_cast<Integer>(truncated - static_cast<Integer>(from < static_cast<Float>(truncated)))};
+            auto const fraction{static_cast<std::int32_t>(
+                    (from - static_cast<Float>(floor)) * power_value<Float, random_digits, 2>())};
+            auto const random{static_cast<std::int32_t>(bits >> (digits_v<std::uint32_t> - random_digits))};
+            return static_cast<Integer>(floor + static_cast<Integer>(random < fraction));
+        }
+    }
+
+    /// \brief seeds the calling thread's sequence of random numbers used by \ref stochastic_rounding_tag
+    ///
+    /// \tparam Generator the generator of the sequence; defaults to \ref counter_hash_generator
+    /// \param seed key from which the sequence is generated
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \note Until seeded, the sequence of every thread is generated from a seed of zero.
+    /// Threads seeded with different values produce different sequences.
+    template<class Generator = counter_hash_generator>
+    inline void seed_stochastic_rounding(std::uint64_t seed) noexcept
+    {
+        _impl::thread_stochastic_rounding_stream<Generator>() = _impl::stochastic_rounding_stream{seed, 0};
+    }
+
+    template<_impl::unary_arithmetic_op Operator, typename Operand, class Generator>
+    struct custom_operator<Operator, op_value<Operand, stochastic_rounding_tag<Generator>>>
+        : custom_operator<Operator, op_value<Operand, _impl::native_tag>> {
+    };
+
+    template<_impl::binary_arithmetic_op Operator, typename Lhs, typename Rhs, class Generator>
+    struct custom_operator<
+            Operator,
+            op_value<Lhs, stochastic_rounding_tag<Generator>>,
+            op_value<Rhs, stochastic_rounding_tag<Generator>>>
+        : Operator {
+    };
+
+    template<typename Lhs, typename Rhs, class Generator>
+    struct custom_operator<
+            _impl::divide_op,
+            op_value<Lhs, stochastic_rounding_tag<Generator>>,
+            op_value<Rhs, stochastic_rounding_tag<Generator>>> {
+        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+                -> decltype(lhs / rhs)
+        {
+            return _impl::stochastic_divide(lhs, rhs, _impl::stochastic_rounding_bits<Generator>());
+        }
+    };
+
+    template<_impl::shift_op Operator, typename Lhs, typename Rhs, tag RhsTag, class Generator>
+    struct custom_operator<Operator, op_value<Lhs, stochastic_rounding_tag<Generator>>, op_value<Rhs, RhsTag>>
+        : Operator {
+    };
+
+    template<_impl::prefix_op Operator, typename Rhs, class Generator>
+    struct custom_operator<Operator, op_value<Rhs, stochastic_rounding_tag<Generator>>> : Operator {
+    };
+
+    template<_impl::postfix_op Operator, typename Lhs, class Generator>
+    struct custom_operator<Operator, op_value<Lhs, stochastic_rounding_tag<Generator>>> : Operator {
+    };
+}
+
+#endif  // CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_TAG_H
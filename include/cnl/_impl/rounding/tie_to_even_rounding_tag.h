@@ -0,0 +1,112 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ROUNDING_TIE_TO_EVEN_ROUNDING_TAG_H)
+#define CNL_IMPL_ROUNDING_TIE_TO_EVEN_ROUNDING_TAG_H
+
+#include "../custom_operator/definition.h"
+#include "../custom_operator/native_tag.h"
+#include "../num_traits/digits.h"
+#include "divide_magnitudes.h"
+#include "is_rounding_tag.h"
+#include "is_tag.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag to specify tie to even rounding behavior in arithmetic operations
+    ///
+    /// Arithmetic operations using this tag round the mid-point value to the nearest even
+    /// representable value and round all other values to their nearest representable value.
+    /// Also known as banker's rounding, it does not bias sums of rounded values.
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \note Where the representation of a \ref rounding_integer is a fundamental integer,
+    /// division by a power of two, e.g. conversion to a binary \ref scaled_integer with fewer
+    /// fractional digits, is performed without branches using a shift and a mask.
+    /// \sa rounding_integer, convert, nearest_rounding_tag, tie_to_pos_inf_rounding_tag
+    struct tie_to_even_rounding_tag
+        : _impl::homogeneous_deduction_tag_base
+        , _impl::homogeneous_operator_tag_base {
+    };
+
+    namespace _impl {
+        template<>
+        struct is_rounding_tag<tie_to_even_rounding_tag> : std::true_type {
+        };
+
+        // value / 2^Shift rounded to nearest, with ties rounded to even;
+        // the discarded digits, value & mask, are rounded up by adding half less one,
+        // plus one if the truncated quotient is odd
+        template<int Shift, typename Integer>
+        [[nodiscard]] constexpr auto tie_to_even_shift_right(Integer const& value)
+        {
+            static_assert(Shift > 0 && Shift < digits_v<Integer>);
+            constexpr auto mask{static_cast<Integer>((Integer{1} << Shift) - 1)};
+            constexpr auto half{static_cast<Integer>(Integer{1} << (Shift - 1))};
+            auto const quotient{static_cast<Integer>(value >> Shift)};
+            return static_cast<Integer>(
+                    quotient + static_cast<Integer>(((value & mask) + (half - 1) + (quotient & 1)) >> Shift));
+        }
+
+        // lhs / rhs rounded to nearest, with ties rounded to even
+        template<typename Lhs, typename Rhs>
+        [[nodiscard]] constexpr auto tie_to_even_divide(Lhs const& lhs, Rhs const& rhs)
+        {
+            auto const division{divide_magnitudes(lhs, rhs)};
+            using result_type = decltype(division.quotient);
+            using magnitude_type = typename decltype(division)::magnitude_type;
+
+            // the quotient, truncated toward zero, is rounded away from zero iff the remainder
+            // is more than half the divisor or exactly half and the quotient is odd
+            auto const excess{static_cast<magnitude_type>(division.divisor - division.remainder)};
+            if (division.remainder < excess || (division.remainder == excess && division.quotient % 2 == 0)) {
+                return division.quotient;
+            }
+            return static_cast<result_type>(division.signs_differ ? division.quotient - 1 : division.quotient + 1);
+        }
+    }
+
+    template<_impl::unary_arithmetic_op Operator, typename Operand>
+    struct custom_operator<Operator, op_value<Operand, tie_to_even_rounding_tag>>
+        : custom_operator<Operator, op_value<Operand, _impl::native_tag>> {
+    };
+
+    template<_impl::binary_arithmetic_op Operator, typename Lhs, typename Rhs>
+    struct custom_operator<
+            Operator,
+            op_value<Lhs, tie_to_even_rounding_tag>,
+            op_value<Rhs, tie_to_even_rounding_tag>>
+        : Operator {
+    };
+
+    template<typename Lhs, typename Rhs>
+    struct custom_operator<
+            _impl::divide_op,
+            op_value<Lhs, tie_to_even_rounding_tag>,
+            op_value<Rhs, tie_to_even_rounding_tag>> {
+        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+                -> decltype(lhs / rhs)
+        {
+            return _impl::tie_to_even_divide(lhs, rhs);
+        }
+    };
+
+    template<_impl::shift_op Operator, typename Lhs, typename Rhs, tag RhsTag>
+    struct custom_operator<Operator, op_value<Lhs, tie_to_even_rounding_tag>, op_value<Rhs, RhsTag>> : Operator {
+    };
+
+    template<_impl::prefix_op Operator, typename Rhs>
+    struct custom_operator<Operator, op_value<Rhs, tie_to_even_rounding_tag>> : Operator {
+    };
+
+    template<_impl::postfix_op Operator, typename Lhs>
+    struct custom_operator<Operator, op_value<Lhs, tie_to_even_rounding_tag>> : Operator {
+    };
+}
+
+#endif  // CNL_IMPL_ROUNDING_TIE_TO_EVEN_ROUNDING_TAG_H
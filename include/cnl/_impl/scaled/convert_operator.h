@@ -11,14 +11,18 @@
 #include "../../integer.h"
 #include "../custom_operator/native_tag.h"
 #include "../narrow_cast.h"
+#include "../num_traits/digits.h"
 #include "../num_traits/fixed_width_scale.h"
 #include "../num_traits/scale.h"
+#include "../numbers/signedness.h"
 #include "../power_value.h"
 #include "../scaled_integer/definition.h"
 #include "is_same_tag_family.h"
 #include "power.h"
 
 #include <concepts>
+#include <cstdint>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
@@ -60,6 +64,21 @@ namespace cnl {
         }
     };
 
+    namespace _impl {
+        // the type in which a Rep is scaled by powers of two different radixes;
+        // fundamental integers narrower than 64 bits are widened so that the first
+        // scale does not overflow where the result of the second is representable
+        template<typename Rep>
+        struct radix_conversion_rep {
+            using type = Rep;
+        };
+
+        template<typename Rep>
+        requires(std::is_integral_v<Rep> && digits_v<Rep> < digits_v<std::int64_t>) struct radix_conversion_rep<Rep> {
+            using type = std::conditional_t<numbers::signedness_v<Rep>, std::int64_t, std::uint64_t>;
+        };
+    }
+
     // integer -> integer (different Ridixes)
     template<
             integer Input, int SrcExponent, int SrcRadix,
@@ -70,7 +89,9 @@ namespace cnl {
             op_value<Result, power<DestExponent, DestRadix>>> {
         [[nodiscard]] constexpr auto operator()(Input const& from) const
         {
-            auto result{_impl::from_value<Result>(from)};
+            using result_type = decltype(_impl::from_value<Result>(from));
+            using rep = typename _impl::radix_conversion_rep<result_type>::type;
+            auto result{static_cast<rep>(_impl::from_value<Result>(from))};
             if constexpr (SrcExponent > 0) {
                 result = _impl::scale<SrcExponent, SrcRadix>(result);
             }
@@ -83,7 +104,7 @@ namespace cnl {
             if constexpr (DestExponent > 0) {
                 result = _impl::scale<-DestExponent, DestRadix>(result);
             }
-            return result;
+            return static_cast<result_type>(result);
         }
     };
 
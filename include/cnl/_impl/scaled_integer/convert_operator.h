@@ -8,12 +8,14 @@
 #define CNL_IMPL_SCALED_INTEGER_TAGGED_CONVERT_OPERATOR_H
 
 #include "../../integer.h"
+#include "../num_traits/digits.h"
 #include "../num_traits/to_rep.h"
 #include "../overflow/overflow_operator.h"
 #include "../power_value.h"
 #include "../rounding/native_rounding_tag.h"
 #include "../rounding/nearest_rounding_tag.h"
 #include "../rounding/neg_inf_rounding_tag.h"
+#include "../rounding/tie_to_even_rounding_tag.h"
 #include "../rounding/tie_to_pos_inf_rounding_tag.h"
 #include "../scaled/is_scaled_tag.h"
 #include "definition.h"
@@ -243,6 +245,110 @@ namespace cnl {
         }
     };
 
+    ////////////////////////////////////////////////////////
+    /// cnl::tie_to_even_rounding_tag
+
+    // conversion between two scaled_integer types where rounding *isn't* an issue
+    /// \cond
+    template<
+            typename InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(ResultExponent <= InputExponent) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, tie_to_even_rounding_tag>>
+        : custom_operator<
+                  _impl::convert_op,
+                  op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+                  op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, native_rounding_tag>> {
+    };
+
+    // conversion between two scaled_integer types where rounding *is* an issue
+    template<
+            typename InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(!(ResultExponent <= InputExponent)) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, tie_to_even_rounding_tag>> {
+    private:
+        using result = scaled_integer<ResultRep, power<ResultExponent, Radix>>;
+        using input = scaled_integer<InputRep, power<InputExponent, Radix>>;
+
+        static constexpr auto shift{ResultExponent - InputExponent};
+
+        // binary fixed-point values are rounded with a shift and a mask instead of a division
+        [[nodiscard]] static constexpr auto divide(InputRep const& from)
+        {
+            if constexpr (Radix == 2 && std::is_integral_v<InputRep> && shift < digits_v<InputRep>) {
+                return _impl::tie_to_even_shift_right<shift>(from);
+            } else {
+                return _impl::tie_to_even_divide(from, _impl::power_value<InputRep, shift, Radix>());
+            }
+        }
+
+    public:
+        [[nodiscard]] constexpr auto operator()(input const& from) const -> result
+        {
+            return _impl::from_rep<result>(divide(_impl::to_rep(from)));
+        }
+    };
+    /// \endcond
+
+    // conversion from float to scaled_integer
+    template<
+            std::floating_point Input,
+            typename ResultRep, int ResultExponent, int ResultRadix>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<Input, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, ResultRadix>>, tie_to_even_rounding_tag>> {
+    private:
+        using result = scaled_integer<ResultRep, power<ResultExponent, ResultRadix>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(Input const& from) const
+        {
+            return _impl::from_rep<result>(
+                    custom_operator<
+                            _impl::convert_op,
+                            op_value<Input, _impl::native_tag>,
+                            op_value<ResultRep, tie_to_even_rounding_tag>>{}(
+                            from * _impl::power_value<Input, -ResultExponent, ResultRadix>()));
+        }
+    };
+
+    template<integer Input, integer ResultRep, scaled_tag ResultScale>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<Input, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, ResultScale>, tie_to_even_rounding_tag>>
+        : custom_operator<
+                  _impl::convert_op,
+                  op_value<scaled_integer<Input>, _impl::native_tag>,
+                  op_value<scaled_integer<ResultRep, ResultScale>, tie_to_even_rounding_tag>> {
+    };
+
+    template<integer InputRep, scaled_tag InputScale, integer Result>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, InputScale>, _impl::native_tag>,
+            op_value<Result, tie_to_even_rounding_tag>> {
+    private:
+        using input = scaled_integer<InputRep, InputScale>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(input const& from) const
+        {
+            return _impl::to_rep(custom_operator<
+                                 _impl::convert_op,
+                                 op_value<input, _impl::native_tag>,
+                                 op_value<scaled_integer<Result>, tie_to_even_rounding_tag>>{}(from));
+        }
+    };
+
     ////////////////////////////////////////////////////////
     /// cnl::neg_inf_rounding_tag
 
@@ -12,16 +12,30 @@
 #if !defined(CNL_IMPL_SCALED_INTEGER_EXTRAS_H)
 #define CNL_IMPL_SCALED_INTEGER_EXTRAS_H
 
+#include "../charconv/constants.h"
+#include "../charconv/format_spec.h"
 #include "../cmath/abs.h"
+#include "../cnl_assert.h"
 #include "../config.h"
+#include "../num_traits/digits.h"
 #include "../num_traits/width.h"
+#include "../ssize.h"
 #include "definition.h"
+#include "format.h"
+#include "from_chars.h"
 #include "to_chars.h"
+#include "to_chars_capacity.h"
 
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <cmath>
 #if defined(CNL_IOSTREAMS_ENABLED)
 #include <istream>
+#include <iterator>
 #include <ostream>
+#include <streambuf>
+#include <string>
 #endif
 
 /// compositional numeric library
@@ -70,11 +84,12 @@ namespace cnl {
     }
 
     ////////////////////////////////////////////////////////////////////////////////
-    // scaled_integer trig functions
+    // scaled_integer transcendental functions
     //
     // Placeholder implementations fall back on <cmath> functions which is slow
     // due to conversion to and from floating-point types; also inconvenient as
     // many <cmath> functions are not [[nodiscard]] constexpr.
+    // See trig.h and math.h for integer implementations of transcendental functions.
 
     namespace _impl {
         template<int NumBits>
@@ -110,46 +125,215 @@ namespace cnl {
         }
     }
 
-    template<typename Rep, int Exponent, int Radix>
-    [[nodiscard]] constexpr auto sin(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
-    {
-        return _impl::crib<Rep, Exponent, Radix, std::sin>(x);
-    }
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::scaled_integer streaming
 
-    template<typename Rep, int Exponent, int Radix>
-    [[nodiscard]] constexpr auto cos(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
-    {
-        return _impl::crib<Rep, Exponent, Radix, std::cos>(x);
-    }
+#if defined(CNL_IOSTREAMS_ENABLED)
+    namespace _impl {
+        // the format_spec which corresponds to the formatting state of a stream,
+        // except that the default floatfield is represented by no type
+        [[nodiscard]] inline auto stream_format_spec(std::ostream const& out)
+        {
+            auto const flags{out.flags()};
+            auto const is_uppercase{(flags & std::ios_base::uppercase) != 0};
 
-    template<typename Rep, int Exponent, int Radix>
-    [[nodiscard]] constexpr auto exp(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
-    {
-        return _impl::crib<Rep, Exponent, Radix, std::exp>(x);
-    }
+            auto spec{format_spec{}};
+            spec.fill = out.fill();
+            spec.align = (flags & std::ios_base::left) ? format_align::left : format_align::right;
+            spec.sign = (flags & std::ios_base::showpos) ? format_sign::plus : format_sign::minus;
+            spec.alternate = (flags & std::ios_base::showpoint) != 0;
+            spec.width = static_cast<int>(std::clamp(out.width(), std::streamsize{0}, std::streamsize{1'000'000}));
+            spec.precision = static_cast<int>(std::clamp(out.precision(), std::streamsize{0}, std::streamsize{1'000'000}));
+            switch (flags & std::ios_base::floatfield) {
+            case std::ios_base::fixed:
+                spec.type = is_uppercase ? 'F' : 'f';
+                break;
+            case std::ios_base::scientific:
+                spec.type = is_uppercase ? 'E' : 'e';
+                break;
+            case std::ios_base::fixed | std::ios_base::scientific:
+                spec.type = is_uppercase ? 'A' : 'a';
+                spec.precision = -1;
+                break;
+            default:
+                spec.precision = -1;
+                break;
+            }
+            return spec;
+        }
 
-    template<typename Rep, int Exponent, int Radix>
-    [[nodiscard]] constexpr auto pow(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
-    {
-        return _impl::crib<Rep, Exponent, Radix, std::pow>(x);
-    }
+        // the characters of a number which are read from a stream and passed to from_chars;
+        // beyond those needed to determine the Value, fractional digits are not stored
+        template<class Value>
+        class stream_numeral;
 
-    ////////////////////////////////////////////////////////////////////////////////
-    // cnl::scaled_integer streaming - (placeholder implementation)
+        template<typename Rep, int Exponent>
+        class stream_numeral<scaled_integer<Rep, power<Exponent>>> {
+            // one more digit than any representable value has
+            static constexpr auto max_integer_digits{
+                    num_digits_from_binary(digits_v<Rep> + 1 + std::max(0, Exponent), 10) + 1};
 
-#if defined(CNL_IOSTREAMS_ENABLED)
+            // the digits which from_chars uses to find the nearest value, and a digit which stands for the rest
+            static constexpr auto max_fraction_digits{std::max(0, -Exponent) + 2};
+
+        public:
+            // reads a number, e.g. "-12.375", from the characters at the front of buffer
+            explicit stream_numeral(std::streambuf& buffer)
+            {
+                using traits = std::char_traits<char>;
+                auto c{buffer.sgetc()};
+                auto const next{[&]() {
+                    c = buffer.snextc();
+                }};
+
+                if (c == plus_char || c == minus_char) {
+                    if (c == minus_char) {
+                        push(minus_char);
+                    }
+                    next();
+                }
+
+                // leading zeros are not stored, except one to stand for an integer part of zero
+                for (; c == zero_char; next()) {
+                    _has_digits = true;
+                }
+                auto num_integer_digits{0};
+                for (; is_digit(c); next()) {
+                    _has_digits = true;
+                    _is_overflow |= (++num_integer_digits > max_integer_digits);
+                    if (!_is_overflow) {
+                        push(traits::to_char_type(c));
+                    }
+                }
+                if (_has_digits && num_integer_digits == 0) {
+                    push(zero_char);
+                }
+
+                if (c == radix_char) {
+                    push(radix_char);
+                    auto is_rest_zero{true};
+                    for (auto num_digits{0}; (next(), is_digit(c));) {
+                        _has_digits = true;
+                        if (num_digits < max_fraction_digits - 1) {
+                            push(traits::to_char_type(c));
+                            ++num_digits;
+                        } else {
+                            is_rest_zero &= (c == zero_char);
+                        }
+                    }
+                    if (!is_rest_zero) {
+                        push('1');
+                    }
+                }
+
+                _is_eof = traits::eq_int_type(c, traits::eof());
+            }
+
+            [[nodiscard]] auto is_eof() const
+            {
+                return _is_eof;
+            }
+
+            // parses the characters into value, returning false on failure
+            [[nodiscard]] auto parse(scaled_integer<Rep, power<Exponent>>& value) const
+            {
+                if (!_has_digits || _is_overflow) {
+                    return false;
+                }
+                auto const* const last{_chars.data() + _length};
+                auto const result{from_chars(_chars.data(), last, value)};
+                return result.ec == std::errc{} && result.ptr == last;
+            }
+
+        private:
+            [[nodiscard]] static auto is_digit(std::char_traits<char>::int_type c)
+            {
+                return !std::char_traits<char>::eq_int_type(c, std::char_traits<char>::eof())
+                    && std::isdigit(static_cast<unsigned char>(std::char_traits<char>::to_char_type(c)));
+            }
+
+            void push(char c)
+            {
+                CNL_ASSERT(_length < _impl::ssize(_chars));
+                _chars[_length++] = c;
+            }
+
+            std::array<char, 2 + max_integer_digits + max_fraction_digits> _chars{};
+            int _length{0};
+            bool _has_digits{false};
+            bool _is_overflow{false};
+            bool _is_eof{false};
+        };
+    }
+
+    /// \brief writes a \ref cnl::scaled_integer to a stream
+    ///
+    /// \note If the `fixed` or `scientific` flag of the stream is set, the number is formatted
+    /// as by \ref cnl::format_to with type `f` or `e` and the stream's precision.
+    /// If both are set, hexadecimal digits are written as with type `a`.
+    /// Otherwise, the characters written are those of \ref cnl::to_chars.
+    /// The stream's width, fill, `left`, `showpos`, `showpoint` and `uppercase` flags are also observed.
+    /// \note The characters are written directly to the stream buffer, without regard to the stream's locale.
     template<typename Rep, int Exponent, int Radix>
     auto& operator<<(std::ostream& out, scaled_integer<Rep, power<Exponent, Radix>> const& fp)
     {
-        return out << to_chars_static(fp).chars.data();
+        std::ostream::sentry const sentry{out};
+        if (!sentry) {
+            return out;
+        }
+
+        auto const spec{_impl::stream_format_spec(out)};
+        out.width(0);
+
+        auto const first{std::ostreambuf_iterator<char>{out}};
+        auto const last{[&]() {
+            if (spec.type != '\0' && _impl::is_format_type_supported(spec.type, Radix)) {
+                return format_to(first, spec, fp);
+            }
+
+            auto const [chars, length] = to_chars_static(fp);
+            auto const is_negative{chars[0] == _impl::minus_char};
+            auto const sign{
+                    is_negative                           ? _impl::minus_char
+                    : (spec.sign == format_sign::plus) ? _impl::plus_char
+                                                          : '\0'};
+            return _impl::format_padded(first, spec, sign, [&](auto digits_out) {
+                return std::copy(chars.data() + is_negative, chars.data() + length, digits_out);
+            });
+        }()};
+
+        if (last.failed()) {
+            out.setstate(std::ios_base::badbit);
+        }
+        return out;
     }
 
+    /// \brief reads a \ref cnl::scaled_integer from a stream
+    ///
+    /// \note When the radix of the number is 2, the characters are expected to be decimal digits
+    /// with an optional sign and radix point, e.g. "-12.375", and are read directly from the stream buffer,
+    /// without regard to the stream's locale. The result is exact, as with \ref cnl::from_chars.
+    /// On failure, `failbit` is set and fp is unchanged.
     template<typename Rep, int Exponent, int Radix>
     auto& operator>>(std::istream& in, scaled_integer<Rep, power<Exponent, Radix>>& fp)
     {
-        long double ld{};
-        in >> ld;
-        fp = ld;
+        if constexpr (Radix == 2) {
+            std::istream::sentry const sentry{in};
+            if (!sentry) {
+                return in;
+            }
+
+            auto const numeral{_impl::stream_numeral<scaled_integer<Rep, power<Exponent, Radix>>>{*in.rdbuf()}};
+            auto state{numeral.is_eof() ? std::ios_base::eofbit : std::ios_base::goodbit};
+            if (!numeral.parse(fp)) {
+                state |= std::ios_base::failbit;
+            }
+            in.setstate(state);
+        } else {
+            long double ld{};
+            in >> ld;
+            fp = ld;
+        }
         return in;
     }
 #endif
@@ -0,0 +1,362 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::format_to and cnl::format overloaded on cnl::scaled_integer
+
+#if !defined(CNL_IMPL_SCALED_INTEGER_FORMAT_H)
+#define CNL_IMPL_SCALED_INTEGER_FORMAT_H
+
+#include "../charconv/constants.h"
+#include "../charconv/format_spec.h"
+#include "../charconv/positional_natural.h"
+#include "../cnl_assert.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/to_rep.h"
+#include "../numbers/signedness.h"
+#include "../radix_powers.h"
+#include "../scaled/power.h"
+#include "../throw_exception.h"
+#include "definition.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // output iterator which counts the characters written to it
+        class format_counter {
+        public:
+            using difference_type = std::ptrdiff_t;
+
+            explicit constexpr format_counter(std::ptrdiff_t& count)
+                : _count(&count)
+            {
+            }
+
+            constexpr auto operator=(char /*unused*/) -> format_counter&
+            {
+                ++*_count;
+                return *this;
+            }
+
+            constexpr auto operator*() -> format_counter&
+            {
+                return *this;
+            }
+
+            constexpr auto operator++() -> format_counter&
+            {
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> format_counter
+            {
+                return *this;
+            }
+
+        private:
+            std::ptrdiff_t* _count;
+        };
+
+        template<class OutputIt>
+        constexpr auto format_fill(OutputIt out, std::ptrdiff_t count, char c)
+        {
+            for (; count > 0; --count) {
+                *out++ = c;
+            }
+            return out;
+        }
+
+        // writes the sign, body(out) and whatever padding spec calls for;
+        // the body is written twice: once to measure it and once to output it
+        template<class OutputIt, class Body>
+        constexpr auto format_padded(OutputIt out, format_spec const& spec, char sign, Body const& body)
+        {
+            auto padding{std::ptrdiff_t{0}};
+            if (spec.width) {
+                auto length{std::ptrdiff_t{sign != '\0'}};
+                body(format_counter{length});
+                padding = std::max(std::ptrdiff_t{0}, spec.width - length);
+            }
+
+            if (spec.zero_pad && spec.align == format_align::none) {
+                if (sign) {
+                    *out++ = sign;
+                }
+                return body(format_fill(out, padding, zero_char));
+            }
+
+            auto const before{
+                    (spec.align == format_align::left)     ? std::ptrdiff_t{0}
+                    : (spec.align == format_align::center) ? padding / 2
+                                                           : padding};
+            out = format_fill(out, before, spec.fill);
+            if (sign) {
+                *out++ = sign;
+            }
+            out = body(out);
+            return format_fill(out, padding - before, spec.fill);
+        }
+
+        template<class OutputIt>
+        constexpr auto format_exponent(OutputIt out, int exponent, int min_digits)
+        {
+            *out++ = (exponent < 0) ? minus_char : plus_char;
+            auto const magnitude{exponent < 0 ? -exponent : exponent};
+            auto num_digits{1};
+            auto unit{1};
+            for (; magnitude / unit >= 10; unit *= 10) {
+                ++num_digits;
+            }
+            out = format_fill(out, min_digits - num_digits, zero_char);
+            for (; unit; unit /= 10) {
+                *out++ = static_cast<char>(zero_char + magnitude / unit % 10);
+            }
+            return out;
+        }
+
+        // the number of times that factor divides radix
+        [[nodiscard]] constexpr auto radix_factor_exponent(int radix, int factor)
+        {
+            auto exponent{0};
+            for (; radix % factor == 0; radix /= factor) {
+                ++exponent;
+            }
+            return exponent;
+        }
+
+        // true iff every number with the given radix has a terminating decimal expansion
+        [[nodiscard]] constexpr auto has_decimal_expansion(int radix)
+        {
+            for (; radix % 2 == 0; radix /= 2) {
+            }
+            for (; radix % 5 == 0; radix /= 5) {
+            }
+            return radix == 1;
+        }
+
+        // describes the scaled_integer, rep * Radix^Exponent, as D * 10^-fraction_digits,
+        // where D is the natural number, |rep| * 2^twos * 5^fives
+        template<typename Rep, int Exponent, int Radix>
+        struct decimal_format_traits {
+            static_assert(
+                    has_decimal_expansion(Radix),
+                    "cnl::format_to requires a Radix with no prime factors other than 2 and 5");
+
+            static constexpr auto radix_twos{radix_factor_exponent(Radix, 2)};
+            static constexpr auto radix_fives{radix_factor_exponent(Radix, 5)};
+            static constexpr auto fraction_digits{Exponent < 0 ? -Exponent * std::max(radix_twos, radix_fives) : 0};
+            static constexpr auto twos{
+                    Exponent < 0 ? fraction_digits + Exponent * radix_twos : Exponent * radix_twos};
+            static constexpr auto fives{
+                    Exponent < 0 ? fraction_digits + Exponent * radix_fives : Exponent * radix_fives};
+
+            // log2(5) < 2.322; log10(2) < .30103; and there is an extra limb to hold a carry from rounding
+            static constexpr auto max_bits{digits_v<Rep> + 1 + twos + (fives * 2322 + 999) / 1000};
+            static constexpr auto max_digits{max_bits * 30103 / 100000 + 1};
+            using natural = positional_natural<10, max_digits / 9 + 2>;
+        };
+
+        // |rep| * Radix^Exponent * 10^fraction_digits, as a decimal positional_natural
+        template<typename Rep, int Exponent, int Radix>
+        [[nodiscard]] constexpr auto format_decimal_natural(Rep const& rep)
+        {
+            using traits = decimal_format_traits<Rep, Exponent, Radix>;
+            auto natural{make_positional_natural<typename traits::natural>(rep)};
+
+            constexpr auto max_two_power{31};
+            for (auto twos{traits::twos}; twos > 0; twos -= max_two_power) {
+                natural.multiply(std::uint32_t{1} << std::min(max_two_power, twos));
+            }
+
+            // 5^13 < 2^32
+            constexpr auto max_five_power{num_radix_powers<std::uint32_t, 5> - 1};
+            for (auto fives{traits::fives}; fives > 0; fives -= max_five_power) {
+                natural.multiply(radix_powers<std::uint32_t, 5>[std::min(max_five_power, fives)]);
+            }
+            return natural;
+        }
+
+        template<typename Rep, int Exponent, int Radix, class OutputIt>
+        constexpr auto format_decimal(OutputIt out, format_spec const& spec, char sign, Rep const& rep)
+        {
+            constexpr auto fraction_digits{decimal_format_traits<Rep, Exponent, Radix>::fraction_digits};
+            auto natural{format_decimal_natural<Rep, Exponent, Radix>(rep)};
+            auto const is_zero{!natural.num_digits()};
+
+            if (spec.type == 'e' || spec.type == 'E') {
+                auto const precision{spec.precision < 0 ? 6 : spec.precision};
+                natural.round(natural.num_digits() - 1 - precision);
+                auto const top{std::max(0, natural.num_digits() - 1)};
+                auto const exponent{is_zero ? 0 : top - fraction_digits};
+                return format_padded(out, spec, sign, [&](auto digits_out) {
+                    *digits_out++ = static_cast<char>(zero_char + natural.digit(top));
+                    if (precision || spec.alternate) {
+                        *digits_out++ = radix_char;
+                    }
+                    digits_out = natural.write_digits(digits_out, top - 1, precision);
+                    *digits_out++ = spec.type;
+                    return format_exponent(digits_out, exponent, 2);
+                });
+            }
+
+            // by default, every significant fractional digit is written
+            auto const precision{
+                    (spec.precision >= 0) ? spec.precision
+                    : (spec.type != '\0') ? 6
+                    : is_zero              ? 0
+                                           : std::max(0, fraction_digits - natural.num_trailing_zeros())};
+            natural.round(fraction_digits - precision);
+            auto const top{std::max(fraction_digits, natural.num_digits() - 1)};
+            return format_padded(out, spec, sign, [&](auto digits_out) {
+                digits_out = natural.write_digits(digits_out, top, top - fraction_digits + 1);
+                if (precision || spec.alternate) {
+                    *digits_out++ = radix_char;
+                }
+                return natural.write_digits(digits_out, fraction_digits - 1, precision);
+            });
+        }
+
+        template<typename Rep, int Exponent, int Radix, class OutputIt>
+        constexpr auto format_hexadecimal(OutputIt out, format_spec const& spec, char sign, Rep const& rep)
+        {
+            constexpr auto binary_exponent{Exponent * radix_factor_exponent(Radix, 2)};
+            constexpr auto hex_digit_bits{4};
+            auto natural{make_positional_natural<positional_natural<2, (digits_v<Rep> + 1) / 32 + 2>>(rep)};
+            auto const is_zero{!natural.num_digits()};
+
+            // by default, every significant digit is written
+            auto const precision{
+                    (spec.precision >= 0) ? spec.precision
+                    : is_zero             ? 0
+                                          : (natural.num_digits() - 1 - natural.num_trailing_zeros() + hex_digit_bits - 1)
+                                     / hex_digit_bits};
+            natural.round(natural.num_digits() - 1 - precision * hex_digit_bits);
+            auto const top{std::max(0, natural.num_digits() - 1)};
+            auto const exponent{is_zero ? 0 : top + binary_exponent};
+            auto const* const hex_digits{spec.type == 'A' ? "0123456789ABCDEF" : "0123456789abcdef"};
+
+            return format_padded(out, spec, sign, [&](auto digits_out) {
+                // the leading digit is 1 unless the number is zero
+                *digits_out++ = static_cast<char>(zero_char + natural.digit(top));
+                if (precision || spec.alternate) {
+                    *digits_out++ = radix_char;
+                }
+                for (auto position{top - hex_digit_bits}; position >= top - precision * hex_digit_bits;
+                     position -= hex_digit_bits) {
+                    auto hex_digit{0};
+                    for (auto bit{hex_digit_bits - 1}; bit >= 0; --bit) {
+                        hex_digit = hex_digit * 2 + natural.digit(position + bit);
+                    }
+                    *digits_out++ = hex_digits[hex_digit];
+                }
+                *digits_out++ = (spec.type == 'A') ? 'P' : 'p';
+                return format_exponent(digits_out, exponent, 1);
+            });
+        }
+
+        // true iff numbers with the given radix can be written with the given type
+        [[nodiscard]] constexpr auto is_format_type_supported(char type, int radix)
+        {
+            if (type == 'a' || type == 'A') {
+                return radix == 1 << radix_factor_exponent(radix, 2);
+            }
+            return type == '\0' || is_format_type(type);
+        }
+    }
+
+    /// \brief writes a \ref cnl::scaled_integer as characters
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \param out iterator to which the characters are written
+    /// \param spec options which control the output
+    /// \param value number to write
+    ///
+    /// \note The presentation types behave as they do for floating-point numbers:
+    /// `f` and `F` give fixed notation, `e` and `E` give scientific notation
+    /// and `a` and `A` give hexadecimal digits with a binary exponent, e.g. `"1.8p+1"`.
+    /// `f`, `F`, `e` and `E` give 6 fractional digits unless spec.precision is given.
+    /// With no type or precision, the exact value is written in fixed notation, e.g. `"-0.0078125"`,
+    /// and with `a` or `A` and no precision, every significant hexadecimal digit is written.
+    /// \note The digits are calculated exactly, using only integer arithmetic, and are rounded
+    /// to the nearest value with ties to even. They are written directly to `out` without an intermediate buffer.
+    /// \note Types `a` and `A` require that the value's radix is a power of two,
+    /// and other types require that the value's radix has no prime factors other than 2 and 5.
+    /// \return an iterator past the last character written
+    ///
+    /// \sa cnl::format, cnl::parse_format_spec
+    template<class OutputIt, typename Rep, int Exponent, int Radix>
+    constexpr auto format_to(
+            OutputIt out, format_spec const& spec, scaled_integer<Rep, power<Exponent, Radix>> const& value)
+            -> OutputIt
+    {
+        CNL_ASSERT(_impl::is_format_type_supported(spec.type, Radix));
+        CNL_ASSERT(spec.precision >= -1);
+
+        auto const& rep{_impl::to_rep(value)};
+        auto const is_negative{[&]() {
+            if constexpr (numbers::signedness_v<Rep>) {
+                return rep < Rep{0};
+            } else {
+                return false;
+            }
+        }()};
+        auto const sign{
+                is_negative                           ? _impl::minus_char
+                : (spec.sign == format_sign::plus)  ? _impl::plus_char
+                : (spec.sign == format_sign::space) ? ' '
+                                                      : '\0'};
+
+        if constexpr (Radix == 1 << _impl::radix_factor_exponent(Radix, 2)) {
+            if (spec.type == 'a' || spec.type == 'A') {
+                return _impl::format_hexadecimal<Rep, Exponent, Radix>(out, spec, sign, rep);
+            }
+        }
+        return _impl::format_decimal<Rep, Exponent, Radix>(out, spec, sign, rep);
+    }
+
+    /// \brief writes a \ref cnl::scaled_integer as characters, using a standard format specification, e.g. `"+.3e"`
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \sa cnl::parse_format_spec
+    template<class OutputIt, typename Rep, int Exponent, int Radix>
+    constexpr auto format_to(
+            OutputIt out, std::string_view spec, scaled_integer<Rep, power<Exponent, Radix>> const& value)
+            -> OutputIt
+    {
+        auto const parsed{parse_format_spec(spec)};
+        CNL_ASSERT(parsed.ec == std::errc{} && parsed.ptr == spec.end());
+        return format_to(out, parsed.spec, value);
+    }
+
+    /// \brief a \ref cnl::scaled_integer as a string, formatted as by \ref cnl::format_to
+    /// \headerfile cnl/scaled_integer.h
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] auto format(format_spec const& spec, scaled_integer<Rep, power<Exponent, Radix>> const& value)
+    {
+        auto result{std::string{}};
+        format_to(std::back_inserter(result), spec, value);
+        return result;
+    }
+
+    /// \brief a \ref cnl::scaled_integer as a string, formatted as by \ref cnl::format_to
+    /// \headerfile cnl/scaled_integer.h
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] auto format(std::string_view spec, scaled_integer<Rep, power<Exponent, Radix>> const& value)
+    {
+        auto result{std::string{}};
+        format_to(std::back_inserter(result), spec, value);
+        return result;
+    }
+}
+
+#endif  // CNL_IMPL_SCALED_INTEGER_FORMAT_H
@@ -0,0 +1,266 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief cnl::from_chars overloaded on cnl::scaled_integer
+
+#if !defined(CNL_IMPL_SCALED_INTEGER_FROM_CHARS_H)
+#define CNL_IMPL_SCALED_INTEGER_FROM_CHARS_H
+
+#include "../charconv/constants.h"
+#include "../charconv/from_chars.h"
+#include "../charconv/parse_digits.h"
+#include "../cnl_assert.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/set_digits.h"
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
+#include "definition.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // how the digits which follow a truncated value compare with half of its least significant digit
+        enum class from_chars_remainder {
+            zero,
+            below_half,
+            half,
+            above_half
+        };
+
+        template<typename Natural>
+        struct from_chars_fraction_result {
+            Natural bits;
+            from_chars_remainder remainder;
+            char const* ptr;
+        };
+
+        // the first NumBits binary digits of the fraction whose digits,
+        // in a base which is a power of two, are at the start of [first, last)
+        template<typename Natural, int NumBits>
+        [[nodiscard]] constexpr auto from_chars_binary_fraction(char const* first, char const* last, int base)
+                -> from_chars_fraction_result<Natural>
+        {
+            auto const bits_per_digit{std::countr_zero(static_cast<unsigned>(base))};
+            auto bits{Natural{0}};
+            auto num_bits{0};
+            auto half_bit{0};
+            auto sticky_bits{0};
+            for (; first != last; ++first) {
+                auto const digit{ctoi(*first, base)};
+                if (digit < 0) {
+                    break;
+                }
+                for (auto index{bits_per_digit - 1}; index >= 0; --index) {
+                    auto const bit{(digit >> index) & 1};
+                    if (num_bits < NumBits) {
+                        bits = static_cast<Natural>((bits << 1) | static_cast<Natural>(bit));
+                        ++num_bits;
+                    } else if (num_bits == NumBits) {
+                        half_bit = bit;
+                        ++num_bits;
+                    } else {
+                        sticky_bits |= bit;
+                    }
+                }
+            }
+            if (num_bits < NumBits) {
+                bits = static_cast<Natural>(bits << (NumBits - num_bits));
+            }
+
+            auto const remainder{
+                    half_bit ? (sticky_bits ? from_chars_remainder::above_half : from_chars_remainder::half)
+                             : (sticky_bits ? from_chars_remainder::below_half : from_chars_remainder::zero)};
+            return from_chars_fraction_result<Natural>{bits, remainder, first};
+        }
+
+        // the first NumBits binary digits of the fraction whose decimal digits are at the start of [first, last);
+        // the decimal digits are stored in limbs of eight digits and converted to binary
+        // by repeatedly multiplying them by up to 2^32 and collecting the carry
+        template<typename Natural, int NumBits>
+        [[nodiscard]] constexpr auto from_chars_decimal_fraction(char const* first, char const* last)
+                -> from_chars_fraction_result<Natural>
+        {
+            // every value halfway between two results has NumBits + 1 fractional decimal digits;
+            // beyond those, it only matters whether any digits are non-zero
+            constexpr auto max_digits{NumBits + 1};
+            constexpr auto limb_digits{8};
+            constexpr auto limb_radix{std::uint64_t{100'000'000}};
+            std::array<std::uint64_t, (max_digits + limb_digits - 1) / limb_digits> limbs{};
+
+            auto num_digits{0};
+            if constexpr (swar_parse_enabled) {
+                // at run time, whole limbs are parsed a block at a time
+                if (!std::is_constant_evaluated()) {
+                    while (num_digits + limb_digits <= max_digits && last - first >= limb_digits) {
+                        auto const block{parse_decimal_block<limb_digits>(first)};
+                        if (!block) {
+                            break;
+                        }
+                        limbs[num_digits / limb_digits] = *block;
+                        num_digits += limb_digits;
+                        first += limb_digits;
+                    }
+                }
+            }
+
+            auto sticky{false};
+            for (; first != last; ++first) {
+                auto const digit{ctoi(*first, 10)};
+                if (digit < 0) {
+                    break;
+                }
+                if (num_digits < max_digits) {
+                    auto& limb{limbs[num_digits / limb_digits]};
+                    limb = limb * 10 + static_cast<std::uint64_t>(digit);
+                    ++num_digits;
+                } else {
+                    sticky |= (digit != 0);
+                }
+            }
+
+            // scale the least significant limb as though it were padded with zeros
+            auto const num_limbs{(num_digits + limb_digits - 1) / limb_digits};
+            for (auto padding{num_limbs * limb_digits - num_digits}; padding; --padding) {
+                limbs[num_limbs - 1] *= 10;
+            }
+
+            auto bits{Natural{0}};
+            for (auto num_bits{0}; num_bits != NumBits;) {
+                auto const step{std::min(32, NumBits - num_bits)};
+                auto carry{std::uint64_t{0}};
+                for (auto index{num_limbs - 1}; index >= 0; --index) {
+                    auto const product{(limbs[index] << step) + carry};
+                    limbs[index] = product % limb_radix;
+                    carry = product / limb_radix;
+                }
+                bits = static_cast<Natural>(static_cast<Natural>(bits << step) | static_cast<Natural>(carry));
+                num_bits += step;
+            }
+
+            constexpr auto half_limb{limb_radix / 2};
+            auto const is_rest_zero{!sticky && std::all_of(limbs.begin() + 1, limbs.end(), [](auto limb) {
+                return limb == 0;
+            })};
+            auto const remainder{
+                    (limbs[0] > half_limb)   ? from_chars_remainder::above_half
+                    : (limbs[0] == half_limb) ? (is_rest_zero ? from_chars_remainder::half
+                                                              : from_chars_remainder::above_half)
+                    : (limbs[0] == 0 && is_rest_zero) ? from_chars_remainder::zero
+                                                      : from_chars_remainder::below_half};
+            return from_chars_fraction_result<Natural>{bits, remainder, first};
+        }
+
+        template<typename Natural, int NumBits>
+        [[nodiscard]] constexpr auto from_chars_fraction(char const* first, char const* last, int base)
+        {
+            return (base == 10) ? from_chars_decimal_fraction<Natural, NumBits>(first, last)
+                                : from_chars_binary_fraction<Natural, NumBits>(first, last, base);
+        }
+
+        // how value * 2^-Exponent + fraction compares with half of the least significant digit retained,
+        // where value is a natural number and fraction is in the range [0, 1)
+        template<int Exponent, typename Natural>
+        [[nodiscard]] constexpr auto from_chars_discarded(Natural const& value, from_chars_remainder fraction)
+        {
+            if constexpr (Exponent == 0) {
+                return fraction;
+            } else {
+                auto const discarded{static_cast<Natural>(value & static_cast<Natural>((Natural{1} << Exponent) - 1))};
+                auto const half{static_cast<Natural>(Natural{1} << (Exponent - 1))};
+                if (discarded == half) {
+                    return (fraction == from_chars_remainder::zero) ? from_chars_remainder::half
+                                                                    : from_chars_remainder::above_half;
+                }
+                if (discarded > half) {
+                    return from_chars_remainder::above_half;
+                }
+                return (discarded == Natural{0} && fraction == from_chars_remainder::zero)
+                             ? from_chars_remainder::zero
+                             : from_chars_remainder::below_half;
+            }
+        }
+    }
+
+    /// \brief partial implementation of std::from_chars overloaded on \ref cnl::scaled_integer
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \param first beginning of the characters to parse
+    /// \param last end of the characters to parse
+    /// \param value number to which the result is assigned on success
+    /// \param base number base of the digits; one of 2, 8, 10 and 16
+    ///
+    /// \note The characters are expected to be digits with an optional radix point, e.g. "-12.375".
+    /// As with std::from_chars, a minus sign is only accepted if `value` is signed,
+    /// and neither a plus sign nor a base prefix is accepted. Exponents are not accepted.
+    /// \note The result is the nearest value to the characters, with ties rounded to even,
+    /// and is calculated using only integer arithmetic.
+    /// \return a `std::from_chars_result` with the same semantics as the result of std::from_chars
+
+    template<typename Rep, int Exponent>
+    [[nodiscard]] constexpr auto from_chars(
+            char const* const first, char const* const last, scaled_integer<Rep, power<Exponent>>& value,
+            int base = 10)
+    {
+        CNL_ASSERT(base == 2 || base == 8 || base == 10 || base == 16);
+
+        // wide enough to hold the integer part of any representable value and any retained fractional digits
+        constexpr auto rep_width{digits_v<Rep> + numbers::signedness_v<Rep>};
+        constexpr auto fraction_bits{std::max(0, -Exponent)};
+        using natural = set_digits_t<
+                numbers::set_signedness_t<Rep, false>, std::max(rep_width + std::max(0, Exponent), fraction_bits)>;
+        constexpr auto max_natural{std::numeric_limits<natural>::max()};
+
+        auto const is_negative{_impl::from_chars_is_negative<Rep>(first, last)};
+        auto const digits_first{first + is_negative};
+        auto const integer{_impl::from_chars_natural(digits_first, last, max_natural, base)};
+        auto const has_radix{integer.ptr != last && *integer.ptr == _impl::radix_char};
+        auto const fraction_first{integer.ptr + has_radix};
+        auto const fraction{_impl::from_chars_fraction<natural, fraction_bits>(fraction_first, last, base)};
+        if (integer.ptr == digits_first && fraction.ptr == fraction_first) {
+            return std::from_chars_result{first, std::errc::invalid_argument};
+        }
+
+        auto is_overflow{integer.is_overflow};
+        auto magnitude{natural{0}};
+        auto remainder{fraction.remainder};
+        if constexpr (Exponent >= 0) {
+            magnitude = static_cast<natural>(integer.value >> Exponent);
+            remainder = _impl::from_chars_discarded<Exponent>(integer.value, fraction.remainder);
+        } else if constexpr (fraction_bits >= digits_v<natural>) {
+            is_overflow |= (integer.value != natural{0});
+            magnitude = fraction.bits;
+        } else {
+            is_overflow |= (integer.value > static_cast<natural>(max_natural >> fraction_bits));
+            magnitude = static_cast<natural>(static_cast<natural>(integer.value << fraction_bits) | fraction.bits);
+        }
+
+        if (remainder == _impl::from_chars_remainder::above_half
+            || (remainder == _impl::from_chars_remainder::half && (magnitude & natural{1}))) {
+            is_overflow |= (magnitude == max_natural);
+            ++magnitude;
+        }
+
+        if (is_overflow || magnitude > static_cast<natural>(_impl::max_magnitude<Rep>(is_negative))) {
+            return std::from_chars_result{fraction.ptr, std::errc::result_out_of_range};
+        }
+
+        value = _impl::from_rep<scaled_integer<Rep, power<Exponent>>>(
+                _impl::from_magnitude<Rep>(magnitude, is_negative));
+        return std::from_chars_result{fraction.ptr, std::errc{}};
+    }
+}
+
+#endif  // CNL_IMPL_SCALED_INTEGER_FROM_CHARS_H
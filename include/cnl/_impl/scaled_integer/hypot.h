@@ -0,0 +1,112 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SCALED_INTEGER_HYPOT_H)
+#define CNL_IMPL_SCALED_INTEGER_HYPOT_H
+
+#include "../cmath/sqrt.h"
+#include "../duplex_integer.h"
+#include "../duplex_integer/long_divide.h"
+#include "../duplex_integer/multiply.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../num_traits/width.h"
+#include "definition.h"
+#include "extras.h"
+#include "series.h"
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        namespace fp {
+            // floor(sqrt(upper:lower)) where upper is non-zero;
+            // a table-seeded estimate of the root of the upper digits is refined
+            // with a single Newton-Raphson iteration and then corrected exactly
+            [[nodiscard]] constexpr auto long_sqrt(std::uint64_t upper, std::uint64_t lower) -> std::uint64_t
+            {
+                using word = std::uint64_t;
+
+                // even shift which leaves the upper 63 or 64 digits in top
+                auto const shift{(static_cast<int>(std::bit_width(upper)) + 1) & ~1};
+                auto const top{(shift == 64) ? upper : static_cast<word>((upper << (64 - shift)) | (lower >> shift))};
+
+                // (sqrt(top) + 1) * 2^(shift/2) - 1 >= floor(sqrt(upper:lower)), modulo 2^64
+                auto const estimate{static_cast<word>(((newton_sqrt(top) + word{1}) << (shift / 2)) - word{1})};
+                auto const quotient{long_divide(upper, lower, estimate).quotient};
+                auto root{static_cast<word>((estimate >> 1) + (quotient >> 1) + (estimate & quotient & 1))};
+
+                auto const exceeds = [&](word const& r) {
+                    auto const square{long_multiply<word>{}(r, r)};
+                    auto const square_upper{long_product_upper<word>(square)};
+                    return square_upper > upper || (square_upper == upper && static_cast<word>(square) > lower);
+                };
+                while (exceeds(root)) {
+                    --root;
+                }
+                return root;
+            }
+
+            // round(sqrt(x*x + y*y))
+            template<int MagnitudeDigits>
+            [[nodiscard]] constexpr auto hypot_magnitude(std::uint64_t x, std::uint64_t y) -> std::uint64_t
+            {
+                using word = std::uint64_t;
+
+                if constexpr (MagnitudeDigits <= 31) {
+                    auto const sum{static_cast<word>(x * x + y * y)};
+                    auto const root{newton_sqrt(sum)};
+                    return root + word{sum - root * root > root};
+                } else {
+                    auto const x_squared{long_multiply<word>{}(x, x)};
+                    auto const y_squared{long_multiply<word>{}(y, y)};
+                    auto const lower{static_cast<word>(static_cast<word>(x_squared) + static_cast<word>(y_squared))};
+                    auto const upper{static_cast<word>(
+                            long_product_upper<word>(x_squared) + long_product_upper<word>(y_squared)
+                            + word{lower < static_cast<word>(y_squared)})};
+
+                    auto const root{upper ? long_sqrt(upper, lower) : newton_sqrt(lower)};
+
+                    // the remainder, upper:lower - root*root, is compared with root
+                    auto const square{long_multiply<word>{}(root, root)};
+                    auto const remainder_lower{static_cast<word>(lower - static_cast<word>(square))};
+                    auto const remainder_upper{static_cast<word>(
+                            upper - long_product_upper<word>(square) - word{lower < static_cast<word>(square)})};
+                    return root + word{remainder_upper != 0 || remainder_lower > root};
+                }
+            }
+        }
+    }
+
+    /// \brief square root of the sum of the squares of two \ref scaled_integer values
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Where `Rep` is a fundamental integer of up to 64 bits, the result is calculated
+    /// using only integer arithmetic and is rounded to the nearest multiple of `Radix^Exponent`,
+    /// i.e. it is within 0.5 ULP of the exact value.
+    /// Otherwise, `x` and `y` are converted to and from a floating-point type.
+    /// \pre The result must be representable in the type of `x` and `y`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto hypot(
+            scaled_integer<Rep, power<Exponent, Radix>> const& x,
+            scaled_integer<Rep, power<Exponent, Radix>> const& y) noexcept
+    {
+        using result_type = scaled_integer<Rep, power<Exponent, Radix>>;
+        if constexpr (std::integral<Rep> && _impl::width<Rep> <= 64) {
+            return _impl::from_rep<result_type>(static_cast<Rep>(_impl::fp::hypot_magnitude<digits_v<Rep>>(
+                    _impl::fp::magnitude(_impl::to_rep(x)), _impl::fp::magnitude(_impl::to_rep(y)))));
+        } else {
+            using fp = _impl::float_of_same_size<Rep>;
+            return static_cast<result_type>(std::hypot(static_cast<fp>(x), static_cast<fp>(y)));
+        }
+    }
+}
+
+#endif  // CNL_IMPL_SCALED_INTEGER_HYPOT_H
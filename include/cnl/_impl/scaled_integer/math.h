@@ -1,20 +1,34 @@
-
 //          Copyright Timo Alho 2016.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file ../LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 /// \file
-/// \brief some cmath specializations for `cnl::scaled_integer` type;
+/// \brief exponential and logarithmic functions of `cnl::scaled_integer` which use only integer arithmetic
 
 #if !defined(CNL_IMPL_SCALED_INTEGER_MATH_H)
 #define CNL_IMPL_SCALED_INTEGER_MATH_H
 
+#include "../cnl_assert.h"
+#include "../duplex_integer.h"
+#include "../duplex_integer/multiply.h"
+#include "../num_traits/digits.h"
 #include "../num_traits/from_rep.h"
 #include "../num_traits/to_rep.h"
+#include "../num_traits/width.h"
 #include "definition.h"
-#include "rep_of.h"
-#include "tag_of.h"
+#include "extras.h"
+#include "series.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
 
 /// compositional numeric library
 namespace cnl {
@@ -24,176 +38,490 @@ namespace cnl {
 
     namespace _impl {
         namespace fp {
+            // true iff the exponential and logarithmic functions of scaled_integer<Rep, power<Exponent, Radix>>
+            // can be calculated using the integer arithmetic below
+            template<typename Rep, int Exponent, int Radix>
+            inline constexpr auto is_integer_exp_log_compatible =
+                    std::integral<Rep> && Radix == 2 && width<Rep> <= 64 && -64 < Exponent && Exponent < 32;
+
+            // the number of significant digits to which exponentials are calculated;
+            // the degree of the polynomial grows with the digits of the result
+            template<typename Rep>
+            inline constexpr auto exp_digits{std::min(digits_v<Rep> + 3, 60)};
+
+            // the word in which exponentials of scaled_integer<Rep, power<Exponent>> are calculated
+            template<typename Rep, int Exponent>
+            using exp_word =
+                    std::conditional_t<(exp_digits<Rep> <= 26 && Exponent > -32), std::uint32_t, std::uint64_t>;
+
+            // the number of fractional digits to which logarithms are calculated
+            // in order for the result, a multiple of 2^Exponent, to be within one ULP
+            template<int Exponent>
+            inline constexpr auto log_digits{std::clamp(3 - Exponent, 3, 60)};
+
+            // the word in which logarithms of scaled_integer<Rep, power<Exponent>> are calculated
+            template<typename Rep, int Exponent>
+            using log_word = std::conditional_t<
+                    (width<Rep> <= 32 && log_digits<Exponent> <= 26), std::uint32_t, std::uint64_t>;
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // constants
+
+            // a constant in the range [0, 2) with 127 fractional digits
+            struct q127 {
+                std::uint64_t upper;
+                std::uint64_t lower;
+            };
+
+            inline constexpr q127 ln2_q127{0x58B90BFBE8E7BCD5, 0xE4F1D9CC01F97B58};
+            inline constexpr q127 log2e_q127{0xB8AA3B295C17F0BB, 0xBE87FED0691D3E89};
 
-            template<class ScaledInteger>
-            [[nodiscard]] constexpr auto rounding_conversion(double d)
+            // value * constant with q_digits<Word> fractional digits
+            template<std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto multiply_q127(Word value, q127 const& constant) -> double_word<Word>
             {
-                using one_longer = scaled_integer<
-                        set_digits_t<rep_of_t<ScaledInteger>, digits_v<ScaledInteger> + 1>,
-                        power<tag_of_t<ScaledInteger>::exponent - 1>>;
-                return from_rep<ScaledInteger>(
-                        static_cast<rep_of_t<ScaledInteger>>((_impl::to_rep(one_longer{d}) + 1) >> 1));
+                // the most significant width<Word> * 2 digits of the constant
+                constexpr auto upper_shift{64 - width<Word>};
+                auto const upper{static_cast<Word>(constant.upper >> upper_shift)};
+                auto const lower{static_cast<Word>(upper_shift ? constant.upper : constant.lower)};
+
+                return long_multiply<Word>{}(value, upper)
+                     + double_word<Word>{long_product_upper<Word>(long_multiply<Word>{}(value, lower))};
             }
 
-            template<class ScaledInteger>
-            using unsigned_rep = typename std::make_unsigned<rep_of_t<ScaledInteger>>::type;
-
-            template<class Input>
-            using make_largest_ufraction =
-                    scaled_integer<unsigned_rep<Input>, power<-digits_v<unsigned_rep<Input>>>>;
-
-            static_assert(
-                    std::is_same<
-                            make_largest_ufraction<scaled_integer<int32_t, power<-15>>>,
-                            scaled_integer<uint32_t, power<-32>>>::value);
-
-            // TODO: template magic to get the coefficients automatically
-            // from the number of bits of precision
-            // Define the coefficients as [[nodiscard]] constexpr,
-            // to make sure they're converted to fp
-            // at compile time
-            template<class CoeffType>
-            struct poly_coeffs {
-                static constexpr CoeffType a1{rounding_conversion<CoeffType>(0.6931471860838825)};
-                static constexpr CoeffType a2{rounding_conversion<CoeffType>(0.2402263846181129)};
-                static constexpr CoeffType a3{rounding_conversion<CoeffType>(0.055505126858894846)};
-                static constexpr CoeffType a4{rounding_conversion<CoeffType>(0.009614017013719252)};
-                static constexpr CoeffType a5{
-                        rounding_conversion<CoeffType>(0.0013422634797558564)};
-                static constexpr CoeffType a6{
-                        rounding_conversion<CoeffType>(0.00014352314226313836)};
-                static constexpr CoeffType a7{
-                        rounding_conversion<CoeffType>(0.000021498763160402416)};
-            };
+            template<std::unsigned_integral Word>
+            inline constexpr auto ln2{narrow_q<Word>(ln2_q127.upper)};
+
+            template<std::unsigned_integral Word>
+            inline constexpr auto log2e{narrow_q<Word>(log2e_q127.upper)};
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // exp2 and exp
+
+            // round(2^(i/32) * 2^63) for every i in [0, 32)
+            inline constexpr std::array<std::uint64_t, 32> exp2_thirty_seconds_q63{
+                    0x8000000000000000, 0x82CD8698AC2BA1D7, 0x85AAC367CC487B15, 0x88980E8092DA8527,
+                    0x8B95C1E3EA8BD6E7, 0x8EA4398B45CD53C0, 0x91C3D373AB11C336, 0x94F4EFA8FEF70961,
+                    0x9837F0518DB8A96F, 0x9B8D39B9D54E5539, 0x9EF5326091A111AE, 0xA27043030C496819,
+                    0xA5FED6A9B15138EA, 0xA9A15AB4EA7C0EF8, 0xAD583EEA42A14AC6, 0xB123F581D2AC2590,
+                    0xB504F333F9DE6484, 0xB8FBAF4762FB9EE9, 0xBD08A39F580C36BF, 0xC12C4CCA66709456,
+                    0xC5672A115506DADD, 0xC9B9BD866E2F27A3, 0xCE248C151F8480E4, 0xD2A81D91F12AE45A,
+                    0xD744FCCAD69D6AF4, 0xDBFBB797DAF23755, 0xE0CCDEEC2A94E111, 0xE5B906E77C8348A8,
+                    0xEAC0C6E7DD24392F, 0xEFE4B99BDCDAF5CB, 0xF5257D152486CC2C, 0xFA83B2DB722A033A};
 
-            template<typename A, typename B>
-            [[nodiscard]] constexpr auto safe_multiply(A const& a, B const& b) requires(digits_v<decltype(a * b)> <= digits_v<A> + digits_v<B>)
+            template<std::unsigned_integral Word>
+            inline constexpr auto exp2_thirty_seconds{narrow_q<Word>(exp2_thirty_seconds_q63)};
+
+            // (ln(2)/32)^k / k! for every k in [1, 17) with width<Word> fractional digits,
+            // i.e. the coefficients of the Taylor series of 2^(u/32) - 1
+            template<std::unsigned_integral Word>
+            inline constexpr auto exp2_coefficients{[]() {
+                constexpr auto shift{68 - width<Word>};
+                std::array<Word, 16> coefficients{};
+                coefficients[0] = static_cast<Word>(((ln2_q127.upper >> (shift - 1)) + 1) >> 1);
+                for (auto k{2}; k <= int(coefficients.size()); ++k) {
+                    auto const divisor{static_cast<Word>(k)};
+                    auto const product{long_product_upper<Word>(
+                            long_multiply<Word>{}(coefficients[k - 2], coefficients[0]))};
+                    coefficients[k - 1] = static_cast<Word>((product + divisor / 2) / divisor);
+                }
+                return coefficients;
+            }()};
+
+            // number of terms of the series of 2^(u/32) - 1 needed to bring the truncation error below 2^-Digits
+            template<std::unsigned_integral Word, int Digits>
+            inline constexpr auto exp2_num_terms{[]() {
+                static_assert(Digits < width<Word>);
+                auto terms{0};
+                while (exp2_coefficients<Word>[terms] >= (Word{1} << (width<Word> - Digits))) {
+                    ++terms;
+                }
+                return terms;
+            }()};
+
+            // sum of exp2_coefficients<Word>[k] * u^(k + 1) for k in [0, Terms) using Estrin's scheme;
+            // pairs of terms are combined independently so that the chain of dependent multiplications
+            // is logarithmic, rather than linear, in the number of terms
+            template<std::unsigned_integral Word, int Terms>
+            [[nodiscard]] constexpr auto exp2_polynomial(Word u) -> Word
             {
-                return set_digits_t<A, digits_v<A> + digits_v<B>>{a}
-                     * set_digits_t<B, digits_v<A> + digits_v<B>>{b};
+                auto const multiply_upper = [](Word const& lhs, Word const& rhs) {
+                    return long_product_upper<Word>(long_multiply<Word>{}(lhs, rhs));
+                };
+
+                std::array<Word, Terms> sums{};
+                for (auto k{0}; k != Terms; ++k) {
+                    sums[k] = exp2_coefficients<Word>[k];
+                }
+
+                auto u_power{u};
+                for (auto size{Terms}; size > 1; size = (size + 1) / 2) {
+                    for (auto k{0}; k != size / 2; ++k) {
+                        sums[k] = static_cast<Word>(sums[k * 2] + multiply_upper(u_power, sums[k * 2 + 1]));
+                    }
+                    if (size % 2) {
+                        sums[size / 2] = sums[size - 1];
+                    }
+                    if (size > 2) {
+                        u_power = multiply_upper(u_power, u_power);
+                    }
+                }
+                return multiply_upper(u, sums[0]);
             }
 
-            template<typename A, typename B>
-            [[nodiscard]] constexpr auto safe_multiply(A const& a, B const& b) requires(digits_v<A> + digits_v<B> <= digits_v<decltype(a * b)>)
+            // 2^x, in the range [1, 2), where x is in the range [0, 1);
+            // 2^x = 2^(i/32) * 2^(u/32) where i/32 is the greatest thirty-second not exceeding x;
+            // every term of the polynomial in u, which is in the range [0, 1), is a pure fraction
+            template<std::unsigned_integral Word, int Digits>
+            [[nodiscard]] constexpr auto exp2_fraction(Word x) -> Word
             {
-                return a * b;
+                auto const index{x >> (width<Word> - 6)};
+                auto const u{static_cast<Word>(x << 6)};
+                auto const polynomial{exp2_polynomial<Word, exp2_num_terms<Word, Digits>>(u)};
+
+                // saturate in the unlikely event that the result rounds up to two
+                auto const table_value{exp2_thirty_seconds<Word>[index]};
+                auto const result{static_cast<Word>(
+                        table_value + long_product_upper<Word>(long_multiply<Word>{}(table_value, polynomial)))};
+                return (result < table_value) ? static_cast<Word>(~Word{0}) : result;
             }
 
-            template<class Rep, int Exponent>
-            [[nodiscard]] inline constexpr auto evaluate_polynomial(
-                    scaled_integer<Rep, power<Exponent>> xf)
+            // any exponent of greater magnitude results in overflow or zero
+            inline constexpr auto max_exp2_integer{256};
+
+            // 2^(integer + fraction * 2^-q_digits<Word>), rounded to the nearest multiple of 2^Exponent
+            template<typename Rep, int Exponent, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto exp2_rep(int integer, Word fraction) -> Rep
             {
-                using fp = scaled_integer<Rep, power<Exponent>>;
-
-                // Use a polynomial min-max approximation to generate the exponential of
-                // the fraction part. Note that the constant 1 of the polynomial is added later,
-                // this gives us one more bit of precision here for free
-                using coeffs = poly_coeffs<fp>;
-                return fp{safe_multiply(
-                        xf,
-                        (coeffs::a1
-                         + fp{safe_multiply(
-                                 xf,
-                                 (coeffs::a2
-                                  + fp{safe_multiply(
-                                          xf,
-                                          (coeffs::a3
-                                           + fp{safe_multiply(
-                                                   xf,
-                                                   (coeffs::a4
-                                                    + fp{safe_multiply(
-                                                            xf,
-                                                            (coeffs::a5
-                                                             + fp{safe_multiply(
-                                                                     xf,
-                                                                     (coeffs::a6
-                                                                      + fp{safe_multiply(
-                                                                              coeffs::a7,
-                                                                              xf)}))}))}))}))}))}))};
+                auto const mantissa{std::uint64_t{exp2_fraction<Word, exp_digits<Rep>>(fraction)}};
+
+                // mantissa * 2^(integer - Exponent - q_digits<Word>), rounded
+                auto const shift{q_digits<Word> + Exponent - integer};
+                if (shift <= 0) {
+                    return static_cast<Rep>((shift > -64) ? mantissa << -shift : std::uint64_t{0});
+                }
+                if (shift > width<Word>) {
+                    return Rep{0};
+                }
+                return static_cast<Rep>(((mantissa >> (shift - 1)) + 1) >> 1);
             }
 
-            // Computes 2^x - 1 for a number x between 0 and 1, strictly less than 1
-            // If the exponent is not negative, there is no fraction part,
-            // so this is always zero
-            template<class Rep, int Exponent>
-            [[nodiscard]] inline constexpr auto exp2m1_0to1(scaled_integer<Rep, power<Exponent>>) requires(Exponent >= 0)
+            // 2^(magnitude * 2^-FractionDigits), or its reciprocal if is_negative,
+            // rounded to the nearest multiple of 2^Exponent
+            template<typename Rep, int Exponent, int FractionDigits, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto exp2_rep(double_word<Word> const& magnitude, bool is_negative) -> Rep
             {
-                // Cannot construct from 0, since that would be a shift by more than width of type!
-                return from_rep<make_largest_ufraction<scaled_integer<Rep, power<Exponent>>>>(0);
+                using wide = double_word<Word>;
+                static_assert(0 <= FractionDigits && FractionDigits < width<Word> * 2);
+
+                auto const integer_part{magnitude >> FractionDigits};
+                auto const integer{
+                        (integer_part > wide{max_exp2_integer}) ? max_exp2_integer
+                                                                : static_cast<int>(static_cast<Word>(integer_part))};
+
+                // the most significant q_digits<Word> digits of the fractional part
+                constexpr auto fraction_mask{static_cast<Word>(q_one<Word> - Word{1})};
+                Word fraction{};
+                if constexpr (FractionDigits >= q_digits<Word>) {
+                    fraction = static_cast<Word>(
+                            static_cast<Word>(magnitude >> (FractionDigits - q_digits<Word>)) & fraction_mask);
+                } else {
+                    fraction = static_cast<Word>(
+                            static_cast<Word>(static_cast<Word>(magnitude) << (q_digits<Word> - FractionDigits))
+                            & fraction_mask);
+                }
+
+                // 2^-(i + f) = 2^(-i - 1) * 2^(1 - f)
+                if (is_negative && fraction != Word{0}) {
+                    return exp2_rep<Rep, Exponent>(-integer - 1, static_cast<Word>(q_one<Word> - fraction));
+                }
+                return exp2_rep<Rep, Exponent>(is_negative ? -integer : integer, fraction);
             }
 
-            // for a positive exponent, some work needs to be done
-            template<class Rep, int Exponent>
-            [[nodiscard]] inline constexpr auto exp2m1_0to1(scaled_integer<Rep, power<Exponent>> x) requires(Exponent < 0)
+            template<typename Rep, int Exponent>
+            [[nodiscard]] constexpr auto exp2(scaled_integer<Rep, power<Exponent>> const& x)
             {
-                // Build the type with the same number of bits, all fraction,
-                // and unsigned. That should be enough to exactly hold enough bits
-                // to guarantee bit-accurate results
-                using im = make_largest_ufraction<scaled_integer<Rep, power<Exponent>>>;
-                // The intermediate value type
+                using word = exp_word<Rep, Exponent>;
+                auto const rep{_impl::to_rep(x)};
+                if constexpr (Exponent < 0) {
+                    // floor(x) and x - floor(x)
+                    using signed_rep = std::conditional_t<std::signed_integral<Rep>, std::int64_t, std::uint64_t>;
+                    auto const integer{static_cast<signed_rep>(rep) >> -Exponent};
+                    auto const fraction{static_cast<word>(
+                            static_cast<word>(static_cast<word>(rep) << (q_digits<word> + Exponent))
+                            & static_cast<word>(q_one<word> - word{1}))};
+                    return from_rep<scaled_integer<Rep, power<Exponent>>>(exp2_rep<Rep, Exponent>(
+                            static_cast<int>(std::clamp(
+                                    integer, static_cast<signed_rep>(std::signed_integral<Rep> ? -max_exp2_integer : 0),
+                                    static_cast<signed_rep>(max_exp2_integer))),
+                            fraction));
+                } else {
+                    auto const exponent{double_word<word>{static_cast<word>(magnitude(rep))} << q_digits<word>};
+                    return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                            exp2_rep<Rep, Exponent, q_digits<word> - Exponent, word>(exponent, is_negative(rep)));
+                }
+            }
 
-                return evaluate_polynomial(im{scaled_integer<rep_of_t<im>, power<Exponent>>{x}});
+            template<typename Rep, int Exponent>
+            [[nodiscard]] constexpr auto exp(scaled_integer<Rep, power<Exponent>> const& x)
+            {
+                using word = exp_word<Rep, Exponent>;
+                auto const rep{_impl::to_rep(x)};
+                auto const exponent{multiply_q127(static_cast<word>(magnitude(rep)), log2e_q127)};
+                return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                        exp2_rep<Rep, Exponent, q_digits<word> - Exponent, word>(exponent, is_negative(rep)));
             }
 
-            template<class Rep, int Exponent, int Radix>
-            requires(-digits_v<Rep> < Exponent)
-                    [[nodiscard]] constexpr auto fractional(
-                            scaled_integer<Rep, power<Exponent, Radix>> const& x,
-                            Rep const& floored)
+            ////////////////////////////////////////////////////////////////////////////////
+            // log2 and log
+
+            // ceil(2^16 / (1 + i/64)) / 2^16, the reciprocal of the least significand in each of 64 intervals in [1, 2),
+            // rounded up to a short fraction for every i in [0, 64)
+            template<std::unsigned_integral Word>
+            inline constexpr auto log2_reciprocals{[]() {
+                std::array<Word, 64> reciprocals{};
+                for (auto i{0}; i != int(reciprocals.size()); ++i) {
+                    auto const divisor{static_cast<Word>(64 + i)};
+                    reciprocals[i] = static_cast<Word>(
+                            ((Word{1} << 22) + divisor - Word{1}) / divisor << (q_digits<Word> - 16));
+                }
+                return reciprocals;
+            }()};
+
+            // round(-log2(r) * 2^63) for every r in log2_reciprocals
+            inline constexpr std::array<std::uint64_t, 64> log2_reciprocals_q63{
+                    0x0000000000000000, 0x02DCC4A62F553F0E, 0x05AE01F8D115F9A2, 0x087545C019DE1798,
+                    0x0B31EFF2C1334A97, 0x0DE35CEBE035B7E8, 0x108C0D87C1AE1E2E, 0x132AAD4AA7356FBA,
+                    0x15BF78A54EC35874, 0x184B8758DB8FF543, 0x1ACF30032BE78DCD, 0x1D49216FCA59BA4C,
+                    0x1FBB6999BC17E015, 0x22259C4B652E428E, 0x24874B21A56E4DBB, 0x26E1CD8B138A2952,
+                    0x2934C26D11320FDA, 0x2B7FC6CF0519755C, 0x2DC3628C4B245234, 0x300116D652E2C0B7,
+                    0x3236B0DDC78DEC20, 0x3466AF7D2D47F6D6, 0x368FD2291F430BAE, 0x38B1C66D990A68DD,
+                    0x3ACE345624EB74F4, 0x3CE3D75A6BE11161, 0x3EF4693CE8FA6E71, 0x40FEA5F9E7C5D785,
+                    0x43034FCEE24A7418, 0x4502271E7FDD3E63, 0x46FBFA8094FF7CEE, 0x48F09103B49D3F66,
+                    0x4ADFB0C7F76BD577, 0x4CC91F091F178F8A, 0x4EADBAEBF78643DF, 0x508E6E4D51D11C0A,
+                    0x5268CC30AB6ED4A5, 0x544000DC597055D9, 0x56119AF56FE1352B, 0x57DE8CEBE57D52B8,
+                    0x59A7D40E951E2912, 0x5B6C1AA4BF9961FE, 0x5D2C627EA11FEC75, 0x5EE74EE64B0C38D4,
+                    0x609F1DE303818255, 0x6253AF0192B926DF, 0x6402667F0B56182D, 0x65AED25DF92B93A0,
+                    0x675652F6B7437646, 0x68FB493E80EEC580, 0x6A9B09122E39AE8A, 0x6C37FE09A1AE0418,
+                    0x6DD20CFD8B97DB8E, 0x6F67C8C60A202D42, 0x70FA613B91C533A1, 0x728862A69D1488C2,
+                    0x74145C1FEB0F2AA1, 0x759CDC168ABF92F1, 0x7721C51852C2824E, 0x78A2F95CF13A9227,
+                    0x7A21C08F9F55E43B, 0x7B9E04EA66A58C78, 0x7D1644CBB72B770B, 0x7E8BCF9AC3B2ABB7};
+
+            template<std::unsigned_integral Word>
+            inline constexpr auto minus_log2_reciprocals{narrow_q<Word>(log2_reciprocals_q63)};
+
+            // a base-2 logarithm as the sum of an integer and a fraction in the range [0, 1]
+            template<std::unsigned_integral Word>
+            struct logarithm {
+                int integer;
+                Word fraction;
+            };
+
+            // log2(magnitude * 2^Exponent) where magnitude is non-zero;
+            // the significand, m, is multiplied by r, the tabulated reciprocal of its interval,
+            // so that log2(m) = -log2(r) + log2(e) * ln(1 + t) where t = m * r - 1 is in the range [0, 1/60)
+            template<std::unsigned_integral Word, int Digits, int Exponent>
+            [[nodiscard]] constexpr auto log2_parts(std::uint64_t magnitude) -> logarithm<Word>
             {
-                return x - floored;
+                auto const magnitude_width{static_cast<int>(std::bit_width(magnitude))};
+                auto const significand{static_cast<Word>(
+                        (magnitude_width > width<Word>) ? magnitude >> (magnitude_width - width<Word>)
+                                                        : magnitude << (width<Word> - magnitude_width))};
+
+                auto const index{(significand >> (width<Word> - 7)) & Word{63}};
+                auto const t{static_cast<Word>(multiply_q(significand, log2_reciprocals<Word>[index]) - q_one<Word>)};
+
+                constexpr auto terms{num_terms<Digits, 1, 1>(inverse<Word>, Word{q_one<Word> / 60})};
+                auto const log_1_plus_t{multiply_q(t, alternating_series<terms, 1, 1>(inverse<Word>, t))};
+                auto const fraction{static_cast<Word>(
+                        minus_log2_reciprocals<Word>[index] + multiply_q(log_1_plus_t, log2e<Word>))};
+                return logarithm<Word>{magnitude_width - 1 + Exponent, fraction};
             }
 
-            template<class Rep, int Exponent, int Radix>
-            requires(-digits_v<Rep> >= Exponent)
-                    [[nodiscard]] constexpr auto fractional(scaled_integer<Rep, power<Exponent, Radix>> const& x, Rep const&)
+            template<typename Rep, int Exponent>
+            [[nodiscard]] constexpr auto log2(scaled_integer<Rep, power<Exponent>> const& x)
             {
-                return x;
+                using word = log_word<Rep, Exponent>;
+                using wide = double_word<word>;
+                auto const parts{
+                        log2_parts<word, log_digits<Exponent>, Exponent>(magnitude(_impl::to_rep(x)))};
+
+                // integer + fraction with q_digits<word> fractional digits
+                auto const is_negative{parts.integer < 0};
+                auto const integer{
+                        wide{static_cast<word>(is_negative ? -parts.integer : parts.integer)} << q_digits<word>};
+                auto const result{is_negative ? integer - wide{parts.fraction} : integer + wide{parts.fraction}};
+                return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                        round_to_rep<Rep, Exponent, q_digits<word>>(result, is_negative));
             }
 
-            template<class Intermediate, typename Rep, int Exponent>
-            [[nodiscard]] constexpr auto exp2(
-                    scaled_integer<Rep, power<Exponent>> const& x, Rep const& floored)
+            template<typename Rep, int Exponent>
+            [[nodiscard]] constexpr auto log(scaled_integer<Rep, power<Exponent>> const& x)
             {
-                return floored <= Exponent
-                             ? rep_of_t<Intermediate>{1}  // return immediately if the shift would
-                             // result in all bits being shifted out
-                             // Do the shifts manually. Once the branch with shift operators is
-                             // merged, could use those
-                             : (_impl::to_rep(exp2m1_0to1<Rep, Exponent>(fractional(
-                                        x,
-                                        floored)))  // Calculate the exponent of the fraction part
-                                >> (-tag_of_t<Intermediate>::exponent + Exponent
-                                    - floored))  // shift it to the right place
-                                       + (Rep{1}
-                                          << (floored
-                                              - Exponent));  // The constant term must be one, to
-                // make integer powers correct
+                using word = log_word<Rep, Exponent>;
+                using wide = double_word<word>;
+                auto const parts{
+                        log2_parts<word, log_digits<Exponent>, Exponent>(magnitude(_impl::to_rep(x)))};
+
+                // (integer + fraction) * ln(2) with q_digits<word> fractional digits
+                auto const is_negative{parts.integer < 0};
+                auto const integer{multiply_q127(
+                        static_cast<word>(is_negative ? -parts.integer : parts.integer), ln2_q127)};
+                auto const fraction{wide{multiply_q(parts.fraction, ln2<word>)}};
+                auto const result{is_negative ? integer - fraction : integer + fraction};
+                return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                        round_to_rep<Rep, Exponent, q_digits<word>>(result, is_negative));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // pow
+
+            template<typename Rep, int Exponent>
+            [[nodiscard]] constexpr auto pow(
+                    scaled_integer<Rep, power<Exponent>> const& x, scaled_integer<Rep, power<Exponent>> const& y)
+            {
+                using word = std::uint64_t;
+                using result_type = scaled_integer<Rep, power<Exponent>>;
+                auto const x_rep{_impl::to_rep(x)};
+                if (!x_rep) {
+                    return from_rep<result_type>(Rep{0});
+                }
+
+                // log2(x) with the digits needed for |log2(x)| < 128
+                constexpr auto log_fraction_digits{q_digits<word> - 7};
+                auto const parts{log2_parts<word, log_digits<-q_digits<word>>, Exponent>(magnitude(x_rep))};
+                auto const is_log_negative{parts.integer < 0};
+                auto const log_integer{
+                        static_cast<word>(is_log_negative ? -parts.integer : parts.integer) << log_fraction_digits};
+                auto const log_fraction{static_cast<word>(
+                        ((parts.fraction >> (q_digits<word> - log_fraction_digits - 1)) + 1) >> 1)};
+                auto const log_magnitude{
+                        is_log_negative ? log_integer - log_fraction : log_integer + log_fraction};
+
+                // 2^(y * log2(x))
+                auto const y_rep{_impl::to_rep(y)};
+                return from_rep<result_type>(exp2_rep<Rep, Exponent, log_fraction_digits - Exponent, word>(
+                        long_multiply<word>{}(magnitude(y_rep), log_magnitude),
+                        is_negative(y_rep) != is_log_negative));
             }
         }
     }
 
-    /// Calculates exp2(x), i.e. 2^x
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::exp2, cnl::exp, cnl::log2, cnl::log, cnl::pow
+
+    /// \brief two raised to the power of a \ref scaled_integer
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Where `Rep` is a fundamental integer of up to 64 bits and `Radix` is 2,
+    /// the result is calculated using only integer arithmetic
+    /// with a polynomial whose degree is chosen from the digits of `Rep`.
+    /// It is within 1 ULP of the exact value where the result has no more than 56 significant digits.
+    /// Otherwise, `x` is converted to and from a floating-point type.
+    /// \pre The result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto exp2(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_exp_log_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::exp2(x);
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::exp2>(x);
+        }
+    }
+
+    /// \brief two raised to the power of each of a sequence of \ref scaled_integer values
     /// \headerfile cnl/scaled_integer.h
     ///
-    /// Accurate to 1LSB for up to 32 bit underlying representation.
-    ///
-    /// \tparam x the input value as a scaled_integer
+    /// \param x sequence of exponents
+    /// \param result sequence of results with the same size as `x`
     ///
-    /// \return the result of the exponential, in the same representation as x
-    template<class Rep, int Exponent>
-    [[nodiscard]] constexpr auto
-    exp2(scaled_integer<Rep, power<Exponent>> x) -> scaled_integer<Rep, power<Exponent>>
+    /// \note Every result is identical to that of \ref cnl::exp2 applied to the corresponding element of `x`.
+    /// Where that overload uses integer arithmetic, it has no data-dependent loops
+    /// and the calculations of consecutive elements can overlap.
+    /// Where `Rep` is narrow enough for that arithmetic to use 32-bit words,
+    /// the loop is eligible for auto-vectorization.
+    /// \pre `x` and `result` must be the same sequence or must not overlap.
+
+    template<typename Rep, int Exponent, int Radix, std::size_t InputExtent, std::size_t OutputExtent>
+    constexpr void exp2(
+            std::span<scaled_integer<Rep, power<Exponent, Radix>> const, InputExtent> x,
+            std::span<scaled_integer<Rep, power<Exponent, Radix>>, OutputExtent> result)
+    {
+        CNL_ASSERT(x.size() == result.size());
+        for (auto index = std::size_t{0}; index != x.size(); ++index) {
+            result[index] = exp2(x[index]);
+        }
+    }
+
+    /// \brief e raised to the power of a \ref scaled_integer
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Accuracy and implementation are as for \ref cnl::exp2.
+    /// \pre The result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto exp(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
     {
-        using out_type = scaled_integer<Rep, power<Exponent>>;
-        // The input type
-        using im = _impl::fp::make_largest_ufraction<out_type>;
+        if constexpr (_impl::fp::is_integer_exp_log_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::exp(x);
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::exp>(x);
+        }
+    }
+
+    /// \brief base-2 logarithm of a \ref scaled_integer
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Where `Rep` is a fundamental integer of up to 64 bits and `Radix` is 2,
+    /// the result is calculated using only integer arithmetic and is within 1 ULP of the exact value
+    /// for every `Exponent` no less than -56.
+    /// Otherwise, `x` is converted to and from a floating-point type.
+    /// \pre `x` must be positive and the result must be representable in the type of `x`.
 
-        // Calculate the final result by shifting the fraction part around.
-        // Remember to add the 1 which is left out to get 1 bit more resolution
-        return _impl::from_rep<out_type>(_impl::fp::exp2<im>(x, static_cast<Rep>(floor(x))));
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto log2(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_exp_log_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::log2(x);
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::log2>(x);
+        }
     }
 
+    /// \brief natural logarithm of a \ref scaled_integer
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Accuracy and implementation are as for \ref cnl::log2.
+    /// \pre `x` must be positive and the result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto log(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_exp_log_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::log(x);
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::log>(x);
+        }
+    }
+
+    /// \brief a \ref scaled_integer, `x`, raised to the power of another, `y`
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Where `Rep` is a fundamental integer of up to 64 bits and `Radix` is 2,
+    /// the result is calculated as `exp2(y * log2(x))` using only integer arithmetic
+    /// and 56 fractional digits of the logarithm; the error grows with the magnitude of `y * log2(x)`.
+    /// Otherwise, `x` and `y` are converted to and from a floating-point type.
+    /// \pre `x` must not be negative and the result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto pow(
+            scaled_integer<Rep, power<Exponent, Radix>> const& x,
+            scaled_integer<Rep, power<Exponent, Radix>> const& y) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_exp_log_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::pow(x, y);
+        } else {
+            using fp = _impl::float_of_same_size<Rep>;
+            return static_cast<scaled_integer<Rep, power<Exponent, Radix>>>(
+                    std::pow(static_cast<fp>(x), static_cast<fp>(y)));
+        }
+    }
 }
 
-#endif /* CNL_IMPL_SCALED_INTEGER_MATH_H */
+#endif  // CNL_IMPL_SCALED_INTEGER_MATH_H
@@ -0,0 +1,172 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief fixed-point arithmetic and power series shared by the transcendental functions of `cnl::scaled_integer`
+
+#if !defined(CNL_IMPL_SCALED_INTEGER_SERIES_H)
+#define CNL_IMPL_SCALED_INTEGER_SERIES_H
+
+#include "../duplex_integer.h"
+#include "../duplex_integer/multiply.h"
+#include "../num_traits/width.h"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        namespace fp {
+            // An unsigned fixed-point number, stored in Word, with one integer digit, i.e. in the range [0, 2).
+            // Narrow types which need few enough digits use 32-bit words; others use 64-bit words.
+            template<std::unsigned_integral Word>
+            inline constexpr auto q_digits{width<Word> - 1};
+
+            template<std::unsigned_integral Word>
+            inline constexpr auto q_one{Word{1} << q_digits<Word>};
+
+            // the product of two words
+            template<std::unsigned_integral Word>
+            using double_word = decltype(long_multiply<Word>{}(Word{}, Word{}));
+
+            // round(value * 2^(width<Word> - 64))
+            template<std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto narrow_q(std::uint64_t value) -> Word
+            {
+                if constexpr (width<Word> == 64) {
+                    return value;
+                } else {
+                    return static_cast<Word>(((value >> (63 - width<Word>)) + 1) >> 1);
+                }
+            }
+
+            template<std::unsigned_integral Word, std::size_t Size>
+            [[nodiscard]] constexpr auto narrow_q(std::array<std::uint64_t, Size> const& values)
+            {
+                std::array<Word, Size> narrowed{};
+                for (auto i{std::size_t{0}}; i != Size; ++i) {
+                    narrowed[i] = narrow_q<Word>(values[i]);
+                }
+                return narrowed;
+            }
+
+            // (lhs * rhs) >> q_digits<Word>
+            template<std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto multiply_q(Word lhs, Word rhs) -> Word
+            {
+                auto const product{long_multiply<Word>{}(lhs, rhs)};
+                return static_cast<Word>(
+                        (long_product_upper<Word>(product) << 1) | (static_cast<Word>(product) >> q_digits<Word>));
+            }
+
+            template<std::integral Integer>
+            [[nodiscard]] constexpr auto is_negative(Integer const& value) -> bool
+            {
+                if constexpr (std::signed_integral<Integer>) {
+                    return value < Integer{0};
+                } else {
+                    return false;
+                }
+            }
+
+            // the magnitude of an integer
+            template<std::integral Integer>
+            [[nodiscard]] constexpr auto magnitude(Integer const& value) -> std::uint64_t
+            {
+                auto const bits{static_cast<std::uint64_t>(value)};
+                return is_negative(value) ? static_cast<std::uint64_t>(std::uint64_t{0} - bits) : bits;
+            }
+
+            // the fixed-point value, magnitude * 2^-FractionDigits,
+            // rounded to the nearest multiple of 2^Exponent and negated if is_negative
+            template<typename Rep, int Exponent, int FractionDigits, typename Magnitude>
+            [[nodiscard]] constexpr auto round_to_rep(Magnitude const& magnitude, bool is_negative) -> Rep
+            {
+                constexpr auto shift{FractionDigits + Exponent};
+                auto rounded{std::uint64_t{}};
+                if constexpr (shift <= -64) {
+                    rounded = 0;
+                } else if constexpr (shift <= 0) {
+                    rounded = static_cast<std::uint64_t>(magnitude) << -shift;
+                } else if constexpr (shift <= width<Magnitude>) {
+                    rounded = static_cast<std::uint64_t>(((magnitude >> (shift - 1)) + Magnitude{1}) >> 1);
+                }
+                return static_cast<Rep>(is_negative ? std::uint64_t{0} - rounded : rounded);
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // series
+
+            // 1/n! for every n in [0, 22)
+            template<std::unsigned_integral Word>
+            inline constexpr auto inverse_factorials{[]() {
+                std::array<Word, 22> coefficients{};
+                coefficients[0] = q_one<Word>;
+                for (auto n{1}; n != int(coefficients.size()); ++n) {
+                    auto const divisor{static_cast<Word>(n)};
+                    coefficients[n] = static_cast<Word>((coefficients[n - 1] + divisor / 2) / divisor);
+                }
+                return coefficients;
+            }()};
+
+            // coefficient of x^n in the Taylor series of sin and cos
+            template<std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto inverse_factorial(int n) -> Word
+            {
+                return (n < int(inverse_factorials<Word>.size())) ? inverse_factorials<Word>[n] : Word{0};
+            }
+
+            // coefficient of x^n in the Taylor series of atan and atanh
+            template<std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto inverse(int n) -> Word
+            {
+                return static_cast<Word>(q_one<Word> / static_cast<Word>(n));
+            }
+
+            // number of terms of the series, sum of coefficient(First + Step*k) * x^(First + Step*k),
+            // needed to bring the truncation error below 2^-Digits for every x up to max_x
+            template<int Digits, int First, int Step = 2, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto num_terms(Word (*coefficient)(int), Word max_x) -> int
+            {
+                static_assert(Digits < q_digits<Word>);
+
+                auto power{q_one<Word>};
+                for (auto n{0}; n != First; ++n) {
+                    power = multiply_q(power, max_x);
+                }
+
+                auto max_x_step{q_one<Word>};
+                for (auto n{0}; n != Step; ++n) {
+                    max_x_step = multiply_q(max_x_step, max_x);
+                }
+
+                auto terms{0};
+                while (multiply_q(coefficient(First + terms * Step), power) >= (Word{1} << (q_digits<Word> - Digits))) {
+                    power = multiply_q(power, max_x_step);
+                    ++terms;
+                }
+                return terms;
+            }
+
+            // sum of (-1)^k * coefficient(First + Step*k) * x_step^k for k in [0, NumTerms);
+            // with the coefficients of sin, cos, atan and log and the ranges of x used here,
+            // every partial sum of Horner's method is non-negative
+            template<int NumTerms, int First, int Step = 2, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto alternating_series(Word (*coefficient)(int), Word x_step) -> Word
+            {
+                auto sum{Word{0}};
+                for (auto k{NumTerms - 1}; k >= 0; --k) {
+                    sum = static_cast<Word>(coefficient(First + k * Step) - multiply_q(x_step, sum));
+                }
+                return sum;
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_SCALED_INTEGER_SERIES_H
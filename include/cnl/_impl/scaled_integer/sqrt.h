@@ -8,15 +8,19 @@
 #define CNL_IMPL_SCALED_INTEGER_SQRT_H
 
 #include "../cmath/sqrt.h"
+#include "../cnl_assert.h"
 #include "definition.h"
 
+#include <cstddef>
+#include <span>
+
 /// compositional numeric library
 namespace cnl {
     /// \overload auto sqrt(scaled_integer<Rep, power<Exponent, Radix>> const& x)
     /// \brief \ref scaled_integer overload of cnl::sqrt
     /// \headerfile cnl/scaled_integer.h
     /// \return square root of `x`
-    /// \note This function has O(n) complexity where n is the number of significant digits.
+    /// \note The complexity is that of the integer overload of cnl::sqrt applied to the rep of `x`.
     /// \pre `x` must be non-negative
     /// \pre `Exponent` must be even
 
@@ -27,6 +31,27 @@ namespace cnl {
         using result_type = scaled_integer<Rep, power<Exponent / 2, Radix>>;
         return _impl::from_rep<result_type>(sqrt(_impl::to_rep(x)));
     }
+
+    /// \brief square root of each of a sequence of \ref scaled_integer values
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \param x sequence of non-negative values
+    /// \param result sequence of results with the same size as `x`
+    ///
+    /// \note Every result is identical to that of \ref cnl::sqrt applied to the corresponding element of `x`.
+    /// The elements are independent, so the calculations of consecutive elements can overlap.
+    /// \pre `x` and `result` must not overlap.
+
+    template<typename Rep, int Exponent, int Radix, std::size_t InputExtent, std::size_t OutputExtent>
+    constexpr void sqrt(
+            std::span<scaled_integer<Rep, power<Exponent, Radix>> const, InputExtent> x,
+            std::span<scaled_integer<Rep, power<Exponent / 2, Radix>>, OutputExtent> result)
+    {
+        CNL_ASSERT(x.size() == result.size());
+        for (auto index = std::size_t{0}; index != x.size(); ++index) {
+            result[index] = sqrt(x[index]);
+        }
+    }
 }
 
 #endif  // CNL_IMPL_SCALED_INTEGER_SQRT_H
@@ -10,6 +10,7 @@
 #include "../../integer.h"
 #include "../charconv/constants.h"
 #include "../charconv/descale.h"
+#include "../charconv/digit_pairs.h"
 #include "../charconv/to_chars.h"
 #include "../cnl_assert.h"
 #include "../cstdint/types.h"
@@ -28,7 +29,9 @@
 #include <cctype>
 #include <charconv>
 #include <iterator>
+#include <limits>
 #include <span>
+#include <string_view>
 #include <system_error>
 #include <tuple>
 #include <type_traits>
@@ -223,6 +226,23 @@ namespace cnl {
         {
             CNL_ASSERT(descaled.significand);
 
+            if constexpr (std::is_same_v<Significand, std::int64_t>) {
+                // generate the digits two at a time
+                std::array<char, std::numeric_limits<std::uint64_t>::digits10 + 1> digits{};
+                auto const is_negative{descaled.significand < Significand{0}};
+                auto const magnitude{
+                        is_negative ? std::uint64_t{0} - static_cast<std::uint64_t>(descaled.significand)
+                                    : static_cast<std::uint64_t>(descaled.significand)};
+                auto const* const digits_last{digits.data() + digits.size()};
+                auto const* const digits_first{to_chars_digits_backward(digits.data() + digits.size(), magnitude)};
+                auto const significand_digits{std::string_view(digits_first, digits_last - digits_first)};
+                if (is_negative) {
+                    *first = minus_char;
+                    return to_chars_positive(first + 1, last, significand_digits, descaled.exponent);
+                }
+                return to_chars_positive(first, last, significand_digits, descaled.exponent);
+            }
+
             auto const significand_chars_static{to_chars_static<10>(descaled.significand)};
             auto const significand_chars_cstr{significand_chars_static.chars.data()};
             if (*significand_chars_cstr == minus_char) {
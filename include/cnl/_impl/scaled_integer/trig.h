@@ -0,0 +1,403 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief trigonometric functions of `cnl::scaled_integer` which use only integer arithmetic
+
+#if !defined(CNL_IMPL_SCALED_INTEGER_TRIG_H)
+#define CNL_IMPL_SCALED_INTEGER_TRIG_H
+
+#include "../duplex_integer.h"
+#include "../duplex_integer/long_divide.h"
+#include "../duplex_integer/multiply.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../num_traits/width.h"
+#include "definition.h"
+#include "extras.h"
+#include "series.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        namespace fp {
+            // true iff the trigonometric functions of scaled_integer<Rep, power<Exponent, Radix>>
+            // can be calculated using the integer arithmetic below
+            template<typename Rep, int Exponent, int Radix>
+            inline constexpr auto is_integer_trig_compatible =
+                    std::integral<Rep> && Radix == 2 && width<Rep> <= 64 && Exponent <= 320;
+
+            // round(pi/2 * 2^63)
+            inline constexpr auto q63_half_pi{std::uint64_t{0xC90FDAA22168C235}};
+
+            // round(pi * 2^62)
+            inline constexpr auto q62_pi{std::uint64_t{0xC90FDAA22168C235}};
+
+            template<std::unsigned_integral Word>
+            inline constexpr auto q_half_pi{narrow_q<Word>(q63_half_pi)};
+
+            // the number of fractional digits to which intermediate results are calculated
+            // in order for the result, a multiple of 2^Exponent, to be within one ULP
+            template<int Exponent>
+            inline constexpr auto trig_digits{std::clamp(3 - Exponent, 3, 60)};
+
+            // the word in which the trigonometric functions of scaled_integer<Rep, power<Exponent>> are calculated
+            template<typename Rep, int Exponent>
+            using trig_word = std::conditional_t<
+                    (width<Rep> <= 32 && trig_digits<Exponent> <= 26), std::uint32_t, std::uint64_t>;
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sin and cos of reduced angles
+
+            // sin(z) where z is in [0, pi/4]
+            template<int Digits, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto sin_eighth_turn(Word z) -> Word
+            {
+                constexpr auto terms{num_terms<Digits, 1>(inverse_factorial<Word>, Word{q_half_pi<Word> / 2})};
+                return multiply_q(z, alternating_series<terms, 1>(inverse_factorial<Word>, multiply_q(z, z)));
+            }
+
+            // cos(z) where z is in [0, pi/4]
+            template<int Digits, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto cos_eighth_turn(Word z) -> Word
+            {
+                constexpr auto terms{num_terms<Digits, 0>(inverse_factorial<Word>, Word{q_half_pi<Word> / 2})};
+                return alternating_series<terms, 0>(inverse_factorial<Word>, multiply_q(z, z));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // argument reduction
+
+            // the first 512 fractional binary digits of 1/(2*pi)
+            inline constexpr std::array<std::uint64_t, 8> inverse_two_pi_digits{
+                    0x28BE60DB9391054A, 0x7F09D5F47D4D3770, 0x36D8A5664F10E410, 0x7F9458EAF7AEF158,
+                    0x6DC91B8E909374B8, 0x01924BBA82746487, 0x3F877AC72C4A69CF, 0xBA208D7D4BAED121};
+
+            // the 64 fractional binary digits of 1/(2*pi) starting from the digit with weight 2^-(first+1)
+            [[nodiscard]] constexpr auto inverse_two_pi_window(int first) -> std::uint64_t
+            {
+                if (first < 0) {
+                    return (first <= -64) ? 0 : (inverse_two_pi_digits[0] >> -first);
+                }
+                auto const index{std::size_t(first / 64)};
+                auto const shift{first % 64};
+                auto const next{(index + 1 < inverse_two_pi_digits.size()) ? inverse_two_pi_digits[index + 1] : 0};
+                return shift ? ((inverse_two_pi_digits[index] << shift) | (next >> (64 - shift)))
+                             : inverse_two_pi_digits[index];
+            }
+
+            // magnitude * 2^Exponent radians, converted to units of 2^-width<Word> turns and reduced modulo one turn;
+            // 2^(Exponent+64)/(2*pi) is applied as an integer part, modulo 2^64, and as many fractional digits
+            // as are needed by the word
+            template<std::unsigned_integral Word, int Exponent, int MagnitudeWidth>
+            [[nodiscard]] constexpr auto to_turns(std::uint64_t magnitude) -> Word
+            {
+                constexpr auto integer_part{inverse_two_pi_window(Exponent)};
+
+                if constexpr (width<Word> < 64) {
+                    // the fraction is worth less than one unit of the result
+                    static_assert(MagnitudeWidth <= width<Word>);
+                    constexpr auto shift{64 - width<Word>};
+                    return static_cast<Word>(
+                            (static_cast<std::uint64_t>(magnitude * integer_part) + (std::uint64_t{1} << (shift - 1)))
+                            >> shift);
+                } else {
+                    constexpr auto fraction_upper{inverse_two_pi_window(Exponent + 64)};
+                    constexpr auto fraction_lower{inverse_two_pi_window(Exponent + 128)};
+
+                    auto const upper_product{long_multiply<std::uint64_t>{}(magnitude, fraction_upper)};
+                    auto turns{static_cast<std::uint64_t>(
+                            magnitude * integer_part + long_product_upper<std::uint64_t>(upper_product))};
+                    auto fraction{static_cast<std::uint64_t>(upper_product)};
+
+                    // for narrow magnitudes, the lower fraction cannot affect the result
+                    if constexpr (MagnitudeWidth > 32) {
+                        auto const lower_product{long_product_upper<std::uint64_t>(
+                                long_multiply<std::uint64_t>{}(magnitude, fraction_lower))};
+                        fraction = static_cast<std::uint64_t>(fraction + lower_product);
+                        turns = static_cast<std::uint64_t>(turns + std::uint64_t{fraction < lower_product});
+                    }
+
+                    return static_cast<std::uint64_t>(turns + (fraction >> 63));
+                }
+            }
+
+            // x in units of 2^-width<Word> turns
+            template<typename Rep, int Exponent, std::unsigned_integral Word = trig_word<Rep, Exponent>>
+            [[nodiscard]] constexpr auto to_turns(scaled_integer<Rep, power<Exponent>> const& x) -> Word
+            {
+                auto const rep{_impl::to_rep(x)};
+                auto const turns{to_turns<Word, Exponent, width<Rep>>(magnitude(rep))};
+                return is_negative(rep) ? static_cast<Word>(Word{0} - turns) : turns;
+            }
+
+            // an angle, expressed as a quadrant and an offset of up to 1/8 of a turn
+            // from the start or end of that quadrant
+            template<std::unsigned_integral Word>
+            struct quadrant_offset {
+                // in the range [0, 4)
+                int quadrant;
+                // true iff offset is measured back from the end of the quadrant
+                bool is_reflected;
+                // in the range [0, pi/4]
+                Word offset;
+            };
+
+            template<std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto to_quadrant_offset(Word turns) -> quadrant_offset<Word>
+            {
+                auto const fraction{static_cast<Word>(turns << 2)};
+                auto const is_reflected{fraction > q_one<Word>};
+                auto const folded{is_reflected ? static_cast<Word>(Word{0} - fraction) : fraction};
+                return quadrant_offset<Word>{
+                        static_cast<int>(turns >> (width<Word> - 2)), is_reflected,
+                        long_product_upper<Word>(long_multiply<Word>{}(folded, q_half_pi<Word>))};
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // sin, cos and tan
+
+            template<typename Rep, int Exponent, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto sin_turns(Word turns)
+            {
+                constexpr auto digits{trig_digits<Exponent>};
+                auto const angle{to_quadrant_offset(turns)};
+                auto const is_cos{((angle.quadrant & 1) != 0) != angle.is_reflected};
+                auto const magnitude{
+                        is_cos ? cos_eighth_turn<digits>(angle.offset) : sin_eighth_turn<digits>(angle.offset)};
+                return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                        round_to_rep<Rep, Exponent, q_digits<Word>>(magnitude, angle.quadrant >= 2));
+            }
+
+            template<typename Rep, int Exponent, std::unsigned_integral Word>
+            [[nodiscard]] constexpr auto tan_turns(Word turns)
+            {
+                constexpr auto digits{trig_digits<Exponent>};
+                constexpr auto quotient_digits{1 - Exponent};
+                constexpr auto dividend_shift{std::clamp(quotient_digits, 0, q_digits<Word>)};
+
+                auto const angle{to_quadrant_offset(turns)};
+                auto const sin_offset{sin_eighth_turn<digits>(angle.offset)};
+                auto const cos_offset{cos_eighth_turn<digits>(angle.offset)};
+                auto const is_cot{((angle.quadrant & 1) != 0) != angle.is_reflected};
+                auto const numerator{is_cot ? cos_offset : sin_offset};
+                auto const denominator{std::max(is_cot ? sin_offset : cos_offset, Word{1})};
+
+                // numerator / denominator with one more fractional digit than the result
+                auto const dividend_upper{
+                        dividend_shift ? static_cast<Word>(numerator >> (width<Word> - dividend_shift)) : Word{0}};
+                auto const dividend_lower{static_cast<Word>(numerator << dividend_shift)};
+                auto quotient{
+                        (dividend_upper < denominator)
+                                ? long_divide(dividend_upper, dividend_lower, denominator).quotient
+                                : static_cast<Word>(~Word{0})};
+                if constexpr (quotient_digits < dividend_shift) {
+                    quotient = (dividend_shift - quotient_digits >= width<Word>)
+                                     ? Word{0}
+                                     : static_cast<Word>(quotient >> (dividend_shift - quotient_digits));
+                } else if constexpr (quotient_digits > dividend_shift) {
+                    quotient = static_cast<Word>(quotient << (quotient_digits - dividend_shift));
+                }
+
+                return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                        round_to_rep<Rep, 0, 1>(quotient, (angle.quadrant & 1) != 0));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // atan and atan2
+
+            // round(atan(i/16) * 2^63) for every i in [0, 16]
+            inline constexpr std::array<std::uint64_t, 17> atan_sixteenths_q63{
+                    0x0000000000000000, 0x07FD56EDCB3F7A72, 0x0FEADD4D5617B6E3, 0x17B97B4BCE5B0227,
+                    0x1F5B75F92C80DD63, 0x26C4EE6E0FD7979A, 0x2DEC3283C9BDE11D, 0x34C9DD879847F96E,
+                    0x3B58CE0AC3769ED1, 0x4195FA536CC33F15, 0x47802EAF7BFACFCE, 0x4D17C07338DEED10,
+                    0x525E3E8C9A7B8492, 0x5756261C5A6C6040, 0x5C029F15E118CF3A, 0x606742DC56293320,
+                    0x6487ED5110B4611A};
+
+            template<std::unsigned_integral Word>
+            inline constexpr auto atan_sixteenths{narrow_q<Word>(atan_sixteenths_q63)};
+
+            // atan(y * 2^shift / x) in the range [0, pi/2] where y and x are non-negative;
+            // the ratio, t, is reduced to at most one and then atan(t) = atan(i/16) + atan(d)
+            // where i/16 is the nearest sixteenth to t and d = (t - i/16) / (1 + t*i/16)
+            template<std::unsigned_integral Word, int Digits>
+            [[nodiscard]] constexpr auto atan_ratio(std::uint64_t y, std::uint64_t x, int shift) -> Word
+            {
+                if (!y) {
+                    return Word{0};
+                }
+                if (!x) {
+                    return q_half_pi<Word>;
+                }
+
+                // normalize both terms to this width so that the arithmetic below cannot overflow
+                constexpr auto normal_width{width<Word> - 5};
+                auto const normalize = [](std::uint64_t value, int value_width) {
+                    return static_cast<Word>(
+                            (value_width > normal_width) ? value >> (value_width - normal_width)
+                                                         : value << (normal_width - value_width));
+                };
+                auto const y_width{static_cast<int>(std::bit_width(y))};
+                auto const x_width{static_cast<int>(std::bit_width(x))};
+                auto numerator{normalize(y, y_width)};
+                auto denominator{normalize(x, x_width)};
+                auto exponent{shift + y_width - x_width};
+
+                // atan(t) = pi/2 - atan(1/t)
+                auto const is_reciprocal{exponent > 0 || (exponent == 0 && numerator > denominator)};
+                if (is_reciprocal) {
+                    std::swap(numerator, denominator);
+                    exponent = -exponent;
+                }
+                numerator = (exponent <= -width<Word>) ? Word{0} : static_cast<Word>(numerator >> -exponent);
+
+                auto const index{static_cast<Word>((numerator * 16 + denominator / 2) / denominator)};
+                auto const scaled_numerator{static_cast<Word>(numerator * 16)};
+                auto const nearest{static_cast<Word>(index * denominator)};
+                auto const is_below{scaled_numerator < nearest};
+                auto const difference{static_cast<Word>(is_below ? nearest - scaled_numerator : scaled_numerator - nearest)};
+                auto const d{long_divide(
+                                     static_cast<Word>(difference >> 1),
+                                     static_cast<Word>(difference << q_digits<Word>),
+                                     static_cast<Word>(denominator * 16 + index * numerator))
+                                     .quotient};
+
+                constexpr auto terms{num_terms<Digits, 1>(inverse<Word>, Word{q_one<Word> / 32})};
+                auto const atan_d{multiply_q(d, alternating_series<terms, 1>(inverse<Word>, multiply_q(d, d)))};
+                auto const atan_i{atan_sixteenths<Word>[index]};
+                auto const atan_t{static_cast<Word>(is_below ? atan_i - atan_d : atan_i + atan_d)};
+                return is_reciprocal ? static_cast<Word>(q_half_pi<Word> - atan_t) : atan_t;
+            }
+
+            template<typename Rep, int Exponent>
+            [[nodiscard]] constexpr auto atan(scaled_integer<Rep, power<Exponent>> const& x)
+            {
+                using word = trig_word<Rep, Exponent>;
+                auto const rep{_impl::to_rep(x)};
+                auto const angle{atan_ratio<word, trig_digits<Exponent>>(magnitude(rep), 1, Exponent)};
+                return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                        round_to_rep<Rep, Exponent, q_digits<word>>(angle, is_negative(rep)));
+            }
+
+            template<typename Rep, int Exponent>
+            [[nodiscard]] constexpr auto atan2(
+                    scaled_integer<Rep, power<Exponent>> const& y, scaled_integer<Rep, power<Exponent>> const& x)
+            {
+                using word = trig_word<Rep, Exponent>;
+                auto const y_rep{_impl::to_rep(y)};
+                auto const x_rep{_impl::to_rep(x)};
+                auto const angle{atan_ratio<word, trig_digits<Exponent>>(magnitude(y_rep), magnitude(x_rep), 0)};
+
+                // with a negative x, the angle is measured from pi and needs a second integer digit
+                auto const half_angle{static_cast<word>((angle >> 1) + (angle & 1))};
+                auto const unsigned_angle{
+                        is_negative(x_rep) ? static_cast<word>(narrow_q<word>(q62_pi) - half_angle) : half_angle};
+                return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                        round_to_rep<Rep, Exponent, q_digits<word> - 1>(unsigned_angle, is_negative(y_rep)));
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::sin, cnl::cos, cnl::tan, cnl::atan, cnl::atan2
+
+    /// \brief sine of a \ref scaled_integer angle in radians
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Where `Rep` is a fundamental integer of up to 64 bits and `Radix` is 2,
+    /// the result is calculated using only integer arithmetic and is within 1 ULP of the exact value
+    /// for every `Exponent` no less than -56.
+    /// Otherwise, `x` is converted to and from a floating-point type.
+    /// \pre The result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto sin(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_trig_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::sin_turns<Rep, Exponent>(_impl::fp::to_turns(x));
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::sin>(x);
+        }
+    }
+
+    /// \brief cosine of a \ref scaled_integer angle in radians
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Accuracy and implementation are as for \ref cnl::sin.
+    /// \pre The result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto cos(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_trig_compatible<Rep, Exponent, Radix>) {
+            using word = _impl::fp::trig_word<Rep, Exponent>;
+            constexpr auto quarter_turn{word{1} << (_impl::width<word> - 2)};
+            return _impl::fp::sin_turns<Rep, Exponent>(static_cast<word>(_impl::fp::to_turns(x) + quarter_turn));
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::cos>(x);
+        }
+    }
+
+    /// \brief tangent of a \ref scaled_integer angle in radians
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Implementation is as for \ref cnl::sin. Because the error in the reduced angle is magnified
+    /// near the poles, the 1 ULP bound only holds where the square of the result does not exceed 2^(56+Exponent).
+    /// \pre The result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto tan(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_trig_compatible<Rep, Exponent, Radix>) {
+            // near the poles, the error in the reduced angle is magnified too much for narrower words
+            return _impl::fp::tan_turns<Rep, Exponent>(_impl::fp::to_turns<Rep, Exponent, std::uint64_t>(x));
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::tan>(x);
+        }
+    }
+
+    /// \brief arc tangent, in radians, of a \ref scaled_integer
+    /// \headerfile cnl/scaled_integer.h
+    /// \note Accuracy and implementation are as for \ref cnl::sin.
+    /// \pre The result must be representable in the type of `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto atan(scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_trig_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::atan(x);
+        } else {
+            return _impl::crib<Rep, Exponent, Radix, std::atan>(x);
+        }
+    }
+
+    /// \brief angle, in radians, of the point (`x`, `y`) from the positive x axis
+    /// \headerfile cnl/scaled_integer.h
+    /// \return a value in the range [-pi, pi]
+    /// \note Accuracy and implementation are as for \ref cnl::sin.
+    /// \pre The result must be representable in the type of `y` and `x`.
+
+    template<typename Rep, int Exponent, int Radix>
+    [[nodiscard]] constexpr auto atan2(
+            scaled_integer<Rep, power<Exponent, Radix>> const& y,
+            scaled_integer<Rep, power<Exponent, Radix>> const& x) noexcept
+    {
+        if constexpr (_impl::fp::is_integer_trig_compatible<Rep, Exponent, Radix>) {
+            return _impl::fp::atan2(y, x);
+        } else {
+            using fp = _impl::float_of_same_size<Rep>;
+            return static_cast<scaled_integer<Rep, power<Exponent, Radix>>>(
+                    std::atan2(static_cast<fp>(y), static_cast<fp>(x)));
+        }
+    }
+}
+
+#endif  // CNL_IMPL_SCALED_INTEGER_TRIG_H
@@ -9,10 +9,12 @@
 
 #include "../constant.h"
 #include "../integer.h"
+#include "custom_operator/op.h"
 #include "num_traits/from_value.h"
 #include "num_traits/width.h"
 #include "numbers/set_signedness.h"
 #include "numbers/signedness.h"
+#include "overflow/builtin_overflow.h"
 
 #if defined(CNL_INT128_ENABLED)
 #define WIDE_INTEGER_HAS_LIMB_TYPE_UINT64
@@ -100,4 +102,50 @@ namespace cnl::numbers {
     };
 }
 
+namespace cnl::_impl {
+    // overflow of the sum of two uintwide_t values is detected from the carry out of the most
+    // significant limb or, if signed, from the sign bits of the addends and of the wrapped sum
+    template<std::uint32_t Width, typename LimbType, typename AllocatorType, bool IsSigned>
+    struct builtin_overflow_operator<
+            add_op,
+            math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>,
+            math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>> : std::true_type {
+        using integer = math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>;
+
+        [[nodiscard]] constexpr auto operator()(
+                integer const& lhs, integer const& rhs, integer& result) const
+        {
+            result = lhs + rhs;
+            if constexpr (IsSigned) {
+                auto const lhs_is_neg{integer::is_neg(lhs)};
+                return lhs_is_neg == integer::is_neg(rhs) && lhs_is_neg != integer::is_neg(result);
+            } else {
+                return result < lhs;
+            }
+        }
+    };
+
+    // overflow of the difference of two uintwide_t values is detected from the borrow out of the most
+    // significant limb or, if signed, from the sign bits of the operands and of the wrapped difference
+    template<std::uint32_t Width, typename LimbType, typename AllocatorType, bool IsSigned>
+    struct builtin_overflow_operator<
+            subtract_op,
+            math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>,
+            math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>> : std::true_type {
+        using integer = math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>;
+
+        [[nodiscard]] constexpr auto operator()(
+                integer const& lhs, integer const& rhs, integer& result) const
+        {
+            result = lhs - rhs;
+            if constexpr (IsSigned) {
+                auto const lhs_is_neg{integer::is_neg(lhs)};
+                return lhs_is_neg != integer::is_neg(rhs) && lhs_is_neg != integer::is_neg(result);
+            } else {
+                return lhs < rhs;
+            }
+        }
+    };
+}
+
 #endif  // CNL_IMPL_WIDE_INTEGER_H
@@ -0,0 +1,23 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_WIDE_INTEGER_FROM_VALUE_H)
+#define CNL_IMPL_WIDE_INTEGER_FROM_VALUE_H
+
+#include "../../constant.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_value.h"
+#include "definition.h"
+
+/// compositional numeric library
+namespace cnl {
+    // the rep of the archetype may be too wide to hold the constant efficiently
+    template<int Digits, typename Narrowest, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+    struct from_value<wide_integer<Digits, Narrowest>, constant<Value>>
+        : _impl::from_value_simple<wide_integer<digits_v<constant<Value>>, int>, constant<Value>> {
+    };
+}
+
+#endif  // CNL_IMPL_WIDE_INTEGER_FROM_VALUE_H
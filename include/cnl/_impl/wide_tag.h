@@ -7,12 +7,16 @@
 #if !defined(CNL_IMPL_WIDE_TAG_H)
 #define CNL_IMPL_WIDE_TAG_H
 
+#include "duplex_integer.h"
+#include "wide_tag/backend.h"
 #include "wide_tag/custom_operator.h"
 #include "wide_tag/declaration.h"
 #include "wide_tag/definition.h"
+#include "wide_tag/divide_by_constant.h"
 #include "wide_tag/is_same_tag_family.h"
 #include "wide_tag/is_tag.h"
 #include "wide_tag/is_wide_tag.h"
+#include "wide_tag/multiply.h"
 #include "wide_tag/overloads.h"
 
 #endif  // CNL_IMPL_WIDE_TAG_H
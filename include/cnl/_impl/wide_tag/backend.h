@@ -0,0 +1,37 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief selection of the multiword representation of \ref cnl::wide_tag
+
+#if !defined(CNL_IMPL_WIDE_TAG_BACKEND_H)
+#define CNL_IMPL_WIDE_TAG_BACKEND_H
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief representations of integers which are too wide for any fundamental integer
+    /// \sa wide_tag_backend_v
+    enum class wide_tag_backend {
+        /// array of limbs of type, `Narrowest`
+        uintwide,
+        /// tree of the widest fundamental integers, suited to widths of a few words
+        duplex_integer
+    };
+
+    /// \brief multiword representation used by `wide_tag<Digits, Narrowest>`
+    ///
+    /// \note Only consulted when `Digits` exceeds the digits of every fundamental integer.
+    /// Specialize to select the faster representation on a given target, e.g.:
+    /// \code
+    /// template<int Digits, typename Narrowest>
+    /// requires(Digits < 256) inline constexpr auto cnl::wide_tag_backend_v<Digits, Narrowest> =
+    ///         cnl::wide_tag_backend::duplex_integer;
+    /// \endcode
+    /// The `bm_wide_backend_*` benchmarks in test/benchmark/benchmark.cpp compare the two.
+    template<int Digits, typename Narrowest>
+    inline constexpr auto wide_tag_backend_v = wide_tag_backend::uintwide;
+}
+
+#endif  // CNL_IMPL_WIDE_TAG_BACKEND_H
@@ -59,6 +59,26 @@ namespace cnl {
         : Operator {
     };
 
+    namespace _impl {
+        // representation of the result of a binary arithmetic operation on wide_tag operands
+        template<int LhsDigits, class LhsNarrowest, int RhsDigits, class RhsNarrowest>
+        struct wide_tag_arithmetic_result {
+        private:
+            static constexpr auto _max_digits{std::max(LhsDigits, RhsDigits)};
+            static constexpr auto _are_signed{
+                    numbers::signedness_v<LhsNarrowest> || numbers::signedness_v<RhsNarrowest>};
+            using common_type = typename std::common_type<LhsNarrowest, RhsNarrowest>::type;
+            using narrowest = numbers::set_signedness_t<common_type, _are_signed>;
+
+        public:
+            using type = typename wide_tag<_max_digits, narrowest>::rep;
+        };
+
+        template<int LhsDigits, class LhsNarrowest, int RhsDigits, class RhsNarrowest>
+        using wide_tag_arithmetic_result_t =
+                typename wide_tag_arithmetic_result<LhsDigits, LhsNarrowest, RhsDigits, RhsNarrowest>::type;
+    }
+
     template<
             _impl::binary_arithmetic_op Operator, int LhsDigits, class LhsNarrowest, int RhsDigits, class RhsNarrowest,
             class Lhs, class Rhs>
@@ -67,14 +87,7 @@ namespace cnl {
             op_value<Lhs, wide_tag<LhsDigits, LhsNarrowest>>,
             op_value<Rhs, wide_tag<RhsDigits, RhsNarrowest>>> {
     private:
-        static constexpr auto _max_digits{std::max(LhsDigits, RhsDigits)};
-        static constexpr auto _are_signed{
-                numbers::signedness_v<LhsNarrowest> || numbers::signedness_v<RhsNarrowest>};
-        using common_type = typename std::common_type<LhsNarrowest, RhsNarrowest>::type;
-        using narrowest = numbers::set_signedness_t<common_type, _are_signed>;
-
-        using result_tag = wide_tag<_max_digits, narrowest>;
-        using result = typename result_tag::rep;
+        using result = _impl::wide_tag_arithmetic_result_t<LhsDigits, LhsNarrowest, RhsDigits, RhsNarrowest>;
 
     public:
         [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result
@@ -7,12 +7,16 @@
 #if !defined(CNL_IMPL_WIDE_TAG_DEFINITION_H)
 #define CNL_IMPL_WIDE_TAG_DEFINITION_H
 
+#include "../cstdint/types.h"
 #include "../custom_operator/homogeneous_operator_tag_base.h"
+#include "../duplex_integer/narrowest_integer.h"
 #include "../num_traits/digits.h"
 #include "../num_traits/max_digits.h"
 #include "../num_traits/set_digits.h"
+#include "../numbers/set_signedness.h"
 #include "../numbers/signedness.h"
 #include "../wide-integer.h"
+#include "backend.h"
 #include "declaration.h"
 
 #include <algorithm>
@@ -30,9 +34,25 @@ namespace cnl {
             : std::type_identity<set_digits_t<Narrowest, std::max(cnl::digits_v<Narrowest>, Digits)>> {
         };
 
+        template<int Digits, typename Narrowest, wide_tag_backend Backend>
+        struct wide_tag_multiword_rep;
+
+        template<int Digits, typename Narrowest>
+        struct wide_tag_multiword_rep<Digits, Narrowest, wide_tag_backend::uintwide>
+            : make_uintwide<Digits, Narrowest> {
+        };
+
+        // words are the widest fundamental integer, regardless of Narrowest
+        template<int Digits, typename Narrowest>
+        struct wide_tag_multiword_rep<Digits, Narrowest, wide_tag_backend::duplex_integer>
+            : narrowest_integer<
+                      Digits, numbers::set_signedness_t<cnl::intmax_t, numbers::signedness_v<Narrowest>>> {
+        };
+
         // when number must be represented using multiple integers
         template<int Digits, typename Narrowest>
-        struct wide_tag_rep<Digits, Narrowest, true> : make_uintwide<Digits, Narrowest> {
+        struct wide_tag_rep<Digits, Narrowest, true>
+            : wide_tag_multiword_rep<Digits, Narrowest, wide_tag_backend_v<Digits, Narrowest>> {
         };
 
         template<int Digits, typename Narrowest, bool NeedsMultiword>
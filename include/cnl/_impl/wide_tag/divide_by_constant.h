@@ -0,0 +1,100 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief division of multiword wide_tag representations by a \ref cnl::constant
+
+#if !defined(CNL_IMPL_WIDE_TAG_DIVIDE_BY_CONSTANT_H)
+#define CNL_IMPL_WIDE_TAG_DIVIDE_BY_CONSTANT_H
+
+#include "../../constant.h"
+#include "../cstdint/types.h"
+#include "../divide_by_constant.h"
+#include "../duplex_integer.h"
+#include "../duplex_integer/divide.h"
+#include "../duplex_integer/long_divide.h"
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
+#include "../wide-integer.h"
+
+#include <concepts>
+#include <limits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // true iff Value is a positive divisor which fits in a single Word
+        template<typename Word, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        inline constexpr auto is_word_divisor =
+                std::integral<decltype(Value)> && (Value > 0)
+                && (static_cast<uintmax_t>(Value) <= static_cast<uintmax_t>(std::numeric_limits<Word>::max()));
+
+        // uintwide_t / constant<Value>;
+        // each limb is divided using a reciprocal which is calculated at compile time
+        template<any_uintwide Rep, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        requires(is_word_divisor<typename Rep::limb_type, Value>) struct divide_by_constant<Rep, Value> {
+        private:
+            using limb = typename Rep::limb_type;
+
+            [[nodiscard]] static constexpr auto divide_magnitude(Rep magnitude) -> Rep
+            {
+                auto& limbs{magnitude.representation()};
+                auto remainder{limb{}};
+                for (auto word{limbs.rbegin()}; word != limbs.rend(); ++word) {
+                    auto const result{constant_word_reciprocal<limb, Value>.divide(remainder, *word)};
+                    *word = result.quotient;
+                    remainder = result.remainder;
+                }
+                return magnitude;
+            }
+
+        public:
+            [[nodiscard]] constexpr auto operator()(Rep const& numerator) const -> Rep
+            {
+                if constexpr (numbers::signedness_v<Rep>) {
+                    auto const is_negative{numerator < Rep{}};
+                    auto const quotient{divide_magnitude(is_negative ? -numerator : numerator)};
+                    return is_negative ? -quotient : quotient;
+                } else {
+                    return divide_magnitude(numerator);
+                }
+            }
+        };
+
+        // duplex_integer / constant<Value>;
+        // each word is divided using a reciprocal which is calculated at compile time
+        template<typename Upper, std::unsigned_integral Lower, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        requires(is_made_of_words<numbers::set_signedness_t<duplex_integer<Upper, Lower>, false>, Lower> && is_word_divisor<Lower, Value>) struct divide_by_constant<duplex_integer<Upper, Lower>, Value> {
+        private:
+            using duplex = duplex_integer<Upper, Lower>;
+            using unsigned_duplex = numbers::set_signedness_t<duplex, false>;
+            using unsigned_upper = numbers::set_signedness_t<Upper, false>;
+
+            [[nodiscard]] static constexpr auto divide_magnitude(unsigned_duplex const& magnitude)
+                    -> unsigned_duplex
+            {
+                auto remainder{Lower{}};
+                return divide_words(magnitude, constant_word_reciprocal<Lower, Value>, remainder);
+            }
+
+        public:
+            [[nodiscard]] constexpr auto operator()(duplex const& numerator) const -> duplex
+            {
+                if constexpr (numbers::signedness_v<duplex>) {
+                    auto const is_negative{numerator < duplex{0}};
+                    auto const magnitude{is_negative ? -numerator : numerator};
+                    auto const quotient{divide_magnitude(
+                            unsigned_duplex(static_cast<unsigned_upper>(magnitude.upper()), magnitude.lower()))};
+                    auto const signed_quotient{duplex(static_cast<Upper>(quotient.upper()), quotient.lower())};
+                    return is_negative ? -signed_quotient : signed_quotient;
+                } else {
+                    return divide_magnitude(numerator);
+                }
+            }
+        };
+    }
+}
+
+#endif  // CNL_IMPL_WIDE_TAG_DIVIDE_BY_CONSTANT_H
@@ -0,0 +1,295 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief multiplication of multiword wide_tag representations
+
+#if !defined(CNL_IMPL_WIDE_TAG_MULTIPLY_H)
+#define CNL_IMPL_WIDE_TAG_MULTIPLY_H
+
+#include "../custom_operator/definition.h"
+#include "../custom_operator/op.h"
+#include "../num_traits/digits.h"
+#include "../wide-integer.h"
+#include "custom_operator.h"
+#include "definition.h"
+
+#include <algorithm>
+#include <array>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        /// \brief number of limbs at and above which a full product of multiword integers
+        /// is computed using Karatsuba multiplication instead of schoolbook multiplication
+        ///
+        /// \note Tuned on x86-64 with 64-bit limbs; see bm_wide_multiply in test/benchmark/benchmark.cpp.
+        inline constexpr int wide_multiply_karatsuba_threshold = 48;
+
+        // multiplication of little-endian arrays of unsigned limbs
+        template<typename Limb, typename DoubleLimb, int KaratsubaThreshold = wide_multiply_karatsuba_threshold>
+        struct limb_multiplier {
+            static_assert(KaratsubaThreshold >= 2);
+
+            static constexpr auto limb_digits{digits_v<Limb>};
+
+            // splitting a low product only saves work if its full half-product uses Karatsuba
+            static constexpr auto low_threshold{2 * KaratsubaThreshold};
+
+            // number of limbs of scratch space required by karatsuba_full
+            [[nodiscard]] static constexpr auto full_scratch_size(int n) -> int
+            {
+                if (n < KaratsubaThreshold) {
+                    return 0;
+                }
+                auto const h{(n + 1) / 2};
+                return 6 * h + 1 + full_scratch_size(h);
+            }
+
+            // number of limbs of scratch space required by karatsuba_low
+            [[nodiscard]] static constexpr auto low_scratch_size(int n) -> int
+            {
+                if (n < low_threshold) {
+                    return 0;
+                }
+                auto const h{(n + 1) / 2};
+                auto const m{n - h};
+                return std::max(2 * h + full_scratch_size(h), m + low_scratch_size(m));
+            }
+
+            // r[0, n) = a[0, n) + b[0, n); returns carry
+            static constexpr auto add(Limb* r, Limb const* a, Limb const* b, int n) -> Limb
+            {
+                auto carry{Limb{0}};
+                for (auto i{0}; i != n; ++i) {
+                    auto const sum{DoubleLimb{a[i]} + b[i] + carry};
+                    r[i] = static_cast<Limb>(sum);
+                    carry = static_cast<Limb>(sum >> limb_digits);
+                }
+                return carry;
+            }
+
+            // r[0, n) = a[0, n) - b[0, n); returns borrow
+            static constexpr auto subtract(Limb* r, Limb const* a, Limb const* b, int n) -> Limb
+            {
+                auto borrow{Limb{0}};
+                for (auto i{0}; i != n; ++i) {
+                    auto const difference{DoubleLimb{a[i]} - b[i] - borrow};
+                    r[i] = static_cast<Limb>(difference);
+                    borrow = static_cast<Limb>(difference >> limb_digits) & 1;
+                }
+                return borrow;
+            }
+
+            // r[0, n) += carry; returns carry
+            static constexpr auto propagate_carry(Limb* r, int n, Limb carry) -> Limb
+            {
+                for (auto i{0}; carry && i != n; ++i) {
+                    r[i] = static_cast<Limb>(r[i] + carry);
+                    carry = r[i] < carry;
+                }
+                return carry;
+            }
+
+            // r[0, n) -= borrow; returns borrow
+            static constexpr auto propagate_borrow(Limb* r, int n, Limb borrow) -> Limb
+            {
+                for (auto i{0}; borrow && i != n; ++i) {
+                    borrow = r[i] < borrow;
+                    r[i] = static_cast<Limb>(r[i] - 1);
+                }
+                return borrow;
+            }
+
+            // r[0, n) = |a[0, n) - b[0, n)|; returns true iff a < b
+            static constexpr auto absolute_difference(Limb* r, Limb const* a, Limb const* b, int n) -> bool
+            {
+                auto i{n};
+                while (i && a[i - 1] == b[i - 1]) {
+                    --i;
+                }
+                auto const is_negative{i && a[i - 1] < b[i - 1]};
+                if (is_negative) {
+                    subtract(r, b, a, n);
+                } else {
+                    subtract(r, a, b, n);
+                }
+                return is_negative;
+            }
+
+            // r[0, 2n) = a[0, n) * b[0, n)
+            static constexpr void schoolbook_full(Limb* r, Limb const* a, Limb const* b, int n)
+            {
+                std::fill(r, r + 2 * n, Limb{0});
+                for (auto i{0}; i != n; ++i) {
+                    auto carry{Limb{0}};
+                    for (auto j{0}; j != n; ++j) {
+                        auto const product{DoubleLimb{a[i]} * b[j] + r[i + j] + carry};
+                        r[i + j] = static_cast<Limb>(product);
+                        carry = static_cast<Limb>(product >> limb_digits);
+                    }
+                    r[i + n] = carry;
+                }
+            }
+
+            // r[0, n) = low n limbs of a[0, n) * b[0, n)
+            static constexpr void schoolbook_low(Limb* r, Limb const* a, Limb const* b, int n)
+            {
+                std::fill(r, r + n, Limb{0});
+                for (auto i{0}; i != n; ++i) {
+                    auto carry{Limb{0}};
+                    for (auto j{0}; j != n - i; ++j) {
+                        auto const product{DoubleLimb{a[i]} * b[j] + r[i + j] + carry};
+                        r[i + j] = static_cast<Limb>(product);
+                        carry = static_cast<Limb>(product >> limb_digits);
+                    }
+                }
+            }
+
+            // r[0, 2n) = a[0, n) * b[0, n) using subtractive Karatsuba multiplication;
+            // a = a1*B^h + a0, b = b1*B^h + b0 and
+            // a*b = z2*B^2h + (z0 + z2 + (a0 - a1)(b1 - b0))*B^h + z0
+            static constexpr void karatsuba_full(Limb* r, Limb const* a, Limb const* b, int n, Limb* scratch)
+            {
+                if (n < KaratsubaThreshold) {
+                    schoolbook_full(r, a, b, n);
+                    return;
+                }
+
+                auto const h{(n + 1) / 2};
+                auto const m{n - h};
+
+                auto* const a_difference{scratch};
+                auto* const b_difference{a_difference + h};
+                auto* const t{b_difference + h};
+                auto* const middle{t + 2 * h};
+                auto* const next_scratch{middle + 2 * h + 1};
+
+                // zero-extended high halves
+                auto* const a1{t};
+                auto* const b1{t + h};
+                std::fill(a1, a1 + 2 * h, Limb{0});
+                std::copy(a + h, a + n, a1);
+                std::copy(b + h, b + n, b1);
+                auto const is_negative{
+                        absolute_difference(a_difference, a, a1, h)
+                        != absolute_difference(b_difference, b1, b, h)};
+
+                // z0 = a0*b0 and z2 = a1*b1
+                karatsuba_full(r, a, b, h, next_scratch);
+                karatsuba_full(r + 2 * h, a + h, b + h, m, next_scratch);
+
+                // middle = z0 + z2
+                std::fill(middle, middle + 2 * h + 1, Limb{0});
+                std::copy(r + 2 * h, r + 2 * n, middle);
+                middle[2 * h] = add(middle, middle, r, 2 * h);
+
+                // middle +/-= |a0 - a1| * |b1 - b0|
+                karatsuba_full(t, a_difference, b_difference, h, next_scratch);
+                if (is_negative) {
+                    propagate_borrow(middle + 2 * h, 1, subtract(middle, middle, t, 2 * h));
+                } else {
+                    middle[2 * h] = static_cast<Limb>(middle[2 * h] + add(middle, middle, t, 2 * h));
+                }
+
+                // r += middle*B^h
+                auto const tail{2 * n - h};
+                auto const middle_size{std::min(2 * h + 1, tail)};
+                propagate_carry(
+                        r + h + middle_size, tail - middle_size,
+                        add(r + h, r + h, middle, middle_size));
+            }
+
+            // r[0, n) = low n limbs of a[0, n) * b[0, n);
+            // a*b mod B^n = z0 + ((a0*b1 + a1*b0) mod B^m)*B^h
+            static constexpr void karatsuba_low(Limb* r, Limb const* a, Limb const* b, int n, Limb* scratch)
+            {
+                if (n < low_threshold) {
+                    schoolbook_low(r, a, b, n);
+                    return;
+                }
+
+                auto const h{(n + 1) / 2};
+                auto const m{n - h};
+
+                auto* const z0{scratch};
+                karatsuba_full(z0, a, b, h, z0 + 2 * h);
+                std::copy(z0, z0 + n, r);
+
+                auto* const cross{scratch};
+                auto* const next_scratch{cross + m};
+                karatsuba_low(cross, a, b + h, m, next_scratch);
+                add(r + h, r + h, cross, m);
+                karatsuba_low(cross, a + h, b, m, next_scratch);
+                add(r + h, r + h, cross, m);
+            }
+
+            // r[0, n) = low n limbs of a[0, n) * b[0, n)
+            template<int N>
+            static constexpr void multiply_low(Limb* r, Limb const* a, Limb const* b)
+            {
+                std::array<Limb, std::max(1, low_scratch_size(N))> scratch{};
+                karatsuba_low(r, a, b, N, scratch.data());
+            }
+        };
+
+        template<typename Rep>
+        struct wide_multiply_traits;
+
+        template<std::uint32_t Width, typename LimbType, typename AllocatorType, bool IsSigned>
+        struct wide_multiply_traits<math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>> {
+            using rep = math::wide_integer::uintwide_t<Width, LimbType, AllocatorType, IsSigned>;
+            using limb = typename rep::limb_type;
+            using double_limb = typename rep::double_limb_type;
+
+            static constexpr auto num_limbs{static_cast<int>(Width) / digits_v<limb>};
+        };
+
+        /// \brief multiplies two multiword integers, truncating the result to the width of the operands
+        ///
+        /// \tparam KaratsubaThreshold number of limbs below which full products
+        /// are computed using schoolbook multiplication
+        template<int KaratsubaThreshold = wide_multiply_karatsuba_threshold, any_uintwide Rep>
+        [[nodiscard]] constexpr auto wide_multiply(Rep const& lhs, Rep const& rhs)
+        {
+            using traits = wide_multiply_traits<Rep>;
+            using multiplier = limb_multiplier<
+                    typename traits::limb, typename traits::double_limb, KaratsubaThreshold>;
+
+            Rep product{};
+            multiplier::template multiply_low<traits::num_limbs>(
+                    product.representation().data(),
+                    lhs.crepresentation().data(),
+                    rhs.crepresentation().data());
+            return product;
+        }
+    }
+
+    /// \cond
+    template<int LhsDigits, class LhsNarrowest, int RhsDigits, class RhsNarrowest, _impl::any_uintwide Rep>
+    struct custom_operator<
+            _impl::multiply_op,
+            op_value<Rep, wide_tag<LhsDigits, LhsNarrowest>>,
+            op_value<Rep, wide_tag<RhsDigits, RhsNarrowest>>> {
+    private:
+        using result = _impl::wide_tag_arithmetic_result_t<LhsDigits, LhsNarrowest, RhsDigits, RhsNarrowest>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(Rep const& lhs, Rep const& rhs) const -> result
+        {
+            using traits = _impl::wide_multiply_traits<Rep>;
+            using multiplier = _impl::limb_multiplier<typename traits::limb, typename traits::double_limb>;
+            if constexpr (traits::num_limbs < multiplier::low_threshold) {
+                // uintwide_t's own schoolbook multiplication
+                return static_cast<result>(lhs * rhs);
+            } else {
+                return static_cast<result>(_impl::wide_multiply(lhs, rhs));
+            }
+        }
+    };
+    /// \endcond
+}
+
+#endif  // CNL_IMPL_WIDE_TAG_MULTIPLY_H
@@ -11,6 +11,7 @@
 #include "wrapper/comparison_operator.h"
 #include "wrapper/declaration.h"
 #include "wrapper/definition.h"
+#include "wrapper/divide_by_constant.h"
 #include "wrapper/digits.h"
 #include "wrapper/from_rep.h"
 #include "wrapper/from_value.h"
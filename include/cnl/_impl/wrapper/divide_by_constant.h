@@ -0,0 +1,90 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief division of wrappers by a \ref cnl::constant
+
+#if !defined(CNL_IMPL_WRAPPER_DIVIDE_BY_CONSTANT_H)
+#define CNL_IMPL_WRAPPER_DIVIDE_BY_CONSTANT_H
+
+#include "../../constant.h"
+#include "../custom_operator/definition.h"
+#include "../custom_operator/op.h"
+#include "../custom_operator/tag.h"
+#include "../divide_by_constant.h"
+#include "../num_traits/from_value.h"
+#include "../num_traits/rep_of.h"
+#include "../rounding/is_rounding_tag.h"
+#include "../rounding/native_rounding_tag.h"
+#include "../rounding/nearest_rounding_tag.h"
+#include "../rounding/neg_inf_rounding_tag.h"
+#include "../scaled/is_scaled_tag.h"
+#include "definition.h"
+#include "from_rep.h"
+#include "to_rep.h"
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // true iff division of a wrapper with the given tag by constant<Value>
+        // can be expressed as truncating division of its rep by Value;
+        // scaled_integer converts the constant to a differently-scaled divisor
+        template<typename Tag, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        inline constexpr auto can_divide_by_constant =
+                std::integral<decltype(Value)> && (Value > 0) && !scaled_tag<Tag>
+                && (!rounding_tag<Tag> || std::is_same_v<Tag, native_rounding_tag>
+                    || std::is_same_v<Tag, nearest_rounding_tag> || std::is_same_v<Tag, neg_inf_rounding_tag>);
+
+        // a wrapper which is the rep of another wrapper
+        template<typename Rep, tag Tag, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        requires(can_divide_by_constant<Tag, Value>) struct divide_by_constant<wrapper<Rep, Tag>, Value> {
+            [[nodiscard]] constexpr auto operator()(wrapper<Rep, Tag> const& numerator) const
+            {
+                return numerator / constant<Value>{};
+            }
+        };
+    }
+
+    // any_wrapper / constant
+    template<typename Rep, tag Tag, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+    requires(_impl::can_divide_by_constant<Tag, Value>) struct custom_operator<
+            _impl::divide_op,
+            op_value<_impl::wrapper<Rep, Tag>>,
+            op_value<constant<Value>>> {
+    private:
+        using lhs_type = _impl::wrapper<Rep, Tag>;
+        using rhs_type = decltype(_impl::from_value<lhs_type>(constant<Value>{}));
+        using result_type = decltype(std::declval<lhs_type>() / std::declval<rhs_type>());
+
+        // the rep of the divisor, as it would be passed to the rep operator
+        static constexpr auto divisor_rep{_impl::to_rep(_impl::from_value<lhs_type>(constant<Value>{}))};
+
+        [[nodiscard]] static constexpr auto divide(Rep const& lhs)
+        {
+            if constexpr (std::is_same_v<Tag, nearest_rounding_tag>) {
+                auto const adjusted{(lhs < 0) ? lhs - (divisor_rep / 2) : lhs + (divisor_rep / 2)};
+                return _impl::divide_by_constant<std::remove_const_t<decltype(adjusted)>, Value>{}(adjusted);
+            } else if constexpr (std::is_same_v<Tag, neg_inf_rounding_tag>) {
+                auto const quotient{_impl::divide_by_constant<Rep, Value>{}(lhs)};
+                return (lhs - quotient * divisor_rep < 0) ? quotient - 1 : quotient;
+            } else {
+                return _impl::divide_by_constant<Rep, Value>{}(lhs);
+            }
+        }
+
+    public:
+        [[nodiscard]] constexpr auto operator()(lhs_type const& lhs, constant<Value>) const -> result_type
+        {
+            return _impl::from_rep<result_type>(
+                    static_cast<_impl::rep_of_t<result_type>>(divide(_impl::to_rep(lhs))));
+        }
+    };
+}
+
+#endif  // CNL_IMPL_WRAPPER_DIVIDE_BY_CONSTANT_H
@@ -9,6 +9,7 @@
 
 #include "binary_arithmetic_operator.h"
 #include "comparison_operator.h"
+#include "divide_by_constant.h"
 #include "inc_dec_operator.h"
 #include "shift_operator.h"
 #include "unary_arithmetic_operator.h"
@@ -229,6 +229,7 @@
 #include "cmath.h"
 #include "constant.h"
 #include "cstdint.h"
+#include "divider.h"
 #include "elastic_integer.h"
 #include "elastic_scaled_integer.h"
 #include "fixed_point.h"
@@ -239,6 +240,7 @@
 #include "numeric.h"
 #include "overflow.h"
 #include "overflow_integer.h"
+#include "packed.h"
 #include "rounding.h"
 #include "rounding_integer.h"
 #include "scaled_integer.h"
@@ -0,0 +1,18 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::divider` type
+
+#if !defined(CNL_DIVIDER_H)
+#define CNL_DIVIDER_H
+
+#include "_impl/divider/declaration.h"
+#include "_impl/divider/definition.h"
+#include "_impl/divider/divide.h"
+#include "_impl/divider/rounding_integer.h"
+#include "_impl/divider/scaled_integer.h"
+
+#endif  // CNL_DIVIDER_H
@@ -14,6 +14,7 @@
 #include "_impl/fraction/canonical.h"
 #include "_impl/fraction/ctors.h"
 #include "_impl/fraction/definition.h"
+#include "_impl/fraction/fraction_array.h"
 #include "_impl/fraction/gcd.h"
 #include "_impl/fraction/hash.h"
 #include "_impl/fraction/make_fraction.h"
@@ -14,6 +14,7 @@
 #include "_impl/overflow/custom_operator.h"
 #include "_impl/overflow/native.h"
 #include "_impl/overflow/saturated.h"
+#include "_impl/overflow/sticky.h"
 #include "_impl/overflow/throwing.h"
 #include "_impl/overflow/trapping.h"
 #include "_impl/overflow/undefined.h"
@@ -18,6 +18,7 @@
 #include "_impl/num_traits/from_value.h"
 #include "_impl/num_traits/from_value_recursive.h"
 #include "_impl/num_traits/rep_of.h"
+#include "_impl/overflow/saturated_span.h"
 #include "_impl/ostream.h"
 #include "_impl/wrapper.h"
 
@@ -31,7 +32,7 @@ namespace cnl {
     /// \tparam Rep the underlying type used to represent the value; defaults to `int`
     /// \tparam Tag tag specifying the overflow-handling strategy; defaults to \ref undefined_overflow_tag
     ///
-    /// \sa native_overflow_tag, saturated_overflow_tag, trapping_overflow_tag, undefined_overflow_tag
+    /// \sa native_overflow_tag, saturated_overflow_tag, sticky_overflow_tag, trapping_overflow_tag, undefined_overflow_tag
 
     template<typename Rep = int, overflow_tag Tag = undefined_overflow_tag>
     using overflow_integer = _impl::wrapper<Rep, Tag>;
@@ -0,0 +1,18 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief binary encodings of numbers and views of encoded sequences
+
+#if !defined(CNL_PACKED_H)
+#define CNL_PACKED_H
+
+#include "_impl/packed/bytes.h"
+#include "_impl/packed/packed_array.h"
+#include "_impl/packed/packed_size.h"
+#include "_impl/packed/packed_view.h"
+#include "_impl/packed/varint.h"
+
+#endif  // CNL_PACKED_H
@@ -8,6 +8,7 @@
 #define CNL_ROUNDING_INTEGER_H
 
 #include "_impl/custom_operator/tagged.h"
+#include "_impl/num_traits/digits.h"
 #include "_impl/num_traits/is_composite.h"
 #include "_impl/num_traits/rep_of.h"
 #include "_impl/num_traits/rounding.h"
@@ -17,6 +18,9 @@
 #include "_impl/rounding/convert_operator.h"
 #include "_impl/rounding/is_rounding_tag.h"
 #include "_impl/rounding/nearest_rounding_tag.h"
+#include "_impl/rounding/stochastic_round.h"
+#include "_impl/rounding/stochastic_rounding_tag.h"
+#include "_impl/rounding/tie_to_even_rounding_tag.h"
 #include "_impl/wrapper.h"
 
 #include <type_traits>
@@ -29,7 +33,8 @@ namespace cnl {
     /// \tparam Rep the underlying type used to represent the value; defaults to `int`
     /// \tparam Tag tag specifying the rounding mode; defaults to \ref nearest_rounding_tag
     ///
-    /// \sa native_rounding_tag, nearest_rounding_tag, neg_inf_rounding_tag, tie_to_pos_inf_rounding_tag
+    /// \sa native_rounding_tag, nearest_rounding_tag, neg_inf_rounding_tag, tie_to_pos_inf_rounding_tag,
+    /// tie_to_even_rounding_tag, stochastic_rounding_tag
 
     template<typename Rep = int, rounding_tag Tag = nearest_rounding_tag>
     using rounding_integer = _impl::wrapper<Rep, Tag>;
@@ -63,6 +68,41 @@ namespace cnl {
     requires(Digits < 0) struct scale<Digits, 2, _impl::wrapper<Rep, Tag>>
         : _impl::default_scale<Digits, 2, _impl::wrapper<Rep, Tag>> {
     };
+
+    // adds half to the discarded digits and shifts instead of dividing
+    template<int Digits, class Rep>
+    requires(Digits < 0) struct scale<Digits, 2, _impl::wrapper<Rep, tie_to_even_rounding_tag>> {
+    private:
+        using value_type = _impl::wrapper<Rep, tie_to_even_rounding_tag>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(value_type const& s) const
+        {
+            if constexpr (std::is_integral_v<Rep> && -Digits < digits_v<Rep>) {
+                return _impl::from_rep<value_type>(_impl::tie_to_even_shift_right<-Digits>(_impl::to_rep(s)));
+            } else {
+                return _impl::default_scale<Digits, 2, value_type>{}(s);
+            }
+        }
+    };
+
+    // adds random bits to the discarded digits instead of dividing
+    template<int Digits, class Rep, class Generator>
+    requires(Digits < 0) struct scale<Digits, 2, _impl::wrapper<Rep, stochastic_rounding_tag<Generator>>> {
+    private:
+        using value_type = _impl::wrapper<Rep, stochastic_rounding_tag<Generator>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(value_type const& s) const
+        {
+            if constexpr (std::is_integral_v<Rep> && -Digits < digits_v<Rep>) {
+                return _impl::from_rep<value_type>(_impl::stochastic_shift_right<-Digits>(
+                        _impl::to_rep(s), _impl::stochastic_rounding_bits<Generator>()));
+            } else {
+                return _impl::default_scale<Digits, 2, value_type>{}(s);
+            }
+        }
+    };
     /// \endcond
 
     template<int Digits, int Radix, class Rep, rounding_tag Tag>
@@ -10,12 +10,17 @@
 #if !defined(CNL_SCALED_INTEGER_H)
 #define CNL_SCALED_INTEGER_H
 
+#include "_impl/charconv/from_chars_n.h"
+#include "_impl/charconv/to_chars_n.h"
 #include "_impl/scaled_integer/convert_operator.h"
 #include "_impl/scaled_integer/declaration.h"
 #include "_impl/scaled_integer/definition.h"
 #include "_impl/scaled_integer/extras.h"
 #include "_impl/scaled_integer/fixed_point.h"
+#include "_impl/scaled_integer/format.h"
+#include "_impl/scaled_integer/from_chars.h"
 #include "_impl/scaled_integer/from_rep.h"
+#include "_impl/scaled_integer/hypot.h"
 #include "_impl/scaled_integer/integer.h"
 #include "_impl/scaled_integer/is_wrapper.h"
 #include "_impl/scaled_integer/math.h"
@@ -30,5 +35,6 @@
 #include "_impl/scaled_integer/tag_of.h"
 #include "_impl/scaled_integer/to_chars.h"
 #include "_impl/scaled_integer/to_string.h"
+#include "_impl/scaled_integer/trig.h"
 
 #endif  // CNL_SCALED_INTEGER_H
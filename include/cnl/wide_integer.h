@@ -9,9 +9,11 @@
 
 /// \file
 
+#include "_impl/charconv/from_chars.h"
 #include "_impl/wide_integer/custom_operator.h"
 #include "_impl/wide_integer/definition.h"
 #include "_impl/wide_integer/digits.h"
+#include "_impl/wide_integer/from_value.h"
 #include "_impl/wide_integer/from_rep.h"
 #include "_impl/wide_integer/literals.h"
 #include "_impl/wide_integer/make_wide_integer.h"
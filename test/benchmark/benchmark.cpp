@@ -4,15 +4,34 @@
 //  (See accompanying file ../../LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
+#include "benchmark_types.h"
 #include "sample_functions.h"
 
 #include <cnl/cmath.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/fraction.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/packed.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/wide_integer.h>
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
-
-using cnl::scaled_integer;
+#include <span>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 // entry point
@@ -85,6 +104,472 @@ static void bm_sqrt(benchmark::State& state)
     }
 }
 
+// cnl::sin using integer arithmetic and via conversion to floating-point
+template<class T>
+static void bm_sin(benchmark::State& state)
+{
+    auto input = T{0.7};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input);
+        auto output = cnl::sin(input);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+template<class T>
+static void bm_sin_crib(benchmark::State& state)
+{
+    using rep = cnl::_impl::rep_of_t<T>;
+    constexpr auto exponent = cnl::_impl::tag_of_t<T>::exponent;
+    auto input = T{0.7};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input);
+        auto output = cnl::_impl::crib<rep, exponent, 2, std::sin>(input);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// cnl::atan2 using integer arithmetic and via conversion to floating-point
+template<class T>
+static void bm_atan2(benchmark::State& state)
+{
+    auto y = T{-0.7};
+    auto x = T{0.4};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(y);
+        benchmark::DoNotOptimize(x);
+        auto output = cnl::atan2(y, x);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+template<class T>
+static void bm_atan2_crib(benchmark::State& state)
+{
+    using fp = cnl::_impl::float_of_same_size<cnl::_impl::rep_of_t<T>>;
+    auto y = T{-0.7};
+    auto x = T{0.4};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(y);
+        benchmark::DoNotOptimize(x);
+        auto output = static_cast<T>(std::atan2(static_cast<fp>(y), static_cast<fp>(x)));
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+template<class T>
+static void bm_hypot(benchmark::State& state)
+{
+    auto x = T{-0.7};
+    auto y = T{0.4};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(x);
+        benchmark::DoNotOptimize(y);
+        auto output = cnl::hypot(x, y);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+template<class T>
+static void bm_exp2(benchmark::State& state)
+{
+    auto input = T{-1.3};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input);
+        auto output = cnl::exp2(input);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+template<class T>
+static void bm_exp2_crib(benchmark::State& state)
+{
+    using rep = cnl::_impl::rep_of_t<T>;
+    constexpr auto exponent = cnl::_impl::tag_of_t<T>::exponent;
+    auto input = T{-1.3};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input);
+        auto output = cnl::_impl::crib<rep, exponent, 2, std::exp2>(input);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+template<class T>
+static auto exp2_inputs()
+{
+    std::vector<T> inputs(1024);
+    for (auto index = std::size_t{0}; index != inputs.size(); ++index) {
+        inputs[index] = T{-4. + 8. * static_cast<double>(index) / static_cast<double>(inputs.size())};
+    }
+    return inputs;
+}
+
+// cnl::exp2 of 1024 values, one at a time and as a sequence
+template<class T>
+static void bm_exp2_loop(benchmark::State& state)
+{
+    auto const input = exp2_inputs<T>();
+    std::vector<T> output(input.size());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        for (auto index = std::size_t{0}; index != input.size(); ++index) {
+            output[index] = cnl::exp2(input[index]);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+template<class T>
+static void bm_exp2_span(benchmark::State& state)
+{
+    auto const input = exp2_inputs<T>();
+    std::vector<T> output(input.size());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        cnl::exp2(std::span<T const>{input}, std::span<T>{output});
+        benchmark::ClobberMemory();
+    }
+}
+
+template<class T>
+static void bm_log2(benchmark::State& state)
+{
+    auto input = T{5.3};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input);
+        auto output = cnl::log2(input);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+template<class T>
+static void bm_log2_crib(benchmark::State& state)
+{
+    using rep = cnl::_impl::rep_of_t<T>;
+    constexpr auto exponent = cnl::_impl::tag_of_t<T>::exponent;
+    auto input = T{5.3};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input);
+        auto output = cnl::_impl::crib<rep, exponent, 2, std::log2>(input);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// comma-separated decimal representations of 1024 values of T, as found in a CSV file
+template<class T>
+static auto csv_inputs()
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    std::string csv;
+    for (auto index = 0; index != 1024; ++index) {
+        std::array<char, 32> chars{};
+        auto const value = max * std::sin(index);
+        auto const length = std::snprintf(chars.data(), chars.size(), "%.6f,", value);
+        csv.append(chars.data(), static_cast<std::size_t>(length));
+    }
+    return csv;
+}
+
+// parsing of comma-separated values with cnl::from_chars and with std::strtod followed by conversion
+template<class T>
+static void bm_from_chars(benchmark::State& state)
+{
+    auto const csv = csv_inputs<T>();
+    std::vector<T> output(1024);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(csv.data());
+        auto const* first = csv.data();
+        auto const* const last = csv.data() + csv.size();
+        for (auto& value : output) {
+            first = cnl::from_chars(first, last, value).ptr + 1;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
+template<class T>
+static void bm_from_chars_strtod(benchmark::State& state)
+{
+    auto const csv = csv_inputs<T>();
+    std::vector<T> output(1024);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(csv.data());
+        auto const* first = csv.data();
+        for (auto& value : output) {
+            char* end{};
+            value = T{std::strtod(first, &end)};
+            first = end + 1;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
+// formatting of 1024 values with cnl::to_chars
+template<class T>
+static void bm_to_chars(benchmark::State& state)
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    std::vector<T> input(1024);
+    for (auto index = std::size_t{0}; index != input.size(); ++index) {
+        input[index] = T{max * std::sin(static_cast<double>(index))};
+    }
+    std::vector<char> output(input.size() * 48);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        auto* first = output.data();
+        for (auto const& value : input) {
+            first = cnl::to_chars(first, first + 47, value).ptr;
+            *first++ = ',';
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// formatting of 1024 values as comma-separated text with cnl::to_chars_n and one at a time with to_chars_static
+template<class T>
+static void bm_to_chars_n(benchmark::State& state)
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    std::vector<T> input(1024);
+    for (auto index = std::size_t{0}; index != input.size(); ++index) {
+        input[index] = T{max * std::sin(static_cast<double>(index))};
+    }
+    std::vector<char> output(input.size() * 48);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        auto const result = cnl::to_chars_n(
+                std::span<T const>{input}, output.data(), output.data() + output.size(), ',');
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+}
+
+template<class T>
+static void bm_to_chars_static(benchmark::State& state)
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    std::vector<T> input(1024);
+    for (auto index = std::size_t{0}; index != input.size(); ++index) {
+        input[index] = T{max * std::sin(static_cast<double>(index))};
+    }
+    std::vector<char> output(input.size() * 48);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        auto* first = output.data();
+        for (auto const& value : input) {
+            auto const chars = cnl::to_chars_static(value);
+            first = std::copy_n(chars.chars.data(), chars.length, first);
+            *first++ = ',';
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// formatting of 1024 values in fixed notation with cnl::format_to
+template<class T>
+static void bm_format_to(benchmark::State& state)
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    std::vector<T> input(1024);
+    for (auto index = std::size_t{0}; index != input.size(); ++index) {
+        input[index] = T{max * std::sin(static_cast<double>(index))};
+    }
+    auto spec = cnl::format_spec{};
+    spec.type = 'f';
+    std::vector<char> output(input.size() * 48);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        auto* first = output.data();
+        for (auto const& value : input) {
+            first = cnl::format_to(first, spec, value);
+            *first++ = ',';
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// streaming of 1024 values to a std::ostream, directly and as C strings
+template<class T>
+static void bm_ostream(benchmark::State& state)
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    std::vector<T> input(1024);
+    for (auto index = std::size_t{0}; index != input.size(); ++index) {
+        input[index] = T{max * std::sin(static_cast<double>(index))};
+    }
+    std::ostringstream out;
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        out.seekp(0);
+        for (auto const& value : input) {
+            out << value << ',';
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+template<class T>
+static void bm_ostream_c_str(benchmark::State& state)
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    std::vector<T> input(1024);
+    for (auto index = std::size_t{0}; index != input.size(); ++index) {
+        input[index] = T{max * std::sin(static_cast<double>(index))};
+    }
+    std::ostringstream out;
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        out.seekp(0);
+        for (auto const& value : input) {
+            out << cnl::to_chars_static(value).chars.data() << ',';
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// parsing of comma-separated values from a std::istream, exactly and via long double
+template<class T>
+static void bm_parse_istream(benchmark::State& state)
+{
+    auto csv = csv_inputs<T>();
+    std::replace(csv.begin(), csv.end(), ',', ' ');
+    std::istringstream in(csv);
+    std::vector<T> output(1024);
+    while (state.KeepRunning()) {
+        in.clear();
+        in.seekg(0);
+        for (auto& value : output) {
+            in >> value;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
+template<class T>
+static void bm_parse_istream_long_double(benchmark::State& state)
+{
+    auto csv = csv_inputs<T>();
+    std::replace(csv.begin(), csv.end(), ',', ' ');
+    std::istringstream in(csv);
+    std::vector<T> output(1024);
+    while (state.KeepRunning()) {
+        in.clear();
+        in.seekg(0);
+        for (auto& value : output) {
+            long double ld{};
+            in >> ld;
+            value = T{ld};
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
+// parsing of comma-separated values with cnl::from_chars_n
+template<class T>
+static void bm_from_chars_n(benchmark::State& state)
+{
+    auto const csv = csv_inputs<T>();
+    std::vector<T> output(1024);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(csv.data());
+        auto const result = cnl::from_chars_n(csv.data(), csv.data() + csv.size(), std::span{output}, ',');
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
+// formatting of 1024 integers which use most of the digits of T
+template<class T>
+static void bm_to_chars_integer(benchmark::State& state)
+{
+    std::vector<T> input(1024);
+    auto seed = std::uint64_t{0x9e3779b97f4a7c15};
+    for (auto& value : input) {
+        for (auto bits = 30; bits < cnl::digits_v<T>; bits += 30) {
+            seed = seed * 6364136223846793005 + 1442695040888963407;
+            value = value * T{0x40000000} + T{static_cast<int>(seed >> 34)};
+        }
+    }
+    std::vector<char> output(input.size() * 80);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        auto* first = output.data();
+        for (auto const& value : input) {
+            first = cnl::to_chars(first, first + 79, value).ptr;
+            *first++ = ',';
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// comma-separated 18- and 19-digit integers
+static auto csv_integers()
+{
+    std::string csv;
+    auto value = std::uint64_t{0x9e3779b97f4a7c15};
+    for (auto index = 0; index != 1024; ++index) {
+        value = value * 6364136223846793005 + 1442695040888963407;
+        csv += std::to_string(static_cast<std::int64_t>(value >> 1) / ((index & 1) + 1));
+        csv += ',';
+    }
+    return csv;
+}
+
+// parsing of integers with cnl::_impl::parse, cnl::from_chars and std::from_chars
+static void bm_parse_int64(benchmark::State& state)
+{
+    auto csv = csv_integers();
+    std::replace(std::begin(csv), std::end(csv), ',', '\0');
+    std::vector<std::int64_t> output(1024);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(csv.data());
+        auto const* first = csv.data();
+        for (auto& value : output) {
+            value = cnl::_impl::parse<std::int64_t>(first);
+            first += std::strlen(first) + 1;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
+static void bm_from_chars_int64(benchmark::State& state)
+{
+    auto const csv = csv_integers();
+    std::vector<std::int64_t> output(1024);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(csv.data());
+        auto const* first = csv.data();
+        auto const* const last = csv.data() + csv.size();
+        for (auto& value : output) {
+            first = cnl::from_chars(first, last, value).ptr + 1;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
+static void bm_from_chars_int64_std(benchmark::State& state)
+{
+    auto const csv = csv_integers();
+    std::vector<std::int64_t> output(1024);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(csv.data());
+        auto const* first = csv.data();
+        auto const* const last = csv.data() + csv.size();
+        for (auto& value : output) {
+            first = std::from_chars(first, last, value).ptr + 1;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * csv.size()));
+}
+
 template<class T>
 static void bm_magnitude_squared(benchmark::State& state)
 {
@@ -143,69 +628,563 @@ static void circle_intersect_generic(benchmark::State& state)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// scaled_integer types
+// multiword integer multiplication
+
+#if defined(CNL_INT128_ENABLED)
+using wide_limb = uint64_t;
+#else
+using wide_limb = uint32_t;
+#endif
+
+// never splits products in order to use Karatsuba multiplication
+constexpr auto wide_multiply_schoolbook{1 << 20};
+
+template<int Digits, int KaratsubaThreshold>
+static void bm_wide_multiply(benchmark::State& state)
+{
+    using rep = typename cnl::wide_tag<Digits, wide_limb>::rep;
+    auto factor1 = static_cast<rep>(std::numeric_limits<rep>::max() / 5U);
+    auto factor2 = static_cast<rep>(std::numeric_limits<rep>::max() / 3U);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(factor1);
+        benchmark::DoNotOptimize(factor2);
+        auto value = cnl::_impl::wide_multiply<KaratsubaThreshold>(factor1, factor2);
+        benchmark::DoNotOptimize(value);
+    }
+}
 
-using u4_4 = scaled_integer<uint8_t, cnl::power<-4>>;
-using s3_4 = scaled_integer<int8_t, cnl::power<-4>>;
-using u8_8 = scaled_integer<uint16_t, cnl::power<-8>>;
-using s7_8 = scaled_integer<int16_t, cnl::power<-8>>;
-using u16_16 = scaled_integer<uint32_t, cnl::power<-16>>;
-using s15_16 = scaled_integer<int32_t, cnl::power<-16>>;
-using u32_32 = scaled_integer<uint64_t, cnl::power<-32>>;
-using s31_32 = scaled_integer<int64_t, cnl::power<-32>>;
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define WIDE_MULTIPLY_BENCHMARK(digits) \
+    BENCHMARK_TEMPLATE2(bm_wide_multiply, digits, wide_multiply_schoolbook); \
+    BENCHMARK_TEMPLATE2(bm_wide_multiply, digits, cnl::_impl::wide_multiply_karatsuba_threshold);
 
 ////////////////////////////////////////////////////////////////////////////////
-// multi-type benchmark macros
+// multiword integer representations; see cnl::wide_tag_backend_v
+
+template<int Digits, cnl::wide_tag_backend Backend>
+using wide_backend_rep = typename cnl::_impl::wide_tag_multiword_rep<Digits, int, Backend>::type;
+
+template<int Digits, cnl::wide_tag_backend Backend>
+static void bm_wide_backend_add(benchmark::State& state)
+{
+    using rep = wide_backend_rep<Digits, Backend>;
+    auto addend1 = static_cast<rep>(std::numeric_limits<rep>::max() / 5);
+    auto addend2 = static_cast<rep>(std::numeric_limits<rep>::max() / 3);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(addend1);
+        benchmark::DoNotOptimize(addend2);
+        auto value = addend1 + addend2;
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+template<int Digits, cnl::wide_tag_backend Backend>
+static void bm_wide_backend_mul(benchmark::State& state)
+{
+    using rep = wide_backend_rep<Digits, Backend>;
+    auto factor1 = static_cast<rep>(std::numeric_limits<rep>::max() / 5);
+    auto factor2 = static_cast<rep>(std::numeric_limits<rep>::max() / 3);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(factor1);
+        benchmark::DoNotOptimize(factor2);
+        auto value = factor1 * factor2;
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+template<int Digits, cnl::wide_tag_backend Backend>
+static void bm_wide_backend_div(benchmark::State& state)
+{
+    using rep = wide_backend_rep<Digits, Backend>;
+    auto nume = static_cast<rep>(std::numeric_limits<rep>::max() / 3);
+    auto denom = static_cast<rep>(std::numeric_limits<rep>::max() >> (Digits / 2));
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(nume);
+        benchmark::DoNotOptimize(denom);
+        auto value = nume / denom;
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+template<int Digits, cnl::wide_tag_backend Backend>
+static void bm_wide_backend_div_constant(benchmark::State& state)
+{
+    using wide = cnl::_impl::wrapper<wide_backend_rep<Digits, Backend>, cnl::wide_tag<Digits, int>>;
+    auto nume = std::numeric_limits<wide>::max() / 3;
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(nume);
+        auto value = nume / cnl::constant<10>{};
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// streaming sums of elements stored in exactly as many bits as they need; see cnl::packed_array
+
+constexpr auto packed_elements{std::size_t{1} << 20};
+
+template<class T>
+static auto packed_inputs()
+{
+    auto const max = static_cast<double>(std::numeric_limits<T>::max());
+    auto input = std::vector<T>(packed_elements);
+    for (auto index = std::size_t{0}; index != input.size(); ++index) {
+        input[index] = T{max * std::sin(static_cast<double>(index))};
+    }
+    return input;
+}
+
+template<class T>
+static void bm_sum_vector(benchmark::State& state)
+{
+    auto const input = packed_inputs<T>();
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        auto sum = std::int64_t{0};
+        for (auto const& value : input) {
+            sum += static_cast<std::int64_t>(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * packed_elements));
+}
+
+// reads one element at a time
+template<class T>
+static void bm_sum_packed_array(benchmark::State& state)
+{
+    auto const input = cnl::packed_array<T>(packed_inputs<T>());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.words().data());
+        auto sum = std::int64_t{0};
+        for (auto const value : input) {
+            sum += static_cast<std::int64_t>(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * packed_elements));
+}
+
+// reads runs of elements with cnl::packed_array::unpack
+template<class T>
+static void bm_sum_packed_array_unpack(benchmark::State& state)
+{
+    auto const input = cnl::packed_array<T>(packed_inputs<T>());
+    std::array<T, 256> run{};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.words().data());
+        auto sum = std::int64_t{0};
+        for (auto first = std::size_t{0}; first != packed_elements; first += run.size()) {
+            input.unpack(first, run);
+            for (auto const& value : run) {
+                sum += static_cast<std::int64_t>(value);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * packed_elements));
+}
+
+// writes every element with cnl::packed_array::pack
+template<class T>
+static void bm_pack_packed_array(benchmark::State& state)
+{
+    auto const input = packed_inputs<T>();
+    auto output = cnl::packed_array<T>(packed_elements);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        output.pack(0, input);
+        benchmark::DoNotOptimize(output.words().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * packed_elements));
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PACKED_ARRAY_BENCHMARKS(type) \
+    BENCHMARK_TEMPLATE1(bm_sum_vector, type); \
+    BENCHMARK_TEMPLATE1(bm_sum_packed_array, type); \
+    BENCHMARK_TEMPLATE1(bm_sum_packed_array_unpack, type); \
+    BENCHMARK_TEMPLATE1(bm_pack_packed_array, type);
+
+////////////////////////////////////////////////////////////////////////////////
+// element-wise addition of overflow_integer, handling overflow with different tags
+
+constexpr auto num_overflow_elements{4096};
+
+static auto overflow_inputs(int seed)
+{
+    auto inputs = std::vector<std::int32_t>(num_overflow_elements);
+    for (auto index = 0; index != num_overflow_elements; ++index) {
+        inputs[index] = (index * 7919 + seed) % 2000000001 - 1000000000;
+    }
+    return inputs;
+}
+
+template<class Tag>
+static void bm_overflow_add(benchmark::State& state)
+{
+    using integer = cnl::overflow_integer<std::int32_t, Tag>;
+    auto const lhs_inputs = overflow_inputs(1);
+    auto const rhs_inputs = overflow_inputs(2);
+    auto const lhs = std::vector<integer>(lhs_inputs.begin(), lhs_inputs.end());
+    auto const rhs = std::vector<integer>(rhs_inputs.begin(), rhs_inputs.end());
+    auto result = std::vector<integer>(num_overflow_elements);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = lhs[index] + rhs[index];
+        }
+        if constexpr (std::is_same_v<Tag, cnl::sticky_overflow_tag>) {
+            // one check for the whole batch
+            benchmark::DoNotOptimize(cnl::clear_sticky_overflow());
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_overflow_elements);
+}
+
+// element-wise saturated addition of Rep values, one element at a time or as a span
+template<typename Rep>
+static auto saturated_inputs(int seed)
+{
+    using integer = cnl::overflow_integer<Rep, cnl::saturated_overflow_tag>;
+    auto const inputs = overflow_inputs(seed);
+    auto result = std::vector<integer>(inputs.size());
+    for (auto index = std::size_t{0}; index != inputs.size(); ++index) {
+        // scaled so that some, but not all, sums saturate
+        result[index] = integer{static_cast<Rep>(inputs[index] >> (cnl::digits_v<std::int32_t> - cnl::digits_v<Rep>))};
+    }
+    return result;
+}
+
+template<typename Rep>
+static void bm_saturated_add(benchmark::State& state)
+{
+    using integer = cnl::overflow_integer<Rep, cnl::saturated_overflow_tag>;
+    auto const lhs = saturated_inputs<Rep>(1);
+    auto const rhs = saturated_inputs<Rep>(2);
+    auto result = std::vector<integer>(num_overflow_elements);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = lhs[index] + rhs[index];
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_overflow_elements);
+}
+
+template<typename Rep>
+static void bm_saturated_add_span(benchmark::State& state)
+{
+    using integer = cnl::overflow_integer<Rep, cnl::saturated_overflow_tag>;
+    auto const lhs = saturated_inputs<Rep>(1);
+    auto const rhs = saturated_inputs<Rep>(2);
+    auto result = std::vector<integer>(num_overflow_elements);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        cnl::add(std::span<integer const>(lhs), std::span<integer const>(rhs), std::span<integer>(result));
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_overflow_elements);
+}
+
+// accumulation of overflow_integer values whose rep is a wide_integer
+template<class Tag>
+static void bm_overflow_accumulate_wide(benchmark::State& state)
+{
+    using integer = cnl::overflow_integer<cnl::wide_integer<256>, Tag>;
+    auto const inputs = overflow_inputs(1);
+    auto const addends = std::vector<integer>(inputs.begin(), inputs.end());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(addends.data());
+        auto sum = integer{0};
+        for (auto const& addend : addends) {
+            sum += addend;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * num_overflow_elements);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// conversion of many values to 16-bit fixed-point, rounding to nearest, to even or stochastically
+
+constexpr auto num_rounded_elements{4096};
+
+template<class Tag>
+using rounded_fixed_point = cnl::scaled_integer<cnl::rounding_integer<std::int16_t, Tag>, cnl::power<-8>>;
+
+using stochastic_fixed_point = rounded_fixed_point<cnl::stochastic_rounding_tag<>>;
+
+using rounding_source_fixed_point = cnl::scaled_integer<std::int32_t, cnl::power<-16>>;
+
+template<typename Source>
+static auto rounding_inputs()
+{
+    auto result = std::vector<Source>(num_rounded_elements);
+    for (auto index = std::size_t{0}; index != result.size(); ++index) {
+        result[index] = static_cast<Source>(static_cast<double>(index % 1999) * .0137 - 13.);
+    }
+    return result;
+}
+
+template<class Tag, typename Source>
+static void bm_round(benchmark::State& state)
+{
+    using number = rounded_fixed_point<Tag>;
+    auto const inputs = rounding_inputs<Source>();
+    auto result = std::vector<number>(inputs.size());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(inputs.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = number{inputs[index]};
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rounded_elements);
+}
+
+template<typename Source>
+static void bm_stochastic_round_span(benchmark::State& state)
+{
+    auto const inputs = rounding_inputs<Source>();
+    auto result = std::vector<stochastic_fixed_point>(inputs.size());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(inputs.data());
+        cnl::stochastic_round(std::span<Source const>(inputs), std::span<stochastic_fixed_point>(result));
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rounded_elements);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// operations on many fractions: std::vector<cnl::fraction> vs cnl::fraction_array
+
+constexpr auto num_fractions{4096};
+
+static auto fraction_inputs(int seed)
+{
+    auto fractions = std::vector<cnl::fraction<int>>{};
+    for (auto index = 0; index != num_fractions; ++index) {
+        fractions.emplace_back(
+                ((index * 37 + seed) % 1999 - 999) * 6, ((index * 53 + seed) % 997 + 1) * 4);
+    }
+    return fractions;
+}
+
+static void bm_fraction_add(benchmark::State& state)
+{
+    auto const lhs = fraction_inputs(1);
+    auto const rhs = fraction_inputs(2);
+    auto result = std::vector<cnl::fraction<int>>(num_fractions, cnl::fraction<int>{0});
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = lhs[index] + rhs[index];
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+static void bm_fraction_array_add(benchmark::State& state)
+{
+    auto const lhs = cnl::fraction_array<int>{fraction_inputs(1)};
+    auto const rhs = cnl::fraction_array<int>{fraction_inputs(2)};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(lhs.numerators().data());
+        benchmark::DoNotOptimize(rhs.numerators().data());
+        auto const result = lhs + rhs;
+        benchmark::DoNotOptimize(result.numerators().data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+static void bm_fraction_compare(benchmark::State& state)
+{
+    auto const lhs = fraction_inputs(1);
+    auto const rhs = fraction_inputs(2);
+    auto result = std::vector<int>(num_fractions);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = int{lhs[index] > rhs[index]} - int{lhs[index] < rhs[index]};
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+static void bm_fraction_array_compare(benchmark::State& state)
+{
+    auto const lhs = cnl::fraction_array<int>{fraction_inputs(1)};
+    auto const rhs = cnl::fraction_array<int>{fraction_inputs(2)};
+    auto result = std::vector<int>(num_fractions);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(lhs.numerators().data());
+        benchmark::DoNotOptimize(rhs.numerators().data());
+        cnl::compare(lhs, rhs, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+static void bm_fraction_reduce(benchmark::State& state)
+{
+    auto const input = fraction_inputs(3);
+    auto result = std::vector<cnl::fraction<int>>(num_fractions, cnl::fraction<int>{0});
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = cnl::reduce(input[index]);
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+static void bm_fraction_array_reduce(benchmark::State& state)
+{
+    auto const input = cnl::fraction_array<int>{fraction_inputs(3)};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.numerators().data());
+        auto const result = cnl::reduce(input);
+        benchmark::DoNotOptimize(result.numerators().data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+static void bm_fraction_quotients(benchmark::State& state)
+{
+    auto const input = fraction_inputs(4);
+    auto result = std::vector<s15_16>(num_fractions);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = s15_16{input[index]};
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+static void bm_fraction_array_quotients(benchmark::State& state)
+{
+    auto const input = cnl::fraction_array<int>{fraction_inputs(4)};
+    auto result = std::vector<s15_16>(num_fractions);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.numerators().data());
+        input.quotients(std::span{result});
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_fractions);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// conversion of 1024 64-bit values between decimal and binary scaled_integer
+
+template<int Exponent, int Radix>
+using scaled_int64 = cnl::scaled_integer<std::int64_t, cnl::power<Exponent, Radix>>;
+
+template<int SrcExponent, int SrcRadix>
+static auto convert_radix_inputs()
+{
+    auto inputs = std::vector<scaled_int64<SrcExponent, SrcRadix>>{};
+    for (auto index = 0; index != 1024; ++index) {
+        inputs.emplace_back(((index * 4099) % 40000001 - 20000000) * 1e-4);
+    }
+    return inputs;
+}
+
+// conversion by the scaled_integer constructor
+template<int SrcExponent, int SrcRadix, int DestExponent, int DestRadix>
+static void bm_convert_radix(benchmark::State& state)
+{
+    auto const input = convert_radix_inputs<SrcExponent, SrcRadix>();
+    auto result = std::vector<scaled_int64<DestExponent, DestRadix>>(input.size());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            result[index] = scaled_int64<DestExponent, DestRadix>{input[index]};
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(input));
+}
+
+// scaling by a power of one radix and then dividing by a power of the other
+template<int SrcExponent, int SrcRadix, int DestExponent, int DestRadix>
+static void bm_convert_radix_stepwise(benchmark::State& state)
+{
+    static_assert(SrcExponent < 0 && DestExponent < 0);
+    auto const input = convert_radix_inputs<SrcExponent, SrcRadix>();
+    auto result = std::vector<scaled_int64<DestExponent, DestRadix>>(input.size());
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        for (auto index = std::size_t{0}; index != result.size(); ++index) {
+            auto const scaled{cnl::_impl::scale<-DestExponent, DestRadix>(cnl::_impl::to_rep(input[index]))};
+            result[index] = cnl::_impl::from_rep<scaled_int64<DestExponent, DestRadix>>(
+                    cnl::_impl::scale<SrcExponent, SrcRadix>(scaled));
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(input));
+}
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define FIXED_POINT_BENCHMARK_FLOAT(fn) \
-    BENCHMARK_TEMPLATE1(fn, float); \
-    BENCHMARK_TEMPLATE1(fn, double); \
-    BENCHMARK_TEMPLATE1(fn, long double);
+#define WIDE_BACKEND_BENCHMARK(fn, digits) \
+    BENCHMARK_TEMPLATE2(fn, digits, cnl::wide_tag_backend::uintwide); \
+    BENCHMARK_TEMPLATE2(fn, digits, cnl::wide_tag_backend::duplex_integer);
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define FIXED_POINT_BENCHMARK_INT(fn) \
-    BENCHMARK_TEMPLATE1(fn, int8_t); \
-    BENCHMARK_TEMPLATE1(fn, uint8_t); \
-    BENCHMARK_TEMPLATE1(fn, int16_t); \
-    BENCHMARK_TEMPLATE1(fn, uint16_t); \
-    BENCHMARK_TEMPLATE1(fn, int32_t); \
-    BENCHMARK_TEMPLATE1(fn, uint32_t); \
-    BENCHMARK_TEMPLATE1(fn, int64_t); \
-    BENCHMARK_TEMPLATE1(fn, uint64_t);
-
-// types that can store values >= 1
-#if defined(CNL_INT128_ENABLED)
+#define WIDE_BACKEND_BENCHMARKS(digits) \
+    WIDE_BACKEND_BENCHMARK(bm_wide_backend_add, digits) \
+    WIDE_BACKEND_BENCHMARK(bm_wide_backend_mul, digits) \
+    WIDE_BACKEND_BENCHMARK(bm_wide_backend_div, digits) \
+    WIDE_BACKEND_BENCHMARK(bm_wide_backend_div_constant, digits)
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define FIXED_POINT_BENCHMARK_FIXED(fn) \
-    BENCHMARK_TEMPLATE1(fn, u4_4); \
-    BENCHMARK_TEMPLATE1(fn, s3_4); \
-    BENCHMARK_TEMPLATE1(fn, u8_8); \
-    BENCHMARK_TEMPLATE1(fn, s7_8); \
-    BENCHMARK_TEMPLATE1(fn, u16_16); \
-    BENCHMARK_TEMPLATE1(fn, s15_16); \
-    BENCHMARK_TEMPLATE1(fn, u32_32); \
-    BENCHMARK_TEMPLATE1(fn, s31_32);
-#else
+#define TRIG_BENCHMARKS(type) \
+    BENCHMARK_TEMPLATE1(bm_sin, type); \
+    BENCHMARK_TEMPLATE1(bm_sin_crib, type); \
+    BENCHMARK_TEMPLATE1(bm_atan2, type); \
+    BENCHMARK_TEMPLATE1(bm_atan2_crib, type); \
+    BENCHMARK_TEMPLATE1(bm_hypot, type);
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define FIXED_POINT_BENCHMARK_FIXED(fn) \
-    BENCHMARK_TEMPLATE1(fn, u4_4); \
-    BENCHMARK_TEMPLATE1(fn, s3_4); \
-    BENCHMARK_TEMPLATE1(fn, u8_8); \
-    BENCHMARK_TEMPLATE1(fn, s7_8); \
-    BENCHMARK_TEMPLATE1(fn, u16_16); \
-    BENCHMARK_TEMPLATE1(fn, s15_16);
-#endif
+#define EXP_LOG_BENCHMARKS(type) \
+    BENCHMARK_TEMPLATE1(bm_exp2, type); \
+    BENCHMARK_TEMPLATE1(bm_exp2_crib, type); \
+    BENCHMARK_TEMPLATE1(bm_exp2_loop, type); \
+    BENCHMARK_TEMPLATE1(bm_exp2_span, type); \
+    BENCHMARK_TEMPLATE1(bm_log2, type); \
+    BENCHMARK_TEMPLATE1(bm_log2_crib, type);
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define FIXED_POINT_BENCHMARK_REAL(fn) \
-    FIXED_POINT_BENCHMARK_FLOAT(fn) \
-    FIXED_POINT_BENCHMARK_FIXED(fn)
+#define CONVERT_RADIX_BENCHMARKS(src_exponent, src_radix, dest_exponent, dest_radix) \
+    BENCHMARK_TEMPLATE(bm_convert_radix, src_exponent, src_radix, dest_exponent, dest_radix); \
+    BENCHMARK_TEMPLATE(bm_convert_radix_stepwise, src_exponent, src_radix, dest_exponent, dest_radix);
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define FIXED_POINT_BENCHMARK_COMPLETE(fn) \
-    FIXED_POINT_BENCHMARK_REAL(fn) \
-    FIXED_POINT_BENCHMARK_INT(fn)
+#define CHARCONV_BENCHMARKS(type) \
+    BENCHMARK_TEMPLATE1(bm_from_chars, type); \
+    BENCHMARK_TEMPLATE1(bm_from_chars_strtod, type); \
+    BENCHMARK_TEMPLATE1(bm_from_chars_n, type); \
+    BENCHMARK_TEMPLATE1(bm_to_chars, type); \
+    BENCHMARK_TEMPLATE1(bm_to_chars_n, type); \
+    BENCHMARK_TEMPLATE1(bm_to_chars_static, type); \
+    BENCHMARK_TEMPLATE1(bm_format_to, type); \
+    BENCHMARK_TEMPLATE1(bm_ostream, type); \
+    BENCHMARK_TEMPLATE1(bm_ostream_c_str, type); \
+    BENCHMARK_TEMPLATE1(bm_parse_istream, type); \
+    BENCHMARK_TEMPLATE1(bm_parse_istream_long_double, type);
 
 ////////////////////////////////////////////////////////////////////////////////
 // benchmark invocations
@@ -228,6 +1207,146 @@ FIXED_POINT_BENCHMARK_REAL(bm_magnitude_squared)
 // NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
 FIXED_POINT_BENCHMARK_REAL(bm_circle_intersect_generic)
 
-// tests involving unoptimized math function, cnl::sqrt
+// tests involving math function, cnl::sqrt
 // NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
 FIXED_POINT_BENCHMARK_REAL(bm_sqrt)
+
+// integer trigonometric functions vs conversion to floating-point
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+TRIG_BENCHMARKS(s7_8)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+TRIG_BENCHMARKS(s15_16)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+TRIG_BENCHMARKS(s31_32)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+EXP_LOG_BENCHMARKS(s7_8)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+EXP_LOG_BENCHMARKS(s15_16)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+EXP_LOG_BENCHMARKS(s31_32)
+
+// decimal parsing using integer arithmetic vs via floating-point, and decimal formatting
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+CHARCONV_BENCHMARKS(s7_8)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+CHARCONV_BENCHMARKS(s15_16)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+CHARCONV_BENCHMARKS(s31_32)
+
+// integer formatting a chunk of digits at a time
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_to_chars_integer, std::int64_t);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_to_chars_integer, cnl::wide_integer<127>);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_to_chars_integer, cnl::wide_integer<255>);
+
+// integer parsing a block of digits at a time vs one digit at a time
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_parse_int64);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_from_chars_int64);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_from_chars_int64_std);
+
+// element-at-a-time and bulk access to bit-packed arrays vs std::vector
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+PACKED_ARRAY_BENCHMARKS(cnl::elastic_integer<12>)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+PACKED_ARRAY_BENCHMARKS(cnl::elastic_integer<20>)
+
+// per-operation vs sticky (checked once per batch) handling of overflow
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_overflow_add, cnl::native_overflow_tag);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_overflow_add, cnl::saturated_overflow_tag);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_overflow_add, cnl::trapping_overflow_tag);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_overflow_add, cnl::sticky_overflow_tag);
+
+// saturated addition, one element at a time vs a span at a time
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_saturated_add, std::int8_t);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_saturated_add_span, std::int8_t);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_saturated_add, std::int16_t);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_saturated_add_span, std::int16_t);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_saturated_add, std::int32_t);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_saturated_add_span, std::int32_t);
+
+// accumulation of 256-bit integers, handling overflow with different tags
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_overflow_accumulate_wide, cnl::native_overflow_tag);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_overflow_accumulate_wide, cnl::saturated_overflow_tag);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_overflow_accumulate_wide, cnl::trapping_overflow_tag);
+
+// float and 32-bit fixed-point to 16-bit fixed-point, rounding to nearest, to even or stochastically,
+// one element at a time or as a span
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE2(bm_round, cnl::nearest_rounding_tag, float);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE2(bm_round, cnl::tie_to_even_rounding_tag, float);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE2(bm_round, cnl::stochastic_rounding_tag<>, float);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_stochastic_round_span, float);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE2(bm_round, cnl::nearest_rounding_tag, rounding_source_fixed_point);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE2(bm_round, cnl::tie_to_even_rounding_tag, rounding_source_fixed_point);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE2(bm_round, cnl::stochastic_rounding_tag<>, rounding_source_fixed_point);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_stochastic_round_span, rounding_source_fixed_point);
+
+// interleaved vs separate arrays of numerators and denominators
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_add);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_array_add);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_compare);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_array_compare);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_reduce);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_array_reduce);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_quotients);
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_fraction_array_quotients);
+
+// conversion between decimal and binary fixed-point, and the same scaling written out by hand
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+CONVERT_RADIX_BENCHMARKS(-6, 10, -32, 2)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+CONVERT_RADIX_BENCHMARKS(-32, 2, -6, 10)
+
+// crossover of schoolbook and Karatsuba multiplication
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_MULTIPLY_BENCHMARK(2048)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_MULTIPLY_BENCHMARK(4096)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_MULTIPLY_BENCHMARK(6144)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_MULTIPLY_BENCHMARK(8192)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_MULTIPLY_BENCHMARK(16384)
+
+// uintwide_t vs duplex_integer
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_BACKEND_BENCHMARKS(127)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_BACKEND_BENCHMARKS(191)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+WIDE_BACKEND_BENCHMARKS(255)
@@ -0,0 +1,87 @@
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_BENCHMARK_BENCHMARK_TYPES_H)
+#define CNL_BENCHMARK_BENCHMARK_TYPES_H
+
+#include <cnl/scaled_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+////////////////////////////////////////////////////////////////////////////////
+// scaled_integer types
+
+using u4_4 = cnl::scaled_integer<uint8_t, cnl::power<-4>>;
+using s3_4 = cnl::scaled_integer<int8_t, cnl::power<-4>>;
+using u8_8 = cnl::scaled_integer<uint16_t, cnl::power<-8>>;
+using s7_8 = cnl::scaled_integer<int16_t, cnl::power<-8>>;
+using u16_16 = cnl::scaled_integer<uint32_t, cnl::power<-16>>;
+using s15_16 = cnl::scaled_integer<int32_t, cnl::power<-16>>;
+using u32_32 = cnl::scaled_integer<uint64_t, cnl::power<-32>>;
+using s31_32 = cnl::scaled_integer<int64_t, cnl::power<-32>>;
+
+////////////////////////////////////////////////////////////////////////////////
+// multi-type benchmark macros
+
+// registers a single instantiation of benchmark, fn;
+// define before use in order to apply arguments to each registration
+#if !defined(FIXED_POINT_BENCHMARK_TEMPLATE)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_TEMPLATE(fn, type) BENCHMARK_TEMPLATE1(fn, type)
+#endif
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_FLOAT(fn) \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, float); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, double); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, long double);
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_INT(fn) \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, int8_t); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, uint8_t); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, int16_t); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, uint16_t); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, int32_t); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, uint32_t); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, int64_t); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, uint64_t);
+
+// types that can store values >= 1
+#if defined(CNL_INT128_ENABLED)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_FIXED(fn) \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, u4_4); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, s3_4); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, u8_8); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, s7_8); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, u16_16); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, s15_16); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, u32_32); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, s31_32);
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_FIXED(fn) \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, u4_4); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, s3_4); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, u8_8); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, s7_8); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, u16_16); \
+    FIXED_POINT_BENCHMARK_TEMPLATE(fn, s15_16);
+#endif
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_REAL(fn) \
+    FIXED_POINT_BENCHMARK_FLOAT(fn) \
+    FIXED_POINT_BENCHMARK_FIXED(fn)
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_COMPLETE(fn) \
+    FIXED_POINT_BENCHMARK_REAL(fn) \
+    FIXED_POINT_BENCHMARK_INT(fn)
+
+#endif  // CNL_BENCHMARK_BENCHMARK_TYPES_H
@@ -0,0 +1,210 @@
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Benchmarks of operations applied to contiguous buffers of numbers;
+// unlike benchmark.cpp, these measure throughput and so reflect
+// whether the compiler is able to vectorize the arithmetic.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FIXED_POINT_BENCHMARK_TEMPLATE(fn, type) \
+    BENCHMARK_TEMPLATE1(fn, type)->RangeMultiplier(8)->Range(int64_t{1} << 10, int64_t{1} << 24)
+
+#include "benchmark_types.h"
+#include "sample_functions.h"
+
+#include <cnl/cmath.h>
+#include <cnl/divider.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// entry point
+
+BENCHMARK_MAIN();  // NOLINT
+
+////////////////////////////////////////////////////////////////////////////////
+// helper functions
+
+template<class T>
+static auto make_buffer(benchmark::State const& state, T const& value)
+{
+    return std::vector<T>(static_cast<std::size_t>(state.range(0)), value);
+}
+
+// report the number of elements, and the bytes read and written, per second
+template<class T>
+static void set_throughput(benchmark::State& state, int buffers_per_item)
+{
+    auto const items = static_cast<int64_t>(state.iterations()) * state.range(0);
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * buffers_per_item * static_cast<int64_t>(sizeof(T)));
+}
+
+template<class T, class Operation>
+static void unary(benchmark::State& state, T const& input, Operation const& operation)
+{
+    auto const inputs = make_buffer(state, input);
+    auto outputs = make_buffer(state, T{});
+    while (state.KeepRunning()) {
+        std::transform(std::begin(inputs), std::end(inputs), std::begin(outputs), operation);
+        benchmark::DoNotOptimize(outputs.data());
+        benchmark::ClobberMemory();
+    }
+    set_throughput<T>(state, 2);
+}
+
+template<class T, class Operation>
+static void binary(benchmark::State& state, T const& lhs, T const& rhs, Operation const& operation)
+{
+    auto const lhs_inputs = make_buffer(state, lhs);
+    auto const rhs_inputs = make_buffer(state, rhs);
+    auto outputs = make_buffer(state, T{});
+    while (state.KeepRunning()) {
+        std::transform(
+                std::begin(lhs_inputs), std::end(lhs_inputs), std::begin(rhs_inputs),
+                std::begin(outputs), operation);
+        benchmark::DoNotOptimize(outputs.data());
+        benchmark::ClobberMemory();
+    }
+    set_throughput<T>(state, 3);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// benchmarking functions
+
+template<class T>
+static void add(benchmark::State& state)
+{
+    binary(
+            state,
+            static_cast<T>(std::numeric_limits<T>::max() / 5),
+            static_cast<T>(std::numeric_limits<T>::max() / 3),
+            [](T const& addend1, T const& addend2) { return static_cast<T>(addend1 + addend2); });
+}
+
+template<class T>
+static void sub(benchmark::State& state)
+{
+    binary(
+            state,
+            static_cast<T>(std::numeric_limits<T>::max() / 5),
+            static_cast<T>(std::numeric_limits<T>::max() / 3),
+            [](T const& minuend, T const& subtrahend) { return static_cast<T>(minuend - subtrahend); });
+}
+
+template<class T>
+static void mul(benchmark::State& state)
+{
+    binary(
+            state,
+            static_cast<T>(std::numeric_limits<T>::max() / int8_t{5}),
+            static_cast<T>(std::numeric_limits<T>::max() / int8_t{3}),
+            [](T const& factor1, T const& factor2) { return static_cast<T>(factor1 * factor2); });
+}
+
+template<class T>
+static void div(benchmark::State& state)
+{
+    binary(
+            state,
+            static_cast<T>(std::numeric_limits<T>::max() / int8_t{5}),
+            static_cast<T>(std::numeric_limits<T>::max() / int8_t{3}),
+            [](T const& nume, T const& denom) { return static_cast<T>(nume / denom); });
+}
+
+// division of every element by the same run-time divisor
+template<class T>
+static void div_invariant(benchmark::State& state)
+{
+    auto denom = static_cast<T>(std::numeric_limits<T>::max() / int8_t{3});
+    benchmark::DoNotOptimize(denom);
+    unary(
+            state,
+            static_cast<T>(std::numeric_limits<T>::max() / int8_t{5}),
+            [denom](T const& nume) { return static_cast<T>(nume / denom); });
+}
+
+// as div_invariant but using cnl::divider
+template<class T>
+static void div_divider(benchmark::State& state)
+{
+    auto denom = static_cast<T>(std::numeric_limits<T>::max() / int8_t{3});
+    benchmark::DoNotOptimize(denom);
+    auto const divider = cnl::divider{denom};
+    auto const inputs = make_buffer(state, static_cast<T>(std::numeric_limits<T>::max() / int8_t{5}));
+    auto outputs = make_buffer(state, T{});
+    while (state.KeepRunning()) {
+        cnl::divide(std::span{inputs}, divider, std::span{outputs});
+        benchmark::DoNotOptimize(outputs.data());
+        benchmark::ClobberMemory();
+    }
+    set_throughput<T>(state, 2);
+}
+
+template<class T>
+static void bm_sqrt(benchmark::State& state)
+{
+    unary(
+            state,
+            static_cast<T>(std::numeric_limits<T>::max() / int8_t{5}),
+            [](T const& input) { return static_cast<T>(cnl::sqrt(input)); });
+}
+
+template<class T>
+static void bm_magnitude_squared(benchmark::State& state)
+{
+    auto const xs = make_buffer(state, T{1LL});
+    auto const ys = make_buffer(state, T{4LL});
+    auto const zs = make_buffer(state, T{9LL});
+    auto outputs = make_buffer(state, T{});
+    while (state.KeepRunning()) {
+        for (auto index = std::size_t{0}; index != outputs.size(); ++index) {
+            outputs[index] = magnitude_squared(xs[index], ys[index], zs[index]);
+        }
+        benchmark::DoNotOptimize(outputs.data());
+        benchmark::ClobberMemory();
+    }
+    set_throughput<T>(state, 4);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// benchmark invocations
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_COMPLETE(add)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_COMPLETE(sub)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_COMPLETE(mul)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_COMPLETE(div)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_INT(div_invariant)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_FIXED(div_invariant)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_INT(div_divider)
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_FIXED(div_divider)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_REAL(bm_magnitude_squared)
+
+// tests involving math function, cnl::sqrt
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+FIXED_POINT_BENCHMARK_REAL(bm_sqrt)
@@ -0,0 +1,115 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/charconv/from_chars.h>
+
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace {
+    // the value of chars if they are parsed successfully in their entirety
+    template<typename Integer>
+    constexpr auto parse(std::string_view chars, int base = 10)
+    {
+        auto value{Integer{}};
+        auto const result{cnl::from_chars(chars.data(), chars.data() + chars.size(), value, base)};
+        return (result.ec == std::errc{} && result.ptr == chars.data() + chars.size()) ? std::optional{value}
+                                                                                      : std::nullopt;
+    }
+
+    // the error and the number of characters consumed when parsing chars
+    template<typename Integer>
+    auto parse_error(std::string_view chars, int base = 10)
+    {
+        auto value{Integer{7}};
+        auto const result{cnl::from_chars(chars.data(), chars.data() + chars.size(), value, base)};
+        EXPECT_EQ(Integer{7}, value) << chars;
+        return std::pair{result.ec, result.ptr - chars.data()};
+    }
+
+    static_assert(42 == parse<int>("42"));
+    static_assert(-42 == parse<int>("-42"));
+    static_assert(0 == parse<int>("-0"));
+    static_assert(std::numeric_limits<std::int8_t>::min() == parse<std::int8_t>("-128"));
+    static_assert(std::numeric_limits<std::int64_t>::max() == parse<std::int64_t>("9223372036854775807"));
+    static_assert(
+            std::numeric_limits<std::int64_t>::min() == parse<std::int64_t>("-9223372036854775808"));
+    static_assert(std::numeric_limits<std::uint64_t>::max() == parse<std::uint64_t>("18446744073709551615"));
+    static_assert(0x7fe == parse<int>("7Fe", 16));
+    static_assert(-0755 == parse<int>("-755", 8));
+    static_assert(0b1011 == parse<unsigned>("1011", 2));
+
+    TEST(charconv_from_chars, invalid_argument)  // NOLINT
+    {
+        using pair = std::pair<std::errc, std::ptrdiff_t>;
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<int>(""));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<int>("-"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<int>("+1"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<int>(" 1"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<unsigned>("-1"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<int>("8", 8));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<int>("a"));
+    }
+
+    TEST(charconv_from_chars, result_out_of_range)  // NOLINT
+    {
+        using pair = std::pair<std::errc, std::ptrdiff_t>;
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 3}), parse_error<std::int8_t>("128"));
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 4}), parse_error<std::int8_t>("-129"));
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 5}), parse_error<std::uint8_t>("25600,"));
+        ASSERT_EQ(
+                (pair{std::errc::result_out_of_range, 20}),
+                parse_error<std::uint64_t>("18446744073709551616"));
+    }
+
+    TEST(charconv_from_chars, partial)  // NOLINT
+    {
+        auto const chars{std::string_view{"-123.5"}};
+        auto value{0};
+        auto const result{cnl::from_chars(chars.data(), chars.data() + chars.size(), value)};
+        ASSERT_EQ(std::errc{}, result.ec);
+        ASSERT_EQ(chars.data() + 4, result.ptr);
+        ASSERT_EQ(-123, value);
+    }
+
+    TEST(charconv_from_chars, matches_std)  // NOLINT
+    {
+        for (auto base : {2, 8, 10, 16}) {
+            for (auto n{std::int64_t{-100000}}; n < std::int64_t{100000}; n += 997) {
+                std::array<char, 80> chars{};
+                auto const end{std::to_chars(chars.data(), chars.data() + chars.size(), n, base).ptr};
+                auto value{std::int64_t{}};
+                auto const result{cnl::from_chars(chars.data(), end, value, base)};
+                ASSERT_EQ(std::errc{}, result.ec);
+                ASSERT_EQ(end, result.ptr);
+                ASSERT_EQ(n, value);
+            }
+        }
+    }
+
+    TEST(charconv_from_chars, wide_integer)  // NOLINT
+    {
+        using wide = cnl::wide_integer<200>;
+        auto const chars{std::string_view{"-1606938044258990275541962092341162602522202993782792835301375"}};
+        auto value{wide{}};
+        auto const result{cnl::from_chars(chars.data(), chars.data() + chars.size(), value)};
+        ASSERT_EQ(std::errc{}, result.ec);
+        ASSERT_EQ(chars.data() + chars.size(), result.ptr);
+        ASSERT_EQ(-(wide{1} << 200) + 1, value);
+
+        auto const hex{std::string_view{"1ffffffffffffffffffffffffffffffffffffffffffffffffff"}};
+        ASSERT_EQ(std::errc::result_out_of_range, cnl::from_chars(hex.data(), hex.data() + hex.size(), value, 16).ec);
+    }
+}
@@ -0,0 +1,102 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::from_chars_n
+
+#include <cnl/_impl/charconv/from_chars_n.h>
+
+#include <cnl/_impl/charconv/to_chars_n.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using cnl::power;
+using cnl::scaled_integer;
+
+namespace {
+    using s15_16 = scaled_integer<std::int32_t, power<-16>>;
+
+    constexpr auto csv{std::string_view{"-5016.5,0,.25,17"}};
+
+    static_assert([] {
+        std::array<s15_16, 4> values{};
+        auto const result{cnl::from_chars_n(csv.data(), csv.data() + csv.size(), std::span{values}, ',')};
+        return result.ec == std::errc{} && values == std::array{s15_16{-5016.5}, s15_16{0}, s15_16{.25}, s15_16{17}};
+    }());
+
+    TEST(from_chars_n, scaled_integer)  // NOLINT
+    {
+        std::array<s15_16, 4> values{};
+        std::array<std::ptrdiff_t, 4> offsets{};
+        auto const result{cnl::from_chars_n(
+                csv.data(), csv.data() + csv.size(), std::span{values}, ',', offsets)};
+        ASSERT_EQ((cnl::from_chars_n_result{csv.data() + csv.size(), std::errc{}, 4}), result);
+        ASSERT_EQ((std::array{s15_16{-5016.5}, s15_16{0}, s15_16{.25}, s15_16{17}}), values);
+        ASSERT_EQ((std::array<std::ptrdiff_t, 4>{0, 8, 10, 14}), offsets);
+    }
+
+    TEST(from_chars_n, integer)  // NOLINT
+    {
+        auto const chars{std::string_view{"-9223372036854775808 0 42 trailing"}};
+        std::array<std::int64_t, 3> values{};
+        auto const result{cnl::from_chars_n(chars.data(), chars.data() + chars.size(), std::span{values}, ' ')};
+        ASSERT_EQ((cnl::from_chars_n_result{chars.data() + 25, std::errc{}, 3}), result);
+        ASSERT_EQ((std::array<std::int64_t, 3>{-9223372036854775807 - 1, 0, 42}), values);
+    }
+
+    TEST(from_chars_n, missing_separator)  // NOLINT
+    {
+        auto const chars{std::string_view{"1,2;3"}};
+        std::array<s15_16, 3> values{};
+        auto const result{cnl::from_chars_n(chars.data(), chars.data() + chars.size(), std::span{values}, ',')};
+        ASSERT_EQ((cnl::from_chars_n_result{chars.data() + 3, std::errc::invalid_argument, 2}), result);
+    }
+
+    TEST(from_chars_n, missing_value)  // NOLINT
+    {
+        auto const chars{std::string_view{"1,,3"}};
+        std::array<s15_16, 3> values{};
+        auto const result{cnl::from_chars_n(chars.data(), chars.data() + chars.size(), std::span{values}, ',')};
+        ASSERT_EQ(std::errc::invalid_argument, result.ec);
+        ASSERT_EQ(1U, result.count);
+    }
+
+    TEST(from_chars_n, out_of_range)  // NOLINT
+    {
+        auto const chars{std::string_view{"1,40000"}};
+        std::array<s15_16, 2> values{};
+        auto const result{cnl::from_chars_n(chars.data(), chars.data() + chars.size(), std::span{values}, ',')};
+        ASSERT_EQ(std::errc::result_out_of_range, result.ec);
+        ASSERT_EQ(1U, result.count);
+    }
+
+    TEST(from_chars_n, round_trip)  // NOLINT
+    {
+        std::vector<s15_16> values(1000);
+        for (auto index = std::size_t{0}; index != values.size(); ++index) {
+            values[index] = s15_16{32767. * std::sin(static_cast<double>(index))};
+        }
+
+        std::vector<char> chars(values.size() * 32);
+        auto const written{cnl::to_chars_n(
+                std::span<s15_16 const>{values}, chars.data(), chars.data() + chars.size(), ',')};
+        ASSERT_EQ(std::errc{}, written.ec);
+
+        std::vector<s15_16> parsed(values.size());
+        auto const read{cnl::from_chars_n(chars.data(), written.ptr, std::span{parsed}, ',')};
+        ASSERT_EQ((cnl::from_chars_n_result{written.ptr, std::errc{}, values.size()}), read);
+        ASSERT_EQ(values, parsed);
+    }
+}
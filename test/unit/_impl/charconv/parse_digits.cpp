@@ -0,0 +1,74 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/charconv/parse_digits.h>
+
+#include <cnl/_impl/parse.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace {
+    // "12345678" with the first character in the least significant byte
+    constexpr auto chars_12345678{std::uint64_t{0x3837363534333231}};
+
+    static_assert(cnl::_impl::is_eight_digits(chars_12345678));
+    static_assert(cnl::_impl::is_eight_digits(0x3030303030303030));
+    static_assert(cnl::_impl::is_eight_digits(0x3939393939393939));
+    static_assert(!cnl::_impl::is_eight_digits(0x383736352e333231));
+    static_assert(!cnl::_impl::is_eight_digits(0x3a37363534333231));
+    static_assert(!cnl::_impl::is_eight_digits(0x383736353433322f));
+    static_assert(!cnl::_impl::is_eight_digits(0xb837363534333231));
+
+    static_assert(12345678 == cnl::_impl::eight_digits_value(chars_12345678));
+    static_assert(0 == cnl::_impl::eight_digits_value(0x3030303030303030));
+    static_assert(99999999 == cnl::_impl::eight_digits_value(0x3939393939393939));
+
+    // run-time parsing is identical to compile-time parsing
+    static_assert(cnl::_impl::parse<std::int64_t>("-1'234'567'890'123'456'789") == -1234567890123456789);
+
+    TEST(charconv_parse_digits, parse_decimal_block)  // NOLINT
+    {
+        if constexpr (cnl::_impl::swar_parse_enabled) {
+            auto const digits{std::string{"9876543210123456"}};
+            ASSERT_EQ(std::optional<std::uint64_t>{98765432}, cnl::_impl::parse_decimal_block<8>(digits.data()));
+            ASSERT_EQ(
+                    std::optional<std::uint64_t>{9876543210123456},
+                    cnl::_impl::parse_decimal_block<16>(digits.data()));
+
+            // every position of every non-digit is detected
+            for (auto position{0}; position != 16; ++position) {
+                for (auto c{1}; c != 256; ++c) {
+                    if (c >= '0' && c <= '9') {
+                        continue;
+                    }
+                    auto chars{digits};
+                    chars[position] = static_cast<char>(c);
+                    ASSERT_FALSE(cnl::_impl::parse_decimal_block<16>(chars.data())) << position << ' ' << c;
+                    if (position < 8) {
+                        ASSERT_FALSE(cnl::_impl::parse_decimal_block<8>(chars.data())) << position << ' ' << c;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(charconv_parse_digits, parse)  // NOLINT
+    {
+        auto const parse{[](std::string const& chars) {
+            return cnl::_impl::parse<std::int64_t>(chars.c_str());
+        }};
+        ASSERT_EQ(1234567890123456789, parse("1234567890123456789"));
+        ASSERT_EQ(-1234567890123456789, parse("-1234567890123456789"));
+        ASSERT_EQ(-1234567890123456789, parse("-1'234'567'890'123'456'789"));
+        ASSERT_EQ(-9223372036854775807 - 1, parse("-9223372036854775808"));
+        ASSERT_EQ(9223372036854775807, parse("9223372036854775807"));
+        ASSERT_EQ(12345678, parse("12345678"));
+        ASSERT_EQ(0x7fffffffffffffff, parse("0x7fffffffffffffff"));
+    }
+}
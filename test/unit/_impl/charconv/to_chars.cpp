@@ -7,11 +7,14 @@
 #include <cnl/_impl/charconv/to_chars.h>
 
 #include <cnl/_impl/type_traits/identical.h>
+#include <cnl/wide_integer.h>
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cstdint>
 #include <limits>
+#include <string_view>
 
 using cnl::_impl::identical;
 
@@ -20,6 +23,12 @@ namespace {
     static_assert(identical(
             cnl::to_chars_static_result<11>{{'4', '2'}, 2},
             cnl::to_chars_static(std::int32_t{42})));
+
+    static_assert([] {
+        auto const chars{cnl::to_chars_static(
+                cnl::wide_integer<100>{-1234567890123456789} * 10000000000 - 123456789)};
+        return std::string_view{chars} == "-12345678901234567890123456789";
+    }());
 }
 #endif
 
@@ -52,3 +61,26 @@ TEST(charconv_to_chars, int64_zero)  // NOLINT
     auto const actual{cnl::to_chars_static(std::int64_t{0})};
     ASSERT_EQ(expected, actual);
 }
+
+TEST(charconv_to_chars, wide_integer_zero_chunk)  // NOLINT
+{
+    auto const ten_pow_19{cnl::wide_integer<200>{10000000000000000000ULL}};
+    auto const value{cnl::wide_integer<200>{ten_pow_19 * ten_pow_19 + 7}};
+    auto const actual{cnl::to_chars_static(value)};
+    ASSERT_EQ(std::string_view{"100000000000000000000000000000000000007"}, std::string_view{actual});
+}
+
+TEST(charconv_to_chars, wide_integer_hex)  // NOLINT
+{
+    auto const value{cnl::wide_integer<200>{1} << 130};
+    auto const actual{cnl::to_chars_static<16>(-value)};
+    ASSERT_EQ(std::string_view{"-400000000000000000000000000000000"}, std::string_view{actual});
+}
+
+TEST(charconv_to_chars, wide_integer_too_short)  // NOLINT
+{
+    auto const value{cnl::wide_integer<200, unsigned>{1} << 199};
+    auto chars{std::array<char, 59>{}};
+    auto const result{cnl::to_chars(chars.data(), chars.data() + chars.size(), value)};
+    ASSERT_EQ(std::errc::value_too_large, result.ec);
+}
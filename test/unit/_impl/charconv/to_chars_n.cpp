@@ -0,0 +1,81 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::to_chars_n
+
+#include <cnl/_impl/charconv/to_chars_n.h>
+
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+using cnl::power;
+using cnl::scaled_integer;
+
+namespace {
+    using s15_16 = scaled_integer<std::int32_t, power<-16>>;
+
+    constexpr auto values{std::array{s15_16{-5016.5}, s15_16{0}, s15_16{.25}, s15_16{17}}};
+
+    static_assert([] {
+        std::array<char, 32> chars{};
+        auto const result{cnl::to_chars_n(std::span{values}, chars.data(), chars.data() + chars.size(), ',')};
+        return std::string_view(chars.data(), result.ptr - chars.data()) == "-5016.5,0,.25,17";
+    }());
+
+    TEST(to_chars_n, scaled_integer)  // NOLINT
+    {
+        std::array<char, 64> chars{};
+        std::array<std::ptrdiff_t, values.size()> offsets{};
+        auto const result{cnl::to_chars_n(
+                std::span{values}, chars.data(), chars.data() + chars.size(), ',', offsets)};
+        ASSERT_EQ((cnl::to_chars_n_result{chars.data() + 16, std::errc{}, 4}), result);
+        ASSERT_EQ("-5016.5,0,.25,17", std::string_view(chars.data(), 16));
+        ASSERT_EQ((std::array<std::ptrdiff_t, 4>{0, 8, 10, 14}), offsets);
+    }
+
+    TEST(to_chars_n, integer)  // NOLINT
+    {
+        auto const integers{std::array<std::int64_t, 3>{-9223372036854775807, 0, 42}};
+        std::array<char, 32> chars{};
+        auto const result{cnl::to_chars_n(
+                std::span{integers}, chars.data(), chars.data() + chars.size(), '\n')};
+        ASSERT_EQ(std::errc{}, result.ec);
+        ASSERT_EQ("-9223372036854775807\n0\n42", std::string_view(chars.data(), result.ptr - chars.data()));
+    }
+
+    TEST(to_chars_n, empty)  // NOLINT
+    {
+        std::array<char, 1> chars{};
+        auto const result{cnl::to_chars_n(
+                std::span<s15_16 const>{}, chars.data(), chars.data() + chars.size(), ',')};
+        ASSERT_EQ((cnl::to_chars_n_result{chars.data(), std::errc{}, 0}), result);
+    }
+
+    TEST(to_chars_n, too_small)  // NOLINT
+    {
+        // a value which does not fit in full is not truncated
+        std::array<char, 12> chars{};
+        auto const result{cnl::to_chars_n(std::span{values}, chars.data(), chars.data() + chars.size(), ',')};
+        ASSERT_EQ((cnl::to_chars_n_result{chars.data() + chars.size(), std::errc::value_too_large, 2}), result);
+        ASSERT_EQ("-5016.5,0,", std::string_view(chars.data(), 10));
+        ASSERT_EQ('\0', chars[10]);
+    }
+
+    TEST(to_chars_n, too_small_for_separator)  // NOLINT
+    {
+        std::array<char, 7> chars{};
+        auto const result{cnl::to_chars_n(std::span{values}, chars.data(), chars.data() + chars.size(), ',')};
+        ASSERT_EQ((cnl::to_chars_n_result{chars.data() + chars.size(), std::errc::value_too_large, 1}), result);
+    }
+}
@@ -6,7 +6,14 @@
 
 #include <cnl/_impl/cmath/sqrt.h>
 
+#include <cnl/_impl/num_traits/width.h>
 #include <cnl/_impl/type_traits/identical.h>
+#include <cnl/cstdint.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
 
 using cnl::_impl::identical;
 
@@ -20,3 +27,84 @@ static_assert(identical(0xB504, cnl::sqrt(0x7fffffff)));
 static_assert(identical(100, cnl::sqrt(std::int16_t{10000})));
 static_assert(identical(10, cnl::sqrt(std::int8_t{100})));
 static_assert(identical(0, cnl::sqrt(0)));
+static_assert(identical(1, cnl::sqrt(3)));
+static_assert(identical(2, cnl::sqrt(4)));
+static_assert(identical(std::uint8_t{15}, cnl::_impl::newton_sqrt(std::uint8_t{255})));
+static_assert(identical(UINT64_C(0xffffffff), cnl::sqrt(UINT64_C(0xffffffffffffffff))));
+static_assert(identical(INT64_C(0xb504f333), cnl::sqrt(INT64_C(0x7fffffffffffffff))));
+#if defined(CNL_INT128_ENABLED)
+static_assert(identical(
+        cnl::uint128_t{UINT64_C(0xffffffffffffffff)},
+        cnl::sqrt(~cnl::uint128_t{})));
+#endif
+
+namespace {
+    template<typename Integer>
+    void test_against_digit_by_digit(int num_samples)
+    {
+        auto state{UINT64_C(0x0123456789ABCDEF)};
+        auto const random = [&state]() {
+            state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+            return state;
+        };
+
+        for (auto i{0}; i < num_samples; ++i) {
+            auto sample{static_cast<Integer>(random())};
+            if constexpr (cnl::_impl::width<Integer> > 64) {
+                sample = static_cast<Integer>((sample << 64) | static_cast<Integer>(random()));
+            }
+            auto const x{static_cast<Integer>(
+                    static_cast<Integer>(sample >> (i % cnl::digits_v<Integer>)) & std::numeric_limits<Integer>::max())};
+
+            // values either side of a perfect square
+            auto const root{cnl::_impl::digit_by_digit_sqrt(x)};
+            auto const square{static_cast<Integer>(root * root)};
+            for (auto const value : {x, square, static_cast<Integer>(square - Integer{1})}) {
+                if (value < Integer{0}) {
+                    continue;
+                }
+                ASSERT_EQ(cnl::_impl::digit_by_digit_sqrt(value), cnl::sqrt(value)) << i;
+            }
+        }
+    }
+
+    TEST(sqrt, exhaustive_uint16)  // NOLINT
+    {
+        for (auto x{0U}; x < 0x10000U; ++x) {
+            auto const value{static_cast<std::uint16_t>(x)};
+            ASSERT_EQ(cnl::_impl::digit_by_digit_sqrt(value), cnl::sqrt(value));
+        }
+    }
+
+    TEST(sqrt, int32)  // NOLINT
+    {
+        test_against_digit_by_digit<std::int32_t>(100000);
+    }
+
+    TEST(sqrt, uint32)  // NOLINT
+    {
+        test_against_digit_by_digit<std::uint32_t>(100000);
+    }
+
+    TEST(sqrt, int64)  // NOLINT
+    {
+        test_against_digit_by_digit<std::int64_t>(100000);
+    }
+
+    TEST(sqrt, uint64)  // NOLINT
+    {
+        test_against_digit_by_digit<std::uint64_t>(100000);
+    }
+
+#if defined(CNL_INT128_ENABLED)
+    TEST(sqrt, int128)  // NOLINT
+    {
+        test_against_digit_by_digit<cnl::int128_t>(100000);
+    }
+
+    TEST(sqrt, uint128)  // NOLINT
+    {
+        test_against_digit_by_digit<cnl::uint128_t>(100000);
+    }
+#endif
+}
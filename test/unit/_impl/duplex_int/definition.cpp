@@ -284,7 +284,9 @@ namespace {
     namespace test_to_rep {
         static_assert(
                 identical(
-                        4567U,
+                        cnl::_impl::duplex_integer<
+                                cnl::_impl::duplex_integer<unsigned int, unsigned int>,
+                                cnl::_impl::duplex_integer<unsigned int, unsigned int>>{4567},
                         cnl::to_rep<cnl::_impl::duplex_integer<
                                 cnl::_impl::duplex_integer<unsigned int, unsigned int>,
                                 cnl::_impl::duplex_integer<unsigned int, unsigned int>>>{}(4567)));
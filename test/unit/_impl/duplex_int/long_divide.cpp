@@ -0,0 +1,178 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/duplex_integer/long_divide.h>
+
+#include <cnl/_impl/duplex_integer/long_divide.h>
+
+#include <cnl/_impl/duplex_integer.h>
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/cstdint.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using cnl::_impl::identical;
+
+namespace {
+    template<typename Word>
+    [[nodiscard]] constexpr auto quotient(Word const& upper, Word const& lower, Word const& divisor)
+    {
+        return cnl::_impl::long_divide(upper, lower, divisor).quotient;
+    }
+
+    template<typename Word>
+    [[nodiscard]] constexpr auto remainder(Word const& upper, Word const& lower, Word const& divisor)
+    {
+        return cnl::_impl::long_divide(upper, lower, divisor).remainder;
+    }
+
+    template<typename Word>
+    [[nodiscard]] constexpr auto half_word_quotient(Word const& upper, Word const& lower, Word const& divisor)
+    {
+        return cnl::_impl::half_word_long_divide(upper, lower, divisor).quotient;
+    }
+
+    template<typename Word>
+    [[nodiscard]] constexpr auto reciprocal_quotient(Word const& upper, Word const& lower, Word const& divisor)
+    {
+        return cnl::_impl::word_reciprocal<Word>{divisor}.divide(upper, lower).quotient;
+    }
+
+    template<typename Word>
+    [[nodiscard]] constexpr auto reciprocal_remainder(Word const& upper, Word const& lower, Word const& divisor)
+    {
+        return cnl::_impl::word_reciprocal<Word>{divisor}.divide(upper, lower).remainder;
+    }
+
+    namespace test_long_divide {
+        static_assert(identical(std::uint8_t{0x12}, quotient<std::uint8_t>(0x12, 0x34, 0xFF)));
+        static_assert(identical(std::uint8_t{0x46}, remainder<std::uint8_t>(0x12, 0x34, 0xFF)));
+        static_assert(identical(
+                UINT32_C(0x369D036A),
+                quotient<std::uint32_t>(0x12345678, 0x9ABCDEF0, 0x55555555)));
+        static_assert(identical(
+                UINT64_C(0x8000000000000000),
+                quotient<std::uint64_t>(1, 0, 2)));
+        static_assert(identical(
+                UINT64_C(0xFFFFFFFFFFFFFFFF),
+                quotient<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFE), UINT64_C(0xFFFFFFFFFFFFFFFF), UINT64_C(0xFFFFFFFFFFFFFFFF))));
+        static_assert(identical(
+                UINT64_C(0xFFFFFFFFFFFFFFFE),
+                remainder<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFE), UINT64_C(0xFFFFFFFFFFFFFFFF), UINT64_C(0xFFFFFFFFFFFFFFFF))));
+    }
+
+    namespace test_half_word_long_divide {
+        static_assert(identical(
+                UINT32_C(0x369D036A),
+                half_word_quotient<std::uint32_t>(0x12345678, 0x9ABCDEF0, 0x55555555)));
+        static_assert(identical(
+                UINT32_C(0x12345678),
+                half_word_quotient<std::uint32_t>(0x1, 0x23456780, 0x10)));
+        static_assert(identical(
+                UINT64_C(0xFFFFFFFFFFFFFFFF),
+                half_word_quotient<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFE), UINT64_C(0xFFFFFFFFFFFFFFFF), UINT64_C(0xFFFFFFFFFFFFFFFF))));
+        static_assert(identical(
+                cnl::_impl::duplex_integer<std::uint32_t, std::uint32_t>{0x12345678},
+                half_word_quotient(
+                        cnl::_impl::duplex_integer<std::uint32_t, std::uint32_t>{0x1},
+                        cnl::_impl::duplex_integer<std::uint32_t, std::uint32_t>{0x2345678000000000ULL},
+                        cnl::_impl::duplex_integer<std::uint32_t, std::uint32_t>{0x1000000000ULL})));
+    }
+
+    namespace test_word_reciprocal {
+        static_assert(identical(std::uint8_t{0x12}, reciprocal_quotient<std::uint8_t>(0x12, 0x34, 0xFF)));
+        static_assert(identical(std::uint8_t{0x46}, reciprocal_remainder<std::uint8_t>(0x12, 0x34, 0xFF)));
+        static_assert(identical(
+                UINT32_C(0x369D036A),
+                reciprocal_quotient<std::uint32_t>(0x12345678, 0x9ABCDEF0, 0x55555555)));
+        static_assert(identical(
+                UINT64_C(0x8000000000000000),
+                reciprocal_quotient<std::uint64_t>(1, 0, 2)));
+        static_assert(identical(
+                UINT64_C(0x0000000000000001),
+                reciprocal_remainder<std::uint64_t>(0, 10, 3)));
+    }
+
+    // compares each implementation against double-word division
+    TEST(long_divide, exhaustive_uint8)  // NOLINT
+    {
+        for (auto divisor{1U}; divisor != 0x100U; ++divisor) {
+            auto const reciprocal{cnl::_impl::word_reciprocal<std::uint8_t>{static_cast<std::uint8_t>(divisor)}};
+            for (auto upper{0U}; upper != divisor; ++upper) {
+                for (auto lower{0U}; lower != 0x100U; ++lower) {
+                    auto const dividend{(upper << 8U) | lower};
+                    auto const expected_quotient{static_cast<std::uint8_t>(dividend / divisor)};
+                    auto const expected_remainder{static_cast<std::uint8_t>(dividend % divisor)};
+
+                    auto const actual{reciprocal.divide(static_cast<std::uint8_t>(upper), static_cast<std::uint8_t>(lower))};
+                    ASSERT_EQ(expected_quotient, actual.quotient);
+                    ASSERT_EQ(expected_remainder, actual.remainder);
+                }
+            }
+        }
+    }
+
+    TEST(long_divide, uint64)  // NOLINT
+    {
+        auto state{UINT64_C(0x0123456789ABCDEF)};
+        auto const random = [&state]() {
+            state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+            return state;
+        };
+
+        for (auto i{0}; i != 10000; ++i) {
+            auto const divisor{random() >> (i % 64)};
+            if (!divisor) {
+                continue;
+            }
+            auto const upper{random() % divisor};
+            auto const lower{random()};
+
+            auto const expected{cnl::_impl::half_word_long_divide(upper, lower, divisor)};
+            auto const actual{cnl::_impl::long_divide(upper, lower, divisor)};
+            ASSERT_EQ(expected.quotient, actual.quotient);
+            ASSERT_EQ(expected.remainder, actual.remainder);
+
+            auto const reciprocal{cnl::_impl::word_reciprocal<std::uint64_t>{divisor}.divide(upper, lower)};
+            ASSERT_EQ(expected.quotient, reciprocal.quotient);
+            ASSERT_EQ(expected.remainder, reciprocal.remainder);
+        }
+    }
+
+#if defined(CNL_INT128_ENABLED)
+    TEST(long_divide, uint128)  // NOLINT
+    {
+        auto state{UINT64_C(0xFEDCBA9876543210)};
+        auto const random = [&state]() {
+            state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+            return (cnl::uint128_t{state} << 64U) | (state >> 7U);
+        };
+
+        for (auto i{0}; i != 10000; ++i) {
+            auto const divisor{random() >> (i % 128)};
+            if (!divisor) {
+                continue;
+            }
+            auto const upper{random() % divisor};
+            auto const lower{random()};
+
+            auto const actual{cnl::_impl::long_divide(upper, lower, divisor)};
+            ASSERT_LT(actual.remainder, divisor);
+
+            // quotient * divisor + remainder == upper:lower
+            using duplex = cnl::_impl::duplex_integer<cnl::uint128_t, cnl::uint128_t>;
+            auto const product{cnl::_impl::long_multiply<cnl::uint128_t>{}(actual.quotient, divisor)};
+            ASSERT_EQ((duplex{upper, lower}), product + duplex{actual.remainder});
+
+            auto const reciprocal{cnl::_impl::word_reciprocal<cnl::uint128_t>{divisor}.divide(upper, lower)};
+            ASSERT_TRUE(actual.quotient == reciprocal.quotient);
+            ASSERT_TRUE(actual.remainder == reciprocal.remainder);
+        }
+    }
+#endif
+}
@@ -0,0 +1,112 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/overflow/builtin_overflow.h>
+
+#include <cnl/_impl/ostream.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace {
+    namespace test_builtin_overflow_operator {
+        using cnl::_impl::add_op;
+        using cnl::_impl::builtin_overflow_operator;
+        using cnl::_impl::multiply_op;
+        using cnl::_impl::subtract_op;
+
+#if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
+        static_assert(builtin_overflow_operator<add_op, int, int>::value);
+        static_assert(builtin_overflow_operator<multiply_op, unsigned, int>::value);
+        static_assert(!builtin_overflow_operator<add_op, double, double>::value);
+
+        // wrappers are unwrapped
+        static_assert(builtin_overflow_operator<add_op, cnl::wide_integer<31>, cnl::wide_integer<31>>::value);
+        static_assert(builtin_overflow_operator<multiply_op, cnl::wide_integer<20>, cnl::wide_integer<20>>::value);
+        static_assert(builtin_overflow_operator<
+                      subtract_op,
+                      cnl::overflow_integer<int, cnl::trapping_overflow_tag>,
+                      cnl::overflow_integer<int, cnl::trapping_overflow_tag>>::value);
+#endif
+
+        // uintwide_t sums and differences are checked using the carry out of the top limb
+        static_assert(builtin_overflow_operator<add_op, cnl::wide_integer<256>, cnl::wide_integer<256>>::value);
+        static_assert(builtin_overflow_operator<
+                      subtract_op, cnl::wide_integer<255, unsigned>, cnl::wide_integer<255, unsigned>>::value);
+        static_assert(!builtin_overflow_operator<multiply_op, cnl::wide_integer<256>, cnl::wide_integer<256>>::value);
+
+        // elastic_integer results are wider than their operands and never overflow
+        static_assert(!builtin_overflow_operator<add_op, cnl::elastic_integer<31>, cnl::elastic_integer<31>>::value);
+    }
+
+    namespace test_builtin_overflow_convert {
+        using cnl::_impl::builtin_overflow_convert;
+
+#if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
+        static_assert(builtin_overflow_convert<long, int>::value);
+        static_assert(builtin_overflow_convert<int, unsigned>::value);
+        static_assert(builtin_overflow_convert<long, cnl::wide_integer<20>>::value);
+#endif
+        static_assert(!builtin_overflow_convert<double, int>::value);
+        static_assert(!builtin_overflow_convert<int, cnl::wide_integer<256>>::value);
+
+        // the rep of a scaled_integer is not its value
+        static_assert(!builtin_overflow_convert<cnl::scaled_integer<long, cnl::power<-16>>, int>::value);
+
+        static_assert(cnl::overflow_integer<short, cnl::saturated_overflow_tag>{100000L} == 32767);
+        static_assert(cnl::overflow_integer<unsigned, cnl::saturated_overflow_tag>{-1} == 0U);
+        static_assert(
+                cnl::overflow_integer<cnl::wide_integer<20>, cnl::saturated_overflow_tag>{-2000000L} == -1048576);
+    }
+
+    template<int Digits, class Narrowest = int>
+    using saturated_wide_integer = cnl::overflow_integer<
+            cnl::wide_integer<Digits, Narrowest>, cnl::saturated_overflow_tag>;
+
+    template<class Integer>
+    void test_wide_limits()
+    {
+        auto const max{Integer{std::numeric_limits<cnl::_impl::rep_of_t<Integer>>::max()}};
+        auto const lowest{Integer{std::numeric_limits<cnl::_impl::rep_of_t<Integer>>::lowest()}};
+
+        ASSERT_EQ(max, max + Integer{1});
+        ASSERT_EQ(max - Integer{1}, max + Integer{-1});
+        ASSERT_EQ(max, Integer{1} - lowest);
+        ASSERT_EQ(lowest, lowest - Integer{1});
+        ASSERT_EQ(lowest, lowest + lowest);
+        ASSERT_EQ(Integer{-1}, max + lowest);
+    }
+
+    TEST(builtin_overflow_operator, wide_integer_255)  // NOLINT
+    {
+        test_wide_limits<saturated_wide_integer<255>>();
+    }
+
+    TEST(builtin_overflow_operator, wide_integer_256)  // NOLINT
+    {
+        test_wide_limits<saturated_wide_integer<256>>();
+    }
+
+    TEST(builtin_overflow_operator, unsigned_wide_integer)  // NOLINT
+    {
+        using integer = saturated_wide_integer<256, unsigned>;
+        auto const max{std::numeric_limits<cnl::_impl::rep_of_t<integer>>::max()};
+
+        ASSERT_EQ(integer{max}, integer{max} + integer{1U});
+        ASSERT_EQ(integer{0U}, integer{1U} - integer{2U});
+        ASSERT_EQ(integer{max - 1U}, integer{max} - integer{1U});
+    }
+
+    TEST(builtin_overflow_operator, wide_integer_constant_evaluated)  // NOLINT
+    {
+        constexpr auto sum{saturated_wide_integer<20>{1000000} + saturated_wide_integer<20>{1000000}};
+        ASSERT_EQ(saturated_wide_integer<20>{1048575}, sum);
+    }
+}
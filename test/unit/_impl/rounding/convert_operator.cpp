@@ -121,6 +121,62 @@ namespace test_convert_tie_to_pos_inf_rounding_native_datatypes {
             cnl::convert<cnl::tie_to_pos_inf_rounding_tag, double>{}(3)));
 }
 
+namespace test_convert_tie_to_even_rounding_native_datatypes {
+
+    static_assert(identical(
+            0.123F,
+            cnl::convert<cnl::tie_to_even_rounding_tag, float>{}(0.123F)));
+
+    static_assert(identical(
+            0, cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(0.5F)));
+
+    static_assert(identical(
+            2, cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(1.5F)));
+
+    static_assert(identical(
+            2, cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(2.5F)));
+
+    static_assert(identical(
+            1, cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(0.725F)));
+
+    static_assert(identical(
+            0, cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(-0.5F)));
+
+    static_assert(identical(
+            -2, cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(-1.5F)));
+
+    static_assert(identical(
+            -1, cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(-0.725F)));
+
+    static_assert(identical(
+            3L,
+            cnl::convert<cnl::tie_to_even_rounding_tag, long>{}(3)));
+}
+
+namespace test_convert_tie_to_even_rounding_scaled_integer {
+    constexpr auto a = cnl::scaled_integer<int, cnl::power<-4>>{0.375};
+    static_assert(identical(
+            cnl::scaled_integer<int, cnl::power<-2>>{0.5},
+            cnl::convert<cnl::tie_to_even_rounding_tag, cnl::scaled_integer<int, cnl::power<-2>>>{}(a)));
+    static_assert(identical(
+            cnl::scaled_integer<int, cnl::power<-1>>{0.5},
+            cnl::convert<cnl::tie_to_even_rounding_tag, cnl::scaled_integer<int, cnl::power<-1>>>{}(a)));
+
+    constexpr auto b = cnl::scaled_integer<int, cnl::power<-4>>{-0.625};
+    static_assert(identical(
+            cnl::scaled_integer<int, cnl::power<-2>>{-0.5},
+            cnl::convert<cnl::tie_to_even_rounding_tag, cnl::scaled_integer<int, cnl::power<-2>>>{}(b)));
+
+    static_assert(identical(
+            cnl::scaled_integer<long, cnl::power<-2, 10>>{0.12},
+            cnl::convert<cnl::tie_to_even_rounding_tag, cnl::scaled_integer<long, cnl::power<-2, 10>>>{}(
+                    cnl::scaled_integer<long, cnl::power<-3, 10>>{0.125})));
+    static_assert(identical(
+            cnl::scaled_integer<long, cnl::power<-2, 10>>{-0.14},
+            cnl::convert<cnl::tie_to_even_rounding_tag, cnl::scaled_integer<long, cnl::power<-2, 10>>>{}(
+                    cnl::scaled_integer<long, cnl::power<-3, 10>>{-0.135})));
+}
+
 namespace test_convert_native_rounding {
     static_assert(
             cnl::_impl::identical(
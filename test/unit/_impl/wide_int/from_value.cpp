@@ -30,4 +30,9 @@ namespace {
                     cnl::wide_integer<100>{123},
                     cnl::from_value<cnl::wide_integer<100>, cnl::wide_integer<100>>{}(123)),
             "cnl::from_value<cnl::_impl::wide_integer<100>>");
+    static_assert(
+            identical(
+                    cnl::wide_integer<3>{7},
+                    cnl::_impl::from_value<cnl::wide_integer<255>>(cnl::constant<7>{})),
+            "cnl::from_value<cnl::wide_integer, cnl::constant>");
 }
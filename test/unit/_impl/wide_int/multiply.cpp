@@ -0,0 +1,99 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for multiplication of multiword \ref cnl::wide_integer representations
+
+#include <cnl/_impl/wide_tag/multiply.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+using cnl::_impl::identical;
+
+namespace {
+    template<int Digits, typename Narrowest>
+    using wide_rep = typename cnl::wide_tag<Digits, Narrowest>::rep;
+
+    // fills every limb with pseudo-random bits
+    template<typename Rep>
+    [[nodiscard]] constexpr auto make_operand(std::uint32_t seed)
+    {
+        auto operand{Rep{}};
+        for (auto& limb : operand.representation()) {
+            seed = seed * 1664525U + 1013904223U;
+            limb = static_cast<typename Rep::limb_type>(seed);
+        }
+        return operand;
+    }
+
+    namespace test_limb_multiplier {
+        using multiplier = cnl::_impl::limb_multiplier<std::uint8_t, std::uint16_t, 2>;
+
+        static_assert(0 == multiplier::full_scratch_size(1));
+        static_assert(0 == multiplier::low_scratch_size(3));
+        static_assert(0 < multiplier::low_scratch_size(4));
+    }
+
+    namespace test_wide_multiply {
+        // recurses down to a single limb
+        static_assert(
+                identical(
+                        wide_rep<1023, int>{-12345} * wide_rep<1023, int>{6789},
+                        cnl::_impl::wide_multiply<2>(wide_rep<1023, int>{-12345}, wide_rep<1023, int>{6789})),
+                "cnl::_impl::wide_multiply");
+
+        static_assert(
+                identical(
+                        make_operand<wide_rep<1472, unsigned>>(1) * make_operand<wide_rep<1472, unsigned>>(2),
+                        cnl::_impl::wide_multiply<3>(
+                                make_operand<wide_rep<1472, unsigned>>(1),
+                                make_operand<wide_rep<1472, unsigned>>(2))),
+                "cnl::_impl::wide_multiply with odd number of limbs");
+
+        template<typename Rep, int KaratsubaThreshold>
+        void test_against_schoolbook()
+        {
+            for (auto seed = 0U; seed != 100U; ++seed) {
+                auto const lhs{make_operand<Rep>(seed)};
+                auto const rhs{
+                        (seed % 3U) ? make_operand<Rep>(~seed) : std::numeric_limits<Rep>::max()};
+                auto const expected{lhs * rhs};
+                auto const actual{cnl::_impl::wide_multiply<KaratsubaThreshold>(lhs, rhs)};
+                ASSERT_EQ(expected, actual) << "seed=" << seed;
+            }
+        }
+
+        TEST(wide_multiply, recurse_fully)  // NOLINT
+        {
+            test_against_schoolbook<wide_rep<2048, unsigned>, 2>();
+        }
+
+        TEST(wide_multiply, odd_limbs)  // NOLINT
+        {
+            test_against_schoolbook<wide_rep<1471, int>, 5>();
+        }
+
+        TEST(wide_multiply, default_threshold)  // NOLINT
+        {
+            test_against_schoolbook<wide_rep<8191, int>, cnl::_impl::wide_multiply_karatsuba_threshold>();
+        }
+
+        TEST(wide_integer, multiply_karatsuba)  // NOLINT
+        {
+            using w = cnl::wide_integer<8191>;
+            auto const lhs{w{-3} << 5000};
+            auto const rhs{w{7} << 3000};
+            auto const expected{w{-21} << 8000};
+            auto const actual{lhs * rhs};
+            ASSERT_EQ(expected, actual);
+        }
+    }
+}
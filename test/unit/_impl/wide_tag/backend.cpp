@@ -0,0 +1,97 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/wide_tag/backend.h>
+
+#include <cnl/_impl/wide_tag/backend.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+// represent wide_integer using duplex_integer up to 255 digits
+template<int Digits, typename Narrowest>
+requires(Digits < 256) inline constexpr auto cnl::wide_tag_backend_v<Digits, Narrowest> =
+        cnl::wide_tag_backend::duplex_integer;
+
+using cnl::_impl::identical;
+
+namespace {
+    using word = cnl::intmax_t;
+    using unsigned_word = cnl::uintmax_t;
+
+    namespace test_rep {
+        static_assert(identical(
+                cnl::_impl::duplex_integer<word, unsigned_word>{},
+                cnl::_impl::to_rep(cnl::wide_integer<cnl::digits_v<word> * 2 + 1>{})));
+        static_assert(identical(
+                cnl::_impl::duplex_integer<unsigned_word, unsigned_word>{},
+                cnl::_impl::to_rep(cnl::wide_integer<cnl::digits_v<unsigned_word> * 2 - 1, unsigned>{})));
+        static_assert(
+                cnl::_impl::is_duplex_integer_v<cnl::_impl::rep_of_t<cnl::wide_integer<255>>>);
+        static_assert(
+                !cnl::_impl::is_duplex_integer_v<cnl::_impl::rep_of_t<cnl::wide_integer<256>>>);
+    }
+
+    namespace test_arithmetic {
+        using namespace cnl::literals;
+
+        static_assert(identical(
+                cnl::wide_integer<200>{0x1'00000000'00000000'00000000'00000000_wide},
+                cnl::wide_integer<200>{0xFFFFFFFF'FFFFFFFF'FFFFFFFF'FFFFFFFF_wide}
+                        + cnl::wide_integer<200>{1}));
+        static_assert(identical(
+                cnl::wide_integer<200>{-0xFFFFFFFF'FFFFFFFF'FFFFFFFF'FFFFFFFF_wide},
+                cnl::wide_integer<200>{1}
+                        - cnl::wide_integer<200>{0x1'00000000'00000000'00000000'00000000_wide}));
+        static_assert(identical(
+                cnl::wide_integer<200>{0x1'21FA00AD'77D74223'58D29092'2E59BCCC'E1833A90_wide},
+                cnl::wide_integer<200>{0x123456789'ABCDEF01'23456789_wide}
+                        * cnl::wide_integer<200>{-0xFEDCBA98'76543210_wide} * -1));
+        static_assert(identical(
+                cnl::wide_integer<200>{-0x123456789'ABCDEF01'23456789_wide},
+                cnl::wide_integer<200>{0x1'21FA00AD'77D74223'58D29092'2E59BCCC'E1833A90_wide}
+                        / cnl::wide_integer<200>{-0xFEDCBA98'76543210_wide}));
+        static_assert(identical(
+                cnl::wide_integer<200>{7},
+                cnl::wide_integer<200>{0x1'21FA00AD'77D74223'58D29092'2E59BCCC'E1833A97_wide}
+                        % cnl::wide_integer<200>{0xFEDCBA98'76543210_wide}));
+        static_assert(identical(
+                cnl::wide_integer<200>{1} << 199,
+                cnl::wide_integer<200>{0x80'00000000'00000000'00000000'00000000'00000000'00000000_wide}));
+        static_assert(
+                cnl::wide_integer<200>{0x80000000'00000000'00000000_wide}
+                > cnl::wide_integer<200>{0x7FFFFFFF'FFFFFFFF'FFFFFFFF_wide});
+        static_assert(
+                cnl::wide_integer<200>{-0x80000000'00000000'00000000_wide}
+                < cnl::wide_integer<200>{-0x7FFFFFFF'FFFFFFFF'FFFFFFFF_wide});
+    }
+
+    namespace test_conversion {
+        using namespace cnl::literals;
+
+        // between representations
+        static_assert(identical(
+                cnl::wide_integer<300>{-0x123456789'ABCDEF01'23456789_wide},
+                cnl::wide_integer<300>{cnl::wide_integer<200>{-0x123456789'ABCDEF01'23456789_wide}}));
+        static_assert(identical(
+                cnl::wide_integer<200>{-0x123456789'ABCDEF01'23456789_wide},
+                cnl::wide_integer<200>{cnl::wide_integer<300>{-0x123456789'ABCDEF01'23456789_wide}}));
+    }
+
+    TEST(wide_tag_backend, to_chars)  // NOLINT
+    {
+        using namespace cnl::literals;
+        auto const value{cnl::wide_integer<255>{-0x1'21FA00AD'77D74223'58D29092'2E59BCCC'E1833A90_wide}};
+        auto const actual{cnl::to_chars_static(value)};
+        ASSERT_EQ(
+                std::string_view{"-1655473578095867572373615433244507961259406342800"},
+                std::string_view(actual.chars.data(), actual.length));
+    }
+}
@@ -0,0 +1,234 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/divider.h>
+
+#include <cnl/divider.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/cstdint.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+using cnl::_impl::identical;
+
+namespace {
+    namespace test_integer {
+        static_assert(identical(7, 22 / cnl::divider{3}));
+        static_assert(identical(-7, -22 / cnl::divider{3}));
+        static_assert(identical(-7, 22 / cnl::divider{-3}));
+        static_assert(identical(7, -22 / cnl::divider{-3}));
+        static_assert(identical(-22, -22 / cnl::divider{1}));
+        static_assert(identical(22, -22 / cnl::divider{-1}));
+        static_assert(identical(0, 1 / cnl::divider{std::numeric_limits<int>::min()}));
+        static_assert(identical(1, std::numeric_limits<int>::min() / cnl::divider{std::numeric_limits<int>::min()}));
+        static_assert(identical(42U, 126U / cnl::divider{3U}));
+        static_assert(identical(1U, ~0U / cnl::divider{~0U}));
+        static_assert(identical(~0U, ~0U / cnl::divider{1U}));
+        static_assert(identical(UINT64_C(0x5555555555555555), ~UINT64_C(0) / cnl::divider{UINT64_C(3)}));
+
+        // integer promotion
+        static_assert(identical(85, std::uint8_t{255} / cnl::divider{std::uint8_t{3}}));
+        static_assert(identical(-42, std::int16_t{-128} / cnl::divider{std::int16_t{3}}));
+
+        static_assert(identical(-3, cnl::divider{-3}.divisor()));
+
+        template<typename Integer>
+        void test_against_builtin()
+        {
+            auto state{UINT64_C(0x0123456789ABCDEF)};
+            auto const random = [&state]() {
+                state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+                return state;
+            };
+            auto const random_integer = [&random](int shift) {
+                if constexpr (cnl::_impl::width<Integer> > 64) {
+                    auto const upper{static_cast<Integer>(random())};
+                    return static_cast<Integer>(
+                            static_cast<Integer>((upper << 64) | static_cast<Integer>(random())) >> shift);
+                } else {
+                    return static_cast<Integer>(static_cast<Integer>(random()) >> shift);
+                }
+            };
+
+            constexpr auto digits{std::numeric_limits<Integer>::digits};
+            for (auto i{0}; i != 1000; ++i) {
+                auto const divisor{random_integer(i % digits)};
+                if (!divisor) {
+                    continue;
+                }
+                auto const d{cnl::divider{divisor}};
+                for (auto j{0}; j != 100; ++j) {
+                    auto const numerator{random_integer(j % digits)};
+                    if (std::numeric_limits<Integer>::is_signed && divisor == Integer(-1)) {
+                        continue;
+                    }
+                    ASSERT_TRUE(identical(numerator / divisor, numerator / d));
+                }
+            }
+        }
+
+        TEST(divider, int8)  // NOLINT
+        {
+            for (auto divisor{-128}; divisor != 128; ++divisor) {
+                if (!divisor) {
+                    continue;
+                }
+                auto const d{cnl::divider{static_cast<std::int8_t>(divisor)}};
+                for (auto numerator{-128}; numerator != 128; ++numerator) {
+                    ASSERT_EQ(numerator / divisor, static_cast<std::int8_t>(numerator) / d);
+                }
+            }
+        }
+
+        TEST(divider, uint16)  // NOLINT
+        {
+            for (auto divisor{1}; divisor < 0x10000; divisor += 7) {
+                auto const d{cnl::divider{static_cast<std::uint16_t>(divisor)}};
+                for (auto numerator{0}; numerator < 0x10000; numerator += 5) {
+                    ASSERT_EQ(numerator / divisor, static_cast<std::uint16_t>(numerator) / d);
+                }
+            }
+        }
+
+        TEST(divider, int32)  // NOLINT
+        {
+            test_against_builtin<std::int32_t>();
+        }
+
+        TEST(divider, uint32)  // NOLINT
+        {
+            test_against_builtin<std::uint32_t>();
+        }
+
+        TEST(divider, int64)  // NOLINT
+        {
+            test_against_builtin<std::int64_t>();
+        }
+
+        TEST(divider, uint64)  // NOLINT
+        {
+            test_against_builtin<std::uint64_t>();
+        }
+
+#if defined(CNL_INT128_ENABLED)
+        TEST(divider, int128)  // NOLINT
+        {
+            test_against_builtin<cnl::int128_t>();
+        }
+
+        TEST(divider, uint128)  // NOLINT
+        {
+            test_against_builtin<cnl::uint128_t>();
+        }
+#endif
+    }
+
+    namespace test_rounding_integer {
+        template<typename Tag>
+        using rounding_int = cnl::rounding_integer<int, Tag>;
+
+        template<typename Tag>
+        void test_against_operator()
+        {
+            for (auto divisor{-50}; divisor != 50; ++divisor) {
+                if (!divisor) {
+                    continue;
+                }
+                auto const d{cnl::divider{rounding_int<Tag>{divisor}}};
+                for (auto numerator{-200}; numerator != 200; ++numerator) {
+                    auto const expected{rounding_int<Tag>{numerator} / rounding_int<Tag>{divisor}};
+                    auto const actual{rounding_int<Tag>{numerator} / d};
+                    ASSERT_TRUE(identical(expected, actual)) << numerator << '/' << divisor;
+                }
+            }
+        }
+
+        static_assert(identical(
+                rounding_int<cnl::nearest_rounding_tag>{3},
+                rounding_int<cnl::nearest_rounding_tag>{5} / cnl::divider{rounding_int<cnl::nearest_rounding_tag>{2}}));
+        static_assert(identical(
+                rounding_int<cnl::nearest_rounding_tag>{-3},
+                rounding_int<cnl::nearest_rounding_tag>{-5} / cnl::divider{rounding_int<cnl::nearest_rounding_tag>{2}}));
+        static_assert(identical(
+                rounding_int<cnl::neg_inf_rounding_tag>{-3},
+                rounding_int<cnl::neg_inf_rounding_tag>{-5} / cnl::divider{rounding_int<cnl::neg_inf_rounding_tag>{2}}));
+
+        TEST(divider, native_rounding_tag)  // NOLINT
+        {
+            test_against_operator<cnl::native_rounding_tag>();
+        }
+
+        TEST(divider, nearest_rounding_tag)  // NOLINT
+        {
+            test_against_operator<cnl::nearest_rounding_tag>();
+        }
+
+        TEST(divider, neg_inf_rounding_tag)  // NOLINT
+        {
+            test_against_operator<cnl::neg_inf_rounding_tag>();
+        }
+    }
+
+    namespace test_scaled_integer {
+        using q15_16 = cnl::scaled_integer<std::int32_t, cnl::power<-16>>;
+        using q7_8 = cnl::scaled_integer<std::int32_t, cnl::power<-8>>;
+
+        static_assert(identical(q15_16{7.5} / q15_16{2.5}, q15_16{7.5} / cnl::divider{q15_16{2.5}}));
+        static_assert(identical(q7_8{-7.5} / q15_16{2.5}, q7_8{-7.5} / cnl::divider{q15_16{2.5}}));
+
+        using rounding_q15_16 = cnl::scaled_integer<cnl::rounding_integer<std::int32_t>, cnl::power<-16>>;
+        static_assert(identical(
+                rounding_q15_16{1} / rounding_q15_16{3},
+                rounding_q15_16{1} / cnl::divider{rounding_q15_16{3}}));
+
+        TEST(divider, scaled_integer_nearest_rounding_tag)  // NOLINT
+        {
+            auto const divisor{rounding_q15_16{0.7}};
+            auto const d{cnl::divider{divisor}};
+            for (auto numerator{-1000}; numerator != 1000; ++numerator) {
+                auto const n{cnl::_impl::from_rep<rounding_q15_16>(
+                        cnl::rounding_integer<std::int32_t>{numerator * 997})};
+                ASSERT_TRUE(identical(n / divisor, n / d));
+            }
+        }
+    }
+
+    namespace test_divide {
+        constexpr auto divide_array()
+        {
+            auto const numerators{std::array{-7, 0, 7, 8, 100}};
+            auto quotients{std::array<int, 5>{}};
+            cnl::divide(std::span{numerators}, cnl::divider{4}, std::span{quotients});
+            return quotients;
+        }
+        static_assert(std::array{-1, 0, 1, 2, 25} == divide_array());
+
+        TEST(divider, divide_scaled_integer)  // NOLINT
+        {
+            using sample = cnl::scaled_integer<std::int16_t, cnl::power<-8>>;
+            auto numerators{std::array<sample, 64>{}};
+            for (auto index{0U}; index != numerators.size(); ++index) {
+                numerators[index] = sample{static_cast<double>(index) * 1.5 - 40.};
+            }
+            auto const gain{sample{2.75}};
+
+            auto quotients{std::array<cnl::divider<sample>::quotient_type<-8>, numerators.size()>{}};
+            cnl::divide(std::span{numerators}, cnl::divider{gain}, std::span{quotients});
+
+            for (auto index{0U}; index != numerators.size(); ++index) {
+                ASSERT_TRUE(identical(numerators[index] / gain, quotients[index]));
+            }
+        }
+    }
+}
@@ -0,0 +1,135 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for cnl::fraction_array
+
+#include <cnl/fraction.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using cnl::elastic_integer;
+using cnl::fraction;
+using cnl::fraction_array;
+
+namespace {
+    using cnl::_impl::identical;
+
+    // fractions with a variety of signs and common factors
+    template<typename Numerator, typename Denominator = Numerator>
+    auto test_fractions(int size, int seed)
+    {
+        auto fractions = std::vector<fraction<Numerator, Denominator>>{};
+        for (auto index{0}; index != size; ++index) {
+            auto const numerator{(index * 37 + seed) % 199 - 99};
+            auto const denominator{(index * 53 + seed) % 97 + 1};
+            fractions.emplace_back(Numerator(numerator * 6), Denominator(denominator * 4));
+        }
+        return fractions;
+    }
+
+    // checks that an operation on arrays gives the same result as on each pair of fractions
+    template<class Lhs, class Rhs, class ArrayResult, class Operation>
+    void expect_elementwise(Lhs const& lhs, Rhs const& rhs, ArrayResult const& result, Operation operation)
+    {
+        ASSERT_EQ(lhs.size(), result.size());
+        for (auto index{std::size_t{0}}; index != lhs.size(); ++index) {
+            auto const expected{operation(lhs[index], rhs[index])};
+            static_assert(std::is_same_v<
+                          std::remove_cvref_t<decltype(expected)>, typename ArrayResult::value_type>);
+            ASSERT_TRUE(identical(expected.numerator, result[index].numerator)) << index;
+            ASSERT_TRUE(identical(expected.denominator, result[index].denominator)) << index;
+        }
+    }
+
+    static_assert(fraction_array<int>(3).size() == 3);
+    static_assert(identical(cnl::make_fraction(0, 1).denominator, fraction_array<int>(3)[2].denominator));
+
+    TEST(fraction_array, from_fractions)  // NOLINT
+    {
+        auto const fractions = std::array{fraction<int>{1, 2}, fraction<int>{-3, 4}, fraction<int>{5, 6}};
+        auto const array{fraction_array<int>{fractions}};
+        ASSERT_EQ(3U, array.size());
+        ASSERT_EQ((std::vector{1, -3, 5}), std::vector(array.numerators().begin(), array.numerators().end()));
+        ASSERT_EQ((std::vector{2, 4, 6}), std::vector(array.denominators().begin(), array.denominators().end()));
+        ASSERT_TRUE(identical(fractions[1], array[1]));
+    }
+
+    TEST(fraction_array, arithmetic)  // NOLINT
+    {
+        auto const lhs_fractions = test_fractions<int>(100, 1);
+        auto const rhs_fractions = test_fractions<int>(100, 2);
+        auto const lhs{fraction_array<int>{lhs_fractions}};
+        auto const rhs{fraction_array<int>{rhs_fractions}};
+
+        expect_elementwise(lhs, rhs, lhs + rhs, [](auto const& l, auto const& r) { return l + r; });
+        expect_elementwise(lhs, rhs, lhs - rhs, [](auto const& l, auto const& r) { return l - r; });
+        expect_elementwise(lhs, rhs, lhs * rhs, [](auto const& l, auto const& r) { return l * r; });
+    }
+
+    TEST(fraction_array, elastic_integer)  // NOLINT
+    {
+        auto const lhs_fractions = test_fractions<elastic_integer<10>>(100, 3);
+        auto const rhs_fractions = test_fractions<elastic_integer<10>, elastic_integer<10, unsigned>>(100, 4);
+        auto const lhs{fraction_array<elastic_integer<10>>{lhs_fractions}};
+        auto const rhs{fraction_array<elastic_integer<10>, elastic_integer<10, unsigned>>{rhs_fractions}};
+
+        auto const sum{lhs + rhs};
+        static_assert(std::is_same_v<
+                      fraction_array<elastic_integer<21>, elastic_integer<20>>, std::remove_cvref_t<decltype(sum)>>);
+        expect_elementwise(lhs, rhs, sum, [](auto const& l, auto const& r) { return l + r; });
+        expect_elementwise(lhs, rhs, lhs * rhs, [](auto const& l, auto const& r) { return l * r; });
+    }
+
+    TEST(fraction_array, compare)  // NOLINT
+    {
+        auto const lhs{fraction_array<int>{test_fractions<int>(100, 5)}};
+        auto const rhs{fraction_array<int>{test_fractions<int>(100, 5)}};
+
+        auto result = std::vector<int>(lhs.size());
+        cnl::compare(lhs, rhs + rhs, result);
+        for (auto index{std::size_t{0}}; index != lhs.size(); ++index) {
+            auto const doubled{rhs[index] + rhs[index]};
+            auto const expected{lhs[index] < doubled ? -1 : lhs[index] == doubled ? 0 : 1};
+            ASSERT_EQ(expected, result[index]) << index;
+        }
+
+        cnl::compare(lhs, rhs, result);
+        ASSERT_EQ(std::vector<int>(lhs.size(), 0), result);
+    }
+
+    TEST(fraction_array, reduce)  // NOLINT
+    {
+        auto const fractions{fraction_array<int>{test_fractions<int>(100, 6)}};
+        auto const reduced{cnl::reduce(fractions)};
+        expect_elementwise(fractions, fractions, reduced, [](auto const& f, auto const&) { return cnl::reduce(f); });
+    }
+
+    TEST(fraction_array, quotients)  // NOLINT
+    {
+        using quotient = cnl::scaled_integer<int, cnl::power<-16>>;
+        auto const fractions{fraction_array<int>{test_fractions<int>(100, 7)}};
+
+        auto result = std::vector<quotient>(fractions.size());
+        fractions.quotients(std::span{result});
+        for (auto index{std::size_t{0}}; index != fractions.size(); ++index) {
+            ASSERT_TRUE(identical(quotient{fractions[index]}, result[index])) << index;
+        }
+
+        auto floats = std::vector<float>(fractions.size());
+        fractions.quotients(std::span{floats});
+        ASSERT_EQ(static_cast<float>(fractions[42]), floats[42]);
+    }
+}
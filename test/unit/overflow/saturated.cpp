@@ -0,0 +1,118 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of branchless arithmetic and sequence operations with cnl::saturated_overflow_tag
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/overflow_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+using cnl::_impl::identical;
+
+namespace {
+    template<typename Rep>
+    using saturated_integer = cnl::overflow_integer<Rep, cnl::saturated_overflow_tag>;
+
+    namespace test_scalar {
+        constexpr auto int_max{std::numeric_limits<int>::max()};
+        constexpr auto int_lowest{std::numeric_limits<int>::lowest()};
+
+        static_assert(identical(saturated_integer<int>{int_max}, saturated_integer<int>{int_max - 5} + saturated_integer<int>{6}));
+        static_assert(identical(saturated_integer<int>{int_lowest}, saturated_integer<int>{int_lowest + 5} + saturated_integer<int>{-6}));
+        static_assert(identical(saturated_integer<int>{-1}, saturated_integer<int>{int_max} + saturated_integer<int>{int_lowest}));
+        static_assert(identical(saturated_integer<int>{int_lowest}, saturated_integer<int>{-2} - saturated_integer<int>{int_max}));
+        static_assert(identical(saturated_integer<int>{int_max}, saturated_integer<int>{0} - saturated_integer<int>{int_lowest}));
+        static_assert(identical(saturated_integer<int>{int_lowest}, saturated_integer<int>{-65536} * saturated_integer<int>{65536}));
+        static_assert(identical(saturated_integer<int>{int_max}, saturated_integer<int>{-65536} * saturated_integer<int>{-65536}));
+
+        static_assert(identical(saturated_integer<unsigned>{0U}, saturated_integer<unsigned>{5U} - saturated_integer<unsigned>{6U}));
+        static_assert(identical(
+                saturated_integer<std::uint64_t>{std::numeric_limits<std::uint64_t>::max()},
+                saturated_integer<std::uint64_t>{std::uint64_t{1} << 63} + saturated_integer<std::uint64_t>{std::uint64_t{1} << 63}));
+
+        // conversion
+        static_assert(identical(saturated_integer<std::int16_t>{32767}, saturated_integer<std::int16_t>{saturated_integer<std::int16_t>{30000} + saturated_integer<std::int16_t>{30000}}));
+        static_assert(identical(std::uint8_t{0}, cnl::convert<cnl::saturated_overflow_tag, std::uint8_t>{}(-1)));
+        static_assert(identical(std::int8_t{127}, cnl::convert<cnl::saturated_overflow_tag, std::int8_t>{}(200U)));
+        static_assert(identical(std::int64_t{-5}, cnl::convert<cnl::saturated_overflow_tag, std::int64_t>{}(-5)));
+    }
+
+    namespace test_span {
+        static_assert([]() {
+            using integer = saturated_integer<std::int16_t>;
+            auto const lhs{std::array<integer, 3>{30000, -30000, 5}};
+            auto const rhs{std::array<integer, 3>{30000, -30000, 6}};
+            auto sums{std::array<integer, 3>{}};
+            cnl::add(std::span{lhs}, std::span{rhs}, std::span{sums});
+            return sums == std::array<integer, 3>{32767, -32768, 11};
+        }());
+    }
+
+    template<typename Rep>
+    void test_sequence()
+    {
+        using integer = saturated_integer<Rep>;
+
+        // long enough to be processed a vector at a time, and then one element at a time
+        constexpr auto size{std::size_t{101}};
+        std::vector<integer> lhs(size);
+        std::vector<integer> rhs(size);
+        auto const range{double(std::numeric_limits<Rep>::max()) - double(std::numeric_limits<Rep>::lowest())};
+        for (auto index{std::size_t{0}}; index != size; ++index) {
+            lhs[index] = integer{double(std::numeric_limits<Rep>::lowest()) + range * double((index * 37) % size) / double(size)};
+            rhs[index] = integer{double(std::numeric_limits<Rep>::lowest()) + range * double((index * 59) % size) / double(size)};
+        }
+
+        std::vector<integer> sums(size);
+        std::vector<integer> differences(size);
+        cnl::add(std::span<integer const>{lhs}, std::span<integer const>{rhs}, std::span{sums});
+        cnl::subtract(std::span<integer const>{lhs}, std::span<integer const>{rhs}, std::span{differences});
+        for (auto index{std::size_t{0}}; index != size; ++index) {
+            ASSERT_EQ(integer{lhs[index] + rhs[index]}, sums[index]) << index;
+            ASSERT_EQ(integer{lhs[index] - rhs[index]}, differences[index]) << index;
+        }
+
+        // in place
+        cnl::add(std::span<integer const>{lhs}, std::span<integer const>{rhs}, std::span{lhs});
+        for (auto index{std::size_t{0}}; index != size; ++index) {
+            ASSERT_EQ(sums[index], lhs[index]) << index;
+        }
+    }
+
+    TEST(saturated_overflow_tag, sequence_int8)  // NOLINT
+    {
+        test_sequence<std::int8_t>();
+    }
+
+    TEST(saturated_overflow_tag, sequence_uint8)  // NOLINT
+    {
+        test_sequence<std::uint8_t>();
+    }
+
+    TEST(saturated_overflow_tag, sequence_int16)  // NOLINT
+    {
+        test_sequence<std::int16_t>();
+    }
+
+    TEST(saturated_overflow_tag, sequence_uint16)  // NOLINT
+    {
+        test_sequence<std::uint16_t>();
+    }
+
+    TEST(saturated_overflow_tag, sequence_int32)  // NOLINT
+    {
+        test_sequence<std::int32_t>();
+    }
+}
@@ -0,0 +1,105 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::sticky_overflow_tag
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/overflow.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+using cnl::_impl::identical;
+
+namespace {
+    using sticky_int16 = cnl::overflow_integer<std::int16_t, cnl::sticky_overflow_tag>;
+
+    namespace test_sticky_constexpr {
+        static_assert(identical(
+                std::uint8_t{200},
+                cnl::convert<cnl::sticky_overflow_tag, std::uint8_t>{}(200)));
+        static_assert(identical(
+                -32768,
+                cnl::_impl::operate<cnl::_impl::subtract_op, cnl::sticky_overflow_tag>{}(-32767, 1)));
+        static_assert(identical(
+                std::uint64_t{0xFFFFFFFF00000000},
+                cnl::_impl::operate<cnl::_impl::add_op, cnl::sticky_overflow_tag>{}(
+                        std::uint64_t{0x7FFFFFFF80000000}, std::uint64_t{0x7FFFFFFF80000000})));
+        static_assert(identical(sticky_int16{-2}, sticky_int16{sticky_int16{5} * sticky_int16{2} - sticky_int16{12}}));
+    }
+
+    TEST(sticky_overflow_tag, clear)  // NOLINT
+    {
+        static_cast<void>(cnl::clear_sticky_overflow());
+        ASSERT_FALSE(cnl::test_sticky_overflow());
+        ASSERT_FALSE(cnl::clear_sticky_overflow());
+    }
+
+    TEST(sticky_overflow_tag, wraps)  // NOLINT
+    {
+        static_cast<void>(cnl::clear_sticky_overflow());
+
+        auto const sum{cnl::_impl::operate<cnl::_impl::add_op, cnl::sticky_overflow_tag>{}(
+                std::numeric_limits<int>::max(), 1)};
+        ASSERT_EQ(std::numeric_limits<int>::min(), sum);
+        ASSERT_TRUE(cnl::test_sticky_overflow());
+        ASSERT_TRUE(cnl::clear_sticky_overflow());
+        ASSERT_FALSE(cnl::test_sticky_overflow());
+
+        auto const difference{cnl::_impl::operate<cnl::_impl::subtract_op, cnl::sticky_overflow_tag>{}(0U, 1U)};
+        ASSERT_EQ(std::numeric_limits<unsigned>::max(), difference);
+        ASSERT_TRUE(cnl::clear_sticky_overflow());
+
+        auto const product{cnl::_impl::operate<cnl::_impl::multiply_op, cnl::sticky_overflow_tag>{}(
+                std::int64_t{1} << 40, std::int64_t{1} << 30)};
+        static_cast<void>(product);
+        ASSERT_TRUE(cnl::clear_sticky_overflow());
+
+        auto const converted{cnl::convert<cnl::sticky_overflow_tag, std::uint8_t>{}(-1)};
+        ASSERT_EQ(255, converted);
+        ASSERT_TRUE(cnl::clear_sticky_overflow());
+    }
+
+    TEST(sticky_overflow_tag, batch)  // NOLINT
+    {
+        static_cast<void>(cnl::clear_sticky_overflow());
+
+        // the flag stays raised by the overflowing operation after later operations succeed
+        auto values{std::array<sticky_int16, 4>{1000, 20000, 20000, -30000}};
+        auto total{sticky_int16{0}};
+        for (auto const& value : values) {
+            total += value;
+        }
+        ASSERT_EQ(sticky_int16{static_cast<std::int16_t>(1000 + 20000 + 20000 - 30000 - 65536)}, total);
+        ASSERT_TRUE(cnl::clear_sticky_overflow());
+
+        for (auto const& value : values) {
+            total = sticky_int16{value / sticky_int16{2}};
+        }
+        ASSERT_EQ(sticky_int16{-15000}, total);
+        ASSERT_FALSE(cnl::test_sticky_overflow());
+    }
+
+    TEST(sticky_overflow_tag, scaled_integer)  // NOLINT
+    {
+        static_cast<void>(cnl::clear_sticky_overflow());
+
+        using number = cnl::scaled_integer<sticky_int16, cnl::power<-8>>;
+        auto const product{number{number{1.5} * number{2.25}}};
+        ASSERT_EQ(3.375, product);
+        ASSERT_FALSE(cnl::test_sticky_overflow());
+
+        auto const overflowed{number{number{100} * number{2}}};
+        static_cast<void>(overflowed);
+        ASSERT_TRUE(cnl::clear_sticky_overflow());
+    }
+}
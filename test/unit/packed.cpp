@@ -0,0 +1,220 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/packed.h>
+
+#include <cnl/packed.h>
+
+#include <cnl/elastic_integer.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <system_error>
+#include <vector>
+
+using cnl::power;
+using cnl::scaled_integer;
+
+namespace {
+    template<typename... Bytes>
+    constexpr auto bytes(Bytes... values)
+    {
+        return std::array<std::byte, sizeof...(Bytes)>{static_cast<std::byte>(values)...};
+    }
+
+    // the result of encoding then decoding value
+    template<typename Number>
+    constexpr auto round_trip(Number const& value)
+    {
+        std::array<std::byte, cnl::packed_size_v<Number>> encoding{};
+        auto const* const last{cnl::to_bytes(encoding.data(), encoding.data() + encoding.size(), value).ptr};
+        auto decoded{Number{}};
+        auto const result{cnl::from_bytes(encoding.data(), last, decoded)};
+        return result.ec == std::errc{} && result.ptr == last && decoded == value;
+    }
+
+    template<typename Number>
+    constexpr auto varint_round_trip(Number const& value)
+    {
+        std::array<std::byte, 10> encoding{};
+        auto const* const last{cnl::to_varint(encoding.data(), encoding.data() + encoding.size(), value).ptr};
+        auto decoded{Number{}};
+        auto const result{cnl::from_varint(encoding.data(), last, decoded)};
+        return result.ec == std::errc{} && result.ptr == last && decoded == value;
+    }
+
+    namespace test_packed_size {
+        static_assert(cnl::packed_size_v<std::int8_t> == 1);
+        static_assert(cnl::packed_size_v<std::uint32_t> == 4);
+        static_assert(cnl::packed_size_v<cnl::elastic_integer<7>> == 1);
+        static_assert(cnl::packed_size_v<cnl::elastic_integer<8>> == 2);
+        static_assert(cnl::packed_size_v<cnl::elastic_integer<8, unsigned>> == 1);
+        static_assert(cnl::packed_size_v<cnl::elastic_integer<10>> == 2);
+        static_assert(cnl::packed_size_v<scaled_integer<cnl::elastic_integer<20>, power<-16>>> == 3);
+        static_assert(cnl::packed_size_v<cnl::wide_integer<100>> == 13);
+        static_assert(cnl::packed_size_v<cnl::wide_integer<200, unsigned>> == 25);
+    }
+
+    namespace test_bytes {
+        static_assert(round_trip(std::int16_t{-2}));
+        static_assert(round_trip(cnl::elastic_integer<10>{-1023}));
+        static_assert(round_trip(scaled_integer<cnl::elastic_integer<20>, power<-16>>{-7.25}));
+        static_assert(round_trip(std::numeric_limits<std::int64_t>::min()));
+
+        TEST(packed, to_bytes)  // NOLINT
+        {
+            std::array<std::byte, 2> encoding{};
+            auto const result{cnl::to_bytes(
+                    encoding.data(), encoding.data() + encoding.size(), cnl::elastic_integer<10>{-300})};
+            ASSERT_EQ((cnl::to_bytes_result{encoding.data() + 2, std::errc{}}), result);
+            ASSERT_EQ(bytes(0xd4, 0xfe), encoding);
+        }
+
+        TEST(packed, to_bytes_too_small)  // NOLINT
+        {
+            std::array<std::byte, 3> encoding{};
+            auto const result{cnl::to_bytes(encoding.data(), encoding.data() + encoding.size(), 1)};
+            ASSERT_EQ((cnl::to_bytes_result{encoding.data() + 3, std::errc::value_too_large}), result);
+        }
+
+        TEST(packed, from_bytes_out_of_range)  // NOLINT
+        {
+            auto const encoding{bytes(0x00, 0x04)};
+            auto value{cnl::elastic_integer<10>{7}};
+            auto const result{cnl::from_bytes(encoding.data(), encoding.data() + encoding.size(), value)};
+            ASSERT_EQ(std::errc::result_out_of_range, result.ec);
+            ASSERT_EQ(cnl::elastic_integer<10>{7}, value);
+        }
+
+        TEST(packed, from_bytes_truncated)  // NOLINT
+        {
+            auto const encoding{bytes(0x00, 0x04, 0x00)};
+            auto value{0};
+            auto const result{cnl::from_bytes(encoding.data(), encoding.data() + encoding.size(), value)};
+            ASSERT_EQ((cnl::from_bytes_result{encoding.data(), std::errc::invalid_argument}), result);
+        }
+
+        TEST(packed, wide_integer)  // NOLINT
+        {
+            auto const value{cnl::wide_integer<200>{-1234567890123456789} * 1000000000000000000 * 1000000000000000000};
+            ASSERT_TRUE(round_trip(value));
+            ASSERT_TRUE(round_trip(cnl::wide_integer<200>{-value}));
+            ASSERT_TRUE(round_trip(cnl::wide_integer<255, unsigned>{-value} << 50));
+        }
+    }
+
+    namespace test_varint {
+        static_assert(varint_round_trip(0));
+        static_assert(varint_round_trip(std::numeric_limits<std::int64_t>::min()));
+        static_assert(varint_round_trip(std::numeric_limits<std::uint64_t>::max()));
+        static_assert(varint_round_trip(cnl::elastic_integer<10>{-1023}));
+        static_assert(varint_round_trip(scaled_integer<cnl::elastic_integer<20>, power<-16>>{-7.25}));
+
+        TEST(packed, to_varint)  // NOLINT
+        {
+            auto const encode{[](auto const& value) {
+                std::array<std::byte, 10> encoding{};
+                auto const result{cnl::to_varint(encoding.data(), encoding.data() + encoding.size(), value)};
+                return std::vector<std::byte>(encoding.data(), result.ptr);
+            }};
+            ASSERT_EQ((std::vector{static_cast<std::byte>(0)}), encode(0));
+            ASSERT_EQ((std::vector{static_cast<std::byte>(1)}), encode(-1));
+            ASSERT_EQ((std::vector{static_cast<std::byte>(2)}), encode(1));
+            ASSERT_EQ((std::vector{static_cast<std::byte>(0xac), static_cast<std::byte>(0x02)}), encode(300U));
+            ASSERT_EQ(10U, encode(std::numeric_limits<std::int64_t>::min()).size());
+        }
+
+        TEST(packed, to_varint_too_small)  // NOLINT
+        {
+            std::array<std::byte, 1> encoding{};
+            auto const result{cnl::to_varint(encoding.data(), encoding.data() + encoding.size(), 300U)};
+            ASSERT_EQ((cnl::to_bytes_result{encoding.data() + 1, std::errc::value_too_large}), result);
+        }
+
+        TEST(packed, from_varint_truncated)  // NOLINT
+        {
+            auto const encoding{bytes(0xac)};
+            auto value{0U};
+            auto const result{cnl::from_varint(encoding.data(), encoding.data() + encoding.size(), value)};
+            ASSERT_EQ((cnl::from_bytes_result{encoding.data(), std::errc::invalid_argument}), result);
+        }
+
+        TEST(packed, from_varint_out_of_range)  // NOLINT
+        {
+            auto const too_many_digits{bytes(0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02)};
+            auto wide_value{std::uint64_t{7}};
+            auto const wide_result{cnl::from_varint(
+                    too_many_digits.data(), too_many_digits.data() + too_many_digits.size(), wide_value)};
+            ASSERT_EQ(std::errc::result_out_of_range, wide_result.ec);
+            ASSERT_EQ(too_many_digits.data() + too_many_digits.size(), wide_result.ptr);
+            ASSERT_EQ(7U, wide_value);
+
+            // zigzag encoding of 1024
+            auto const encoding{bytes(0x80, 0x10)};
+            auto value{cnl::elastic_integer<10>{7}};
+            auto const result{cnl::from_varint(encoding.data(), encoding.data() + encoding.size(), value)};
+            ASSERT_EQ(std::errc::result_out_of_range, result.ec);
+            ASSERT_EQ(cnl::elastic_integer<10>{7}, value);
+        }
+    }
+
+    namespace test_packed_view {
+        using s11_4 = scaled_integer<cnl::elastic_integer<15>, power<-4>>;
+
+        static_assert(std::ranges::random_access_range<cnl::packed_view<s11_4>>);
+        static_assert(std::ranges::sized_range<cnl::packed_view<s11_4>>);
+        static_assert(std::ranges::view<cnl::packed_view<s11_4>>);
+
+        TEST(packed, packed_view)  // NOLINT
+        {
+            std::vector<s11_4> values(100);
+            for (auto index = std::size_t{0}; index != values.size(); ++index) {
+                values[index] = s11_4{2047. * std::sin(static_cast<double>(index))};
+            }
+
+            // deliberately misaligned and followed by an incomplete element
+            std::vector<std::byte> buffer(1 + values.size() * 2 + 1);
+            auto* out{buffer.data() + 1};
+            for (auto const& value : values) {
+                out = cnl::to_bytes(out, buffer.data() + buffer.size(), value).ptr;
+            }
+
+            auto const view{cnl::packed_view<s11_4>{std::span{buffer}.subspan(1)}};
+            ASSERT_EQ(values.size(), view.size());
+            ASSERT_TRUE(std::ranges::equal(values, view));
+            ASSERT_EQ(values[42], view[42]);
+            ASSERT_EQ(values.back(), *std::ranges::prev(view.end()));
+            ASSERT_EQ(values[17], view.begin()[17]);
+            ASSERT_EQ(
+                    *std::ranges::max_element(values),
+                    *std::ranges::max_element(view));
+        }
+
+        TEST(packed, packed_view_read)  // NOLINT
+        {
+            // the second element is too great for elastic_integer<10>
+            auto const buffer{std::array{
+                    std::byte{0xff}, std::byte{0x03}, std::byte{0x00}, std::byte{0x04}}};
+            auto const view{cnl::packed_view<cnl::elastic_integer<10>>{buffer}};
+
+            auto value{cnl::elastic_integer<10>{7}};
+            ASSERT_EQ((cnl::from_bytes_result{buffer.data() + 2, std::errc{}}), view.read(0, value));
+            ASSERT_EQ(1023, value);
+            ASSERT_EQ((cnl::from_bytes_result{buffer.data() + 4, std::errc::result_out_of_range}), view.read(1, value));
+            ASSERT_EQ(1023, value);
+        }
+    }
+}
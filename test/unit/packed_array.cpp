@@ -0,0 +1,188 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for cnl::packed_array
+
+#include <cnl/packed.h>
+
+#include <cnl/elastic_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+using cnl::elastic_integer;
+using cnl::packed_array;
+using cnl::power;
+using cnl::scaled_integer;
+
+using u20 = elastic_integer<20, unsigned>;
+
+namespace {
+    static_assert(cnl::packed_width_v<elastic_integer<12>> == 13);
+    static_assert(cnl::packed_width_v<elastic_integer<12, unsigned>> == 12);
+    static_assert(cnl::packed_width_v<scaled_integer<elastic_integer<20>, power<-8>>> == 21);
+    static_assert(cnl::packed_width_v<std::int64_t> == 64);
+
+    static_assert(std::ranges::random_access_range<packed_array<elastic_integer<12>>>);
+    static_assert(std::ranges::random_access_range<packed_array<elastic_integer<12>> const>);
+    static_assert(std::ranges::sized_range<packed_array<elastic_integer<12>>>);
+    static_assert(std::indirectly_writable<
+                  std::ranges::iterator_t<packed_array<elastic_integer<12>>>, elastic_integer<12>>);
+    static_assert(!std::indirectly_writable<
+                  std::ranges::iterator_t<packed_array<elastic_integer<12>> const>, elastic_integer<12>>);
+
+    // the sequence of values, -limit, -limit + step, ... which fits in Number, as Number
+    template<typename Number>
+    auto test_values(std::size_t size)
+    {
+        constexpr auto width{cnl::packed_width_v<Number>};
+        auto values = std::vector<Number>(size);
+        for (auto index{std::size_t{0}}; index != size; ++index) {
+            auto const bits{(index * 0x9e3779b97f4a7c15U) >> (64 - width)};
+            values[index] = cnl::_impl::from_bit_field<Number>(bits);
+        }
+        return values;
+    }
+
+    template<typename Number>
+    void test_round_trip(std::size_t size)
+    {
+        auto const expected = test_values<Number>(size);
+
+        auto elements{packed_array<Number>(size)};
+        std::ranges::copy(expected, elements.begin());
+        ASSERT_TRUE(std::ranges::equal(expected, std::as_const(elements)));
+
+        auto unpacked = std::vector<Number>(size);
+        elements.unpack(0, unpacked);
+        ASSERT_EQ(expected, unpacked);
+
+        auto packed{packed_array<Number>(size)};
+        packed.pack(0, expected);
+        ASSERT_TRUE(packed == elements);
+    }
+
+    TEST(packed_array, words)  // NOLINT
+    {
+        auto const values{std::array<elastic_integer<12>, 5>{1, -1, 2047, -4096, 0}};
+        auto const elements{packed_array<elastic_integer<12>>{values}};
+        ASSERT_EQ(5U, elements.size());
+        // 5 * 13 bits spill into a second word, plus a word of padding
+        ASSERT_EQ(3U, elements.words().size());
+        ASSERT_EQ(
+                std::uint64_t{1} | (std::uint64_t{0x1fff} << 13) | (std::uint64_t{0x07ff} << 26)
+                        | (std::uint64_t{0x1000} << 39),
+                elements.words()[0]);
+        ASSERT_EQ(0U, elements.words()[1]);
+    }
+
+    TEST(packed_array, element_straddles_words)  // NOLINT
+    {
+        auto elements{packed_array<u20>(7)};
+        // bits 60 to 79
+        elements[3] = 0xabcde;
+        u20 const element = elements[3];
+        ASSERT_EQ(0xabcde, element);
+        ASSERT_EQ(std::uint64_t{0xe} << 60, elements.words()[0]);
+        ASSERT_EQ(std::uint64_t{0xabcd}, elements.words()[1]);
+        ASSERT_EQ(0, std::as_const(elements)[2]);
+        ASSERT_EQ(0, std::as_const(elements)[4]);
+    }
+
+    TEST(packed_array, reference)  // NOLINT
+    {
+        auto elements{packed_array<elastic_integer<12>>(4)};
+        elements[0] = 1000;
+        elements[2] = elements[0];
+        elements[1] = -std::as_const(elements)[2];
+        std::ranges::iter_swap(elements.begin() + 2, elements.begin() + 3);
+
+        auto const expected = std::vector<elastic_integer<12>>{1000, -1000, 0, 1000};
+        ASSERT_TRUE(std::ranges::equal(expected, std::as_const(elements)));
+    }
+
+    TEST(packed_array, scaled_integer)  // NOLINT
+    {
+        using number = scaled_integer<elastic_integer<12>, power<-4>>;
+        auto elements{packed_array<number>(3)};
+        elements[0] = number{-127.9375};
+        elements[1] = number{.5};
+        number const first = elements[0];
+        number const second = elements[1];
+        elements[2] = first + second;
+        ASSERT_EQ(1U, elements.words().size() - 1);
+        ASSERT_EQ(number{-127.4375}, std::as_const(elements)[2]);
+    }
+
+    TEST(packed_array, constexpr)  // NOLINT
+    {
+        static_assert([]() {
+            // long enough to include a whole block
+            constexpr auto size{130};
+            auto values{std::array<elastic_integer<12>, size>{}};
+            for (auto index{0}; index != size; ++index) {
+                values[index] = index * 63 - 4096;
+            }
+
+            auto elements{packed_array<elastic_integer<12>>(size)};
+            elements.pack(0, values);
+            auto unpacked{std::array<elastic_integer<12>, size>{}};
+            elements.unpack(0, unpacked);
+            return unpacked == values && std::as_const(elements)[65] == -1;
+        }());
+    }
+
+    TEST(packed_array, unpack_offset)  // NOLINT
+    {
+        auto const expected = test_values<elastic_integer<12>>(300);
+        auto elements{packed_array<elastic_integer<12>>(300)};
+        elements.pack(0, expected);
+
+        // a partial block, two whole blocks and a partial block
+        auto unpacked = std::vector<elastic_integer<12>>(200);
+        elements.unpack(33, unpacked);
+        ASSERT_TRUE(std::ranges::equal(std::span{expected}.subspan(33, 200), unpacked));
+    }
+
+    TEST(packed_array, pack_offset)  // NOLINT
+    {
+        auto const expected = test_values<u20>(300);
+        auto elements{packed_array<u20>(300)};
+        elements.pack(0, expected);
+
+        // overwriting the middle of the array leaves its neighbours untouched
+        auto const replacement = std::vector<u20>(200, 0xfffff);
+        elements.pack(21, replacement);
+        for (auto index{std::size_t{0}}; index != expected.size(); ++index) {
+            auto const expected_element{index >= 21 && index < 221 ? u20{0xfffff} : expected[index]};
+            ASSERT_EQ(expected_element, std::as_const(elements)[index]) << index;
+        }
+    }
+
+    TEST(packed_array, round_trip)  // NOLINT
+    {
+        test_round_trip<elastic_integer<1>>(1000);
+        test_round_trip<elastic_integer<3, unsigned>>(1000);
+        test_round_trip<elastic_integer<7>>(1001);
+        test_round_trip<elastic_integer<8, unsigned>>(1002);
+        test_round_trip<elastic_integer<12>>(1003);
+        test_round_trip<u20>(1004);
+        test_round_trip<elastic_integer<31>>(1005);
+        test_round_trip<elastic_integer<63>>(1006);
+        test_round_trip<elastic_integer<64, unsigned>>(1007);
+        test_round_trip<scaled_integer<elastic_integer<20>, power<-8>>>(1008);
+    }
+}
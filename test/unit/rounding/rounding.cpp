@@ -7,6 +7,8 @@
 #include <cnl/_impl/type_traits/identical.h>
 #include <cnl/rounding.h>
 
+#include <limits>
+
 namespace {
     using cnl::_impl::identical;
 
@@ -185,4 +187,115 @@ namespace {
                     cnl::_impl::operate<cnl::_impl::shift_right_op, cnl::tie_to_pos_inf_rounding_tag>{}(320, 7)));
         }
     }
+
+    namespace tie_to_even_rounding {
+
+        namespace convert {
+            static_assert(identical(
+                    std::uint8_t{100},
+                    cnl::convert<cnl::tie_to_even_rounding_tag, std::uint8_t>{}(100.5)));
+            static_assert(identical(
+                    std::int16_t{-1000},
+                    cnl::convert<cnl::tie_to_even_rounding_tag, std::int16_t>{}(-1000.5L)));
+            static_assert(identical(
+                    std::int16_t{-1002},
+                    cnl::convert<cnl::tie_to_even_rounding_tag, std::int16_t>{}(-1001.5L)));
+            static_assert(identical(
+                    55,
+                    cnl::convert<cnl::tie_to_even_rounding_tag, std::int32_t>{}(55.2F)));
+            static_assert(identical(
+                    -0,
+                    cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(-0.50)));
+            static_assert(identical(
+                    +0,
+                    cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(0.50)));
+            static_assert(identical(
+                    +1,
+                    cnl::convert<cnl::tie_to_even_rounding_tag, int>{}(0.51)));
+        }
+
+        namespace divide {
+            static_assert(identical(
+                    -1,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(-990, 661)));
+            static_assert(identical(
+                    2,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(-606, -404)));
+            static_assert(identical(
+                    1,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(8, 9)));
+            static_assert(identical(
+                    -1,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(9, -8)));
+            static_assert(identical(
+                    -2,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(-9, 6)));
+            static_assert(identical(
+                    -2,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(15, -6)));
+            static_assert(identical(
+                    1,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(-9, -7)));
+            static_assert(identical(
+                    2,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(
+                            std::uint16_t{999}, 666)));
+            static_assert(identical(
+                    2U,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(5U, 2U)));
+            static_assert(identical(
+                    1LL,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(998, 666LL)));
+
+            // the magnitude of the minimum divisor is not representable
+            constexpr auto min{std::numeric_limits<int>::min()};
+            static_assert(identical(
+                    1,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(min, min)));
+            static_assert(identical(
+                    0,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(min / 2, min)));
+            static_assert(identical(
+                    1,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(min / 4 * 3, min)));
+            static_assert(identical(
+                    0,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(-(min / 2), min)));
+            static_assert(identical(
+                    -1,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(-(min / 2) + 1, min)));
+            static_assert(identical(
+                    0,
+                    cnl::_impl::operate<cnl::_impl::divide_op, cnl::tie_to_even_rounding_tag>{}(5, min)));
+        }
+
+        namespace shift_right {
+            static_assert(identical(
+                    1 >> 1,
+                    cnl::_impl::operate<cnl::_impl::shift_right_op, cnl::tie_to_even_rounding_tag>{}(1, 1)));
+            static_assert(identical(
+                    191 >> 7,
+                    cnl::_impl::operate<cnl::_impl::shift_right_op, cnl::tie_to_even_rounding_tag>{}(191, 7)));
+            static_assert(identical(
+                    320 >> 7,
+                    cnl::_impl::operate<cnl::_impl::shift_right_op, cnl::tie_to_even_rounding_tag>{}(320, 7)));
+
+            // rounding division by a power of two, with a shift and a mask
+            static_assert(identical(1, cnl::_impl::tie_to_even_shift_right<7>(191)));
+            static_assert(identical(2, cnl::_impl::tie_to_even_shift_right<7>(320)));
+            static_assert(identical(3, cnl::_impl::tie_to_even_shift_right<7>(384)));
+            static_assert(identical(4, cnl::_impl::tie_to_even_shift_right<7>(448)));
+            static_assert(identical(-2, cnl::_impl::tie_to_even_shift_right<7>(-320)));
+            static_assert(identical(-2, cnl::_impl::tie_to_even_shift_right<7>(-192)));
+            static_assert(identical(
+                    std::numeric_limits<int>::max() / 2 + 1,
+                    cnl::_impl::tie_to_even_shift_right<1>(std::numeric_limits<int>::max())));
+            static_assert(identical(
+                    std::numeric_limits<int>::min() / 2,
+                    cnl::_impl::tie_to_even_shift_right<1>(std::numeric_limits<int>::min())));
+            static_assert(identical(
+                    2U,
+                    cnl::_impl::tie_to_even_shift_right<31>(std::numeric_limits<unsigned>::max())));
+        }
+    }
 }
@@ -0,0 +1,178 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace {
+    using cnl::_impl::identical;
+
+    using stochastic_integer = cnl::rounding_integer<int, cnl::stochastic_rounding_tag<>>;
+
+    template<int Exponent, typename Rep = std::int16_t>
+    using stochastic_scaled_integer = cnl::scaled_integer<
+            cnl::rounding_integer<Rep, cnl::stochastic_rounding_tag<>>, cnl::power<Exponent>>;
+
+    namespace test_is_rounding_tag {
+        static_assert(cnl::rounding_tag<cnl::stochastic_rounding_tag<>>);
+        static_assert(std::is_same_v<
+                      cnl::stochastic_rounding_tag<>, cnl::rounding_t<stochastic_integer>>);
+    }
+
+    namespace test_counter_hash_generator {
+        using generator = cnl::counter_hash_generator;
+
+        static_assert(generator{}(0, 0) != generator{}(0, 1));
+        static_assert(generator{}(0, 0) != generator{}(1, 0));
+        static_assert(generator{}(0, 0) != generator{}(std::uint64_t{1} << 32, 0));
+        static_assert(generator{}(42, 42) == generator{}(42, 42));
+    }
+
+    namespace test_constant_evaluated {
+        // without random numbers, values are rounded to nearest, with ties rounded down
+        static_assert(identical(stochastic_integer{3}, stochastic_integer{7} / stochastic_integer{2}));
+        static_assert(identical(stochastic_integer{-4}, stochastic_integer{-7} / stochastic_integer{2}));
+        static_assert(identical(stochastic_integer{2}, stochastic_integer{5} / stochastic_integer{3}));
+        static_assert(identical(stochastic_integer{2}, stochastic_integer{-5} / stochastic_integer{-3}));
+        static_assert(identical(
+                stochastic_integer{1},
+                stochastic_integer{std::numeric_limits<int>::min()} / stochastic_integer{std::numeric_limits<int>::min()}));
+        static_assert(identical(
+                stochastic_integer{1},
+                stochastic_integer{std::numeric_limits<int>::min() / 4 * 3}
+                        / stochastic_integer{std::numeric_limits<int>::min()}));
+        static_assert(identical(stochastic_integer{1}, stochastic_integer{0.75}));
+        static_assert(identical(stochastic_integer{-1}, stochastic_integer{-0.75}));
+        static_assert(identical(
+                stochastic_scaled_integer<-2>{1.25},
+                stochastic_scaled_integer<-2>{cnl::scaled_integer<int, cnl::power<-3>>{1.375}}));
+        static_assert(identical(
+                stochastic_scaled_integer<-2>{1.5},
+                stochastic_scaled_integer<-2>{cnl::scaled_integer<int, cnl::power<-3>>{1.5}}));
+    }
+
+    // the mean of many stochastically-rounded values is the precise value
+    template<typename Convert>
+    auto mean(Convert const& convert)
+    {
+        constexpr auto num_samples{100000};
+        auto sum{0.};
+        for (auto sample{0}; sample != num_samples; ++sample) {
+            sum += static_cast<double>(convert());
+        }
+        return sum / num_samples;
+    }
+
+    TEST(stochastic_rounding_tag, convert)  // NOLINT
+    {
+        cnl::seed_stochastic_rounding(1);
+        EXPECT_NEAR(.3, mean([] { return cnl::_impl::to_rep(stochastic_integer{.3}); }), .01);
+        EXPECT_NEAR(-2.7, mean([] { return cnl::_impl::to_rep(stochastic_integer{-2.7F}); }), .01);
+        EXPECT_NEAR(5., mean([] { return cnl::_impl::to_rep(stochastic_integer{5.}); }), 0.);
+    }
+
+    TEST(stochastic_rounding_tag, divide)  // NOLINT
+    {
+        cnl::seed_stochastic_rounding(2);
+        EXPECT_NEAR(1.75, mean([] { return cnl::_impl::to_rep(stochastic_integer{7} / stochastic_integer{4}); }), .01);
+        EXPECT_NEAR(-1.75, mean([] { return cnl::_impl::to_rep(stochastic_integer{-7} / stochastic_integer{4}); }), .01);
+        EXPECT_NEAR(-1.75, mean([] { return cnl::_impl::to_rep(stochastic_integer{7} / stochastic_integer{-4}); }), .01);
+        EXPECT_NEAR(.1, mean([] { return cnl::_impl::to_rep(stochastic_integer{1} / stochastic_integer{10}); }), .01);
+        EXPECT_NEAR(.25, mean([] {
+                        return cnl::_impl::to_rep(
+                                stochastic_integer{std::numeric_limits<int>::min() / 4}
+                                / stochastic_integer{std::numeric_limits<int>::min()});
+                    }),
+                    .01);
+    }
+
+    TEST(stochastic_rounding_tag, scale)  // NOLINT
+    {
+        cnl::seed_stochastic_rounding(3);
+        EXPECT_NEAR(-1.3, mean([] {
+                        return stochastic_scaled_integer<-2>{cnl::scaled_integer<int, cnl::power<-16>>{-1.3}};
+                    }),
+                    .01);
+        EXPECT_NEAR(0.01, mean([] { return stochastic_scaled_integer<-4>{0.01}; }), .001);
+    }
+
+    TEST(stochastic_rounding_tag, seed)  // NOLINT
+    {
+        auto const sample = [] {
+            auto result{std::array<stochastic_integer, 64>{}};
+            for (auto& element : result) {
+                element = stochastic_integer{.5};
+            }
+            return result;
+        };
+
+        cnl::seed_stochastic_rounding(4);
+        auto const first{sample()};
+        cnl::seed_stochastic_rounding(4);
+        ASSERT_EQ(first, sample());
+        cnl::seed_stochastic_rounding(5);
+        ASSERT_NE(first, sample());
+    }
+
+    template<typename Destination, typename Source>
+    void test_stochastic_round(std::vector<Source> const& from)
+    {
+        std::vector<Destination> expected(from.size());
+        cnl::seed_stochastic_rounding(6);
+        for (auto index{std::size_t{0}}; index != from.size(); ++index) {
+            expected[index] = Destination{from[index]};
+        }
+
+        std::vector<Destination> actual(from.size());
+        cnl::seed_stochastic_rounding(6);
+        cnl::stochastic_round(std::span<Source const>{from}, std::span<Destination>{actual});
+
+        for (auto index{std::size_t{0}}; index != from.size(); ++index) {
+            ASSERT_EQ(expected[index], actual[index]) << index;
+        }
+    }
+
+    template<typename Source>
+    auto make_inputs()
+    {
+        std::vector<Source> result(1001);
+        for (auto index{0}; index != static_cast<int>(result.size()); ++index) {
+            result[index] = static_cast<Source>((index - 500) * .0137);
+        }
+        return result;
+    }
+
+    TEST(stochastic_round, float_to_scaled_integer)  // NOLINT
+    {
+        test_stochastic_round<stochastic_scaled_integer<-8>>(make_inputs<float>());
+    }
+
+    TEST(stochastic_round, double_to_rounding_integer)  // NOLINT
+    {
+        test_stochastic_round<cnl::rounding_integer<std::int8_t, cnl::stochastic_rounding_tag<>>>(
+                make_inputs<double>());
+    }
+
+    TEST(stochastic_round, scaled_integer_to_scaled_integer)  // NOLINT
+    {
+        test_stochastic_round<stochastic_scaled_integer<-8>>(
+                make_inputs<cnl::scaled_integer<std::int32_t, cnl::power<-16>>>());
+    }
+
+    TEST(stochastic_round, widening)  // NOLINT
+    {
+        test_stochastic_round<stochastic_scaled_integer<-8, std::int32_t>>(
+                make_inputs<cnl::scaled_integer<std::int16_t, cnl::power<-4>>>());
+    }
+}
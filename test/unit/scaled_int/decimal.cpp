@@ -4,8 +4,12 @@
 //  (See accompanying file ../../LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cnl/_impl/radix_powers.h>
 #include <cnl/_impl/type_traits/identical.h>
 #include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <cstdint>
 
 template<typename Rep, int Exponent>
 using decimal_scaled_integer = cnl::scaled_integer<Rep, cnl::power<Exponent, 10>>;
@@ -109,3 +113,64 @@ namespace test_remainder {
                     decimal_scaled_integer<int, -3>{2} % decimal_scaled_integer<int, 0>{3},
                     decimal_scaled_integer<int, -3>{0.002}));
 }
+
+namespace test_radix_powers {
+    static_assert(identical(std::uint64_t{10'000'000'000'000'000'000U}, cnl::_impl::radix_powers<std::uint64_t, 10>[19]));
+    static_assert(20 == cnl::_impl::num_radix_powers<std::uint64_t, 10>);
+    static_assert(14 == cnl::_impl::num_radix_powers<std::uint32_t, 5>);
+#if defined(CNL_INT128_ENABLED)
+    static_assert(39 == cnl::_impl::num_radix_powers<cnl::uint128_t, 10>);
+#endif
+    static_assert(78 == cnl::_impl::num_radix_powers<cnl::wide_integer<256, unsigned>, 10>);
+    static_assert(
+            cnl::_impl::radix_powers<cnl::wide_integer<256, unsigned>, 10>[77]
+            == cnl::_impl::radix_powers<cnl::wide_integer<256, unsigned>, 10>[57]
+                       * cnl::_impl::radix_powers<std::uint64_t, 10>[19]
+                       * cnl::_impl::radix_powers<std::uint64_t, 10>[1]);
+
+    static_assert(identical(1'000'000'000, cnl::_impl::power_value<int, 9, 10>()));
+    static_assert(identical(1'000, cnl::_impl::power_value<short, 3, 10>()));
+    static_assert(identical(std::uint64_t{12157665459056928801U}, cnl::_impl::power_value<std::uint64_t, 40, 3>()));
+}
+
+namespace test_binary_conversion {
+    using binary64 = cnl::scaled_integer<std::int64_t, cnl::power<-32>>;
+
+    static_assert(identical(
+            binary64{1.5},
+            binary64{decimal_scaled_integer<std::int64_t, -6>{1.5}}));
+    static_assert(identical(
+            cnl::_impl::from_rep<binary64>(std::int64_t{4'294'967'296'000}),
+            binary64{cnl::_impl::from_rep<decimal_scaled_integer<std::int64_t, -6>>(std::int64_t{1'000'000'000})}));
+    static_assert(identical(
+            cnl::_impl::from_rep<binary64>(std::int64_t{-4294}),
+            binary64{cnl::_impl::from_rep<decimal_scaled_integer<std::int64_t, -6>>(std::int64_t{-1})}));
+    static_assert(identical(
+            cnl::_impl::from_rep<cnl::scaled_integer<int, cnl::power<-8>>>(31603),
+            cnl::scaled_integer<int, cnl::power<-8>>{decimal_scaled_integer<int, -2>{123.45}}));
+    static_assert(identical(
+            cnl::_impl::from_rep<cnl::scaled_integer<unsigned, cnl::power<4>>>(5U),
+            cnl::scaled_integer<unsigned, cnl::power<4>>{decimal_scaled_integer<unsigned, 1>{90}}));
+
+    // a rep narrower than 64 bits is scaled in 64 bits, so values are converted exactly
+    // although scaling them by the first radix overflows the rep
+    static_assert(identical(
+            cnl::_impl::from_rep<cnl::scaled_integer<int, cnl::power<-16>>>(65'536'000),
+            cnl::scaled_integer<int, cnl::power<-16>>{decimal_scaled_integer<int, -2>{1000}}));
+    static_assert(identical(
+            cnl::_impl::from_rep<cnl::scaled_integer<unsigned, cnl::power<-16>>>(2'621'440'000U),
+            cnl::scaled_integer<unsigned, cnl::power<-16>>{decimal_scaled_integer<unsigned, -3>{40000}}));
+    static_assert(identical(
+            decimal_scaled_integer<int, -4>{-30000},
+            decimal_scaled_integer<int, -4>{cnl::scaled_integer<int, cnl::power<-16>>{-30000}}));
+
+    static_assert(identical(
+            decimal_scaled_integer<std::int64_t, -6>{-1.5},
+            decimal_scaled_integer<std::int64_t, -6>{binary64{-1.5}}));
+    static_assert(identical(
+            cnl::_impl::from_rep<decimal_scaled_integer<std::int64_t, -6>>(std::int64_t{2'047'999'999}),
+            decimal_scaled_integer<std::int64_t, -6>{cnl::_impl::from_rep<binary64>(std::int64_t{8'796'093'022'207})}));
+    static_assert(identical(
+            decimal_scaled_integer<std::int64_t, -6>{0},
+            decimal_scaled_integer<std::int64_t, -6>{cnl::_impl::from_rep<binary64>(std::int64_t{-1})}));
+}
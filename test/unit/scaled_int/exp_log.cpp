@@ -0,0 +1,200 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of exp2, exp, log2, log and pow from <cnl/_impl/scaled_integer/math.h>
+
+#include <cnl/_impl/scaled_integer/math.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using cnl::power;
+using cnl::scaled_integer;
+using cnl::_impl::identical;
+
+namespace {
+    using s15_16 = scaled_integer<std::int32_t, power<-16>>;
+    using s3_28 = scaled_integer<std::int32_t, power<-28>>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // compile-time evaluation
+
+    static_assert(identical(s15_16{1}, cnl::exp2(s15_16{0})));
+    static_assert(identical(s15_16{8}, cnl::exp2(s15_16{3})));
+    static_assert(identical(s15_16{.5}, cnl::exp2(s15_16{-1})));
+    static_assert(identical(s15_16{3}, cnl::log2(s15_16{8})));
+    static_assert(identical(s15_16{-2}, cnl::log2(s15_16{.25})));
+    static_assert(identical(s15_16{0}, cnl::log(s15_16{1})));
+
+    // round(2^-0.25 * 2^28)
+    static_assert(identical(cnl::_impl::from_rep<s3_28>(225726413), cnl::exp2(s3_28{-.25})));
+
+    // round(e * 2^16)
+    static_assert(identical(cnl::_impl::from_rep<s15_16>(178145), cnl::exp(s15_16{1})));
+
+    // round(e^-2.5 * 2^28)
+    static_assert(identical(cnl::_impl::from_rep<s3_28>(22034524), cnl::exp(s3_28{-2.5})));
+
+    // round(log2(10) * 2^16)
+    static_assert(identical(cnl::_impl::from_rep<s15_16>(217706), cnl::log2(s15_16{10})));
+
+    // round(ln(0.75) * 2^28)
+    static_assert(identical(cnl::_impl::from_rep<s3_28>(-77224068), cnl::log(s3_28{.75})));
+
+    // round(sqrt(2) * 2^16)
+    static_assert(identical(cnl::_impl::from_rep<s15_16>(92682), cnl::pow(s15_16{2}, s15_16{.5})));
+    static_assert(identical(s15_16{0}, cnl::pow(s15_16{0}, s15_16{3})));
+
+    // integer results
+    static_assert(identical(scaled_integer<int>{10}, cnl::log2(scaled_integer<int>{1000})));
+    static_assert(identical(scaled_integer<int>{1024}, cnl::exp2(scaled_integer<int>{10})));
+    static_assert(identical(scaled_integer<int>{0}, cnl::exp2(scaled_integer<int>{-2})));
+
+    // sequences
+    static_assert([]() {
+        auto const x{std::array<s15_16, 10>{-1., 0., 1., 2., 3., 4., 5., 6., 7., -2.}};
+        auto result{std::array<s15_16, 10>{}};
+        cnl::exp2(std::span<s15_16 const>{x}, std::span<s15_16>{result});
+        return result == std::array<s15_16, 10>{.5, 1., 2., 4., 8., 16., 32., 64., 128., .25};
+    }());
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison with long double
+
+    // checks that f(x) is within one ULP of reference(x) for values of x throughout [first, last)
+    // wherever reference(x) is representable
+    template<typename Number, typename Function, typename Reference>
+    void test_against_long_double(
+            Function const& f, Reference const& reference, long double first, long double last)
+    {
+        constexpr auto num_samples{20000};
+        constexpr auto exponent{cnl::_impl::tag_of_t<Number>::exponent};
+        auto const ulp{std::ldexp(1.L, exponent)};
+        auto const max{static_cast<long double>(std::numeric_limits<Number>::max())};
+        auto const lowest{static_cast<long double>(std::numeric_limits<Number>::lowest())};
+        for (auto i{0}; i < num_samples; ++i) {
+            auto const x{Number{first + (last - first) * i / num_samples}};
+            auto const expected{reference(static_cast<long double>(x))};
+            if (expected >= max || expected <= lowest) {
+                continue;
+            }
+            auto const actual{static_cast<long double>(f(x))};
+            ASSERT_LE(std::fabs(actual - expected), ulp) << static_cast<long double>(x);
+        }
+    }
+
+    template<typename Number>
+    void test_exp_log_against_long_double(long double first, long double last)
+    {
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::exp2(x); }, [](long double x) { return std::exp2(x); }, first,
+                last);
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::exp(x); }, [](long double x) { return std::exp(x); }, first,
+                last);
+
+        auto const positive_first{std::max(first, static_cast<long double>(std::numeric_limits<Number>::min()))};
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::log2(x); }, [](long double x) { return std::log2(x); },
+                positive_first, last);
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::log(x); }, [](long double x) { return std::log(x); },
+                positive_first, last);
+
+        auto const y{Number{.75}};
+        test_against_long_double<Number>(
+                [y](Number const& x) { return cnl::pow(x, y); },
+                [y](long double x) { return std::pow(x, static_cast<long double>(y)); }, positive_first, last);
+        if constexpr (std::numeric_limits<Number>::is_signed) {
+            test_against_long_double<Number>(
+                    [](Number const& x) { return cnl::pow(x, Number{-1.5}); },
+                    [](long double x) { return std::pow(x, -1.5L); }, positive_first, last);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sequences
+
+    // checks that exp2 of a sequence gives exactly the results of exp2 of each element
+    template<typename Number>
+    void test_exp2_span(long double first, long double last)
+    {
+        constexpr auto num_samples{1000};
+        std::vector<Number> x(num_samples);
+        for (auto i{0}; i != num_samples; ++i) {
+            x[i] = Number{first + (last - first) * i / num_samples};
+        }
+
+        std::vector<Number> result(num_samples);
+        cnl::exp2(std::span<Number const>{x}, std::span<Number>{result});
+        for (auto i{0}; i != num_samples; ++i) {
+            ASSERT_EQ(cnl::_impl::to_rep(cnl::exp2(x[i])), cnl::_impl::to_rep(result[i]))
+                    << static_cast<long double>(x[i]);
+        }
+
+        // in place
+        cnl::exp2(std::span<Number const>{x}, std::span<Number>{x});
+        ASSERT_EQ(result, x);
+    }
+
+    TEST(scaled_integer_exp_log, exp2_span)  // NOLINT
+    {
+        test_exp2_span<scaled_integer<std::int16_t, power<-8>>>(-20.L, 7.L);
+        test_exp2_span<scaled_integer<std::uint16_t, power<-8>>>(0.L, 8.L);
+        test_exp2_span<s15_16>(-20.L, 15.L);
+        test_exp2_span<s3_28>(-8.L, 1.9L);
+        test_exp2_span<scaled_integer<std::int64_t, power<-32>>>(-40.L, 30.L);
+        test_exp2_span<scaled_integer<std::int32_t, power<4>>>(-64.L, 30.L);
+        test_exp2_span<scaled_integer<std::int32_t, power<-16, 10>>>(-3.L, 3.L);
+    }
+
+    TEST(scaled_integer_exp_log, s3_4)  // NOLINT
+    {
+        test_exp_log_against_long_double<scaled_integer<std::int8_t, power<-4>>>(-8.L, 7.9L);
+    }
+
+    TEST(scaled_integer_exp_log, s7_8)  // NOLINT
+    {
+        test_exp_log_against_long_double<scaled_integer<std::int16_t, power<-8>>>(-100.L, 127.L);
+    }
+
+    TEST(scaled_integer_exp_log, u8_8)  // NOLINT
+    {
+        test_exp_log_against_long_double<scaled_integer<std::uint16_t, power<-8>>>(0.L, 255.L);
+    }
+
+    TEST(scaled_integer_exp_log, s15_16)  // NOLINT
+    {
+        test_exp_log_against_long_double<s15_16>(-30000.L, 30000.L);
+    }
+
+    TEST(scaled_integer_exp_log, s3_28)  // NOLINT
+    {
+        test_exp_log_against_long_double<s3_28>(-8.L, 7.9L);
+    }
+
+    TEST(scaled_integer_exp_log, s31_32)  // NOLINT
+    {
+        // results have no more than 56 significant digits
+        test_exp_log_against_long_double<scaled_integer<std::int64_t, power<-32>>>(-40.L, 16.L);
+    }
+
+    TEST(scaled_integer_exp_log, s27_4)  // NOLINT
+    {
+        test_exp_log_against_long_double<scaled_integer<std::int32_t, power<4>>>(16.L, 2e9L);
+    }
+}
@@ -9,6 +9,9 @@
 
 #include <gtest/gtest.h>
 
+#include <span>
+#include <vector>
+
 using cnl::power;
 using cnl::scaled_integer;
 using cnl::_impl::identical;
@@ -16,20 +19,22 @@ using cnl::_impl::identical;
 TEST(utils_tests, sin)  // NOLINT
 {
     ASSERT_EQ(sin(scaled_integer<std::uint8_t, power<-6>>(0)), 0);
-    ASSERT_EQ(sin(scaled_integer<std::int16_t, power<-13>>(3.1415926)), 0.F);
+    // sin(3.14147949...) is nearer to 2^-13 than to 0
+    ASSERT_EQ(sin(scaled_integer<std::int16_t, power<-13>>(3.1415926)), 1.F / 8192);
     ASSERT_EQ(sin(scaled_integer<std::uint16_t, power<-14>>(3.1415926 / 2)), 1);
     ASSERT_EQ(sin(scaled_integer<std::int32_t, power<-24>>(3.1415926 * 7. / 2.)), -1);
     ASSERT_EQ(sin(scaled_integer<std::int32_t, power<-28>>(3.1415926 / 4)), .707106769F);
-    ASSERT_EQ(sin(scaled_integer<std::int16_t, power<-10>>(-3.1415926 / 3)), -.865234375);
+    ASSERT_EQ(sin(scaled_integer<std::int16_t, power<-10>>(-3.1415926 / 3)), -887. / 1024);
 }
 
 TEST(utils_tests, cos)  // NOLINT
 {
     ASSERT_EQ(cos(scaled_integer<std::uint8_t, power<-6>>(0)), 1.F);
     ASSERT_EQ(cos(scaled_integer<std::int16_t, power<-13>>(3.1415926)), -1);
-    ASSERT_EQ(cos(scaled_integer<std::uint16_t, power<-14>>(3.1415926 / 2)), 0.L);
+    // cos(1.57073974...) is nearer to 2^-14 than to 0
+    ASSERT_EQ(cos(scaled_integer<std::uint16_t, power<-14>>(3.1415926 / 2)), 1.L / 16384);
     ASSERT_EQ(cos(scaled_integer<std::int32_t, power<-20>>(3.1415926 * 7. / 2.)), 0.F);
-    ASSERT_EQ(cos(scaled_integer<std::int32_t, power<-28>>(3.1415926 / 4)), .707106829F);
+    ASSERT_EQ(cos(scaled_integer<std::int32_t, power<-28>>(3.1415926 / 4)), 189812534. / (1 << 28));
     ASSERT_EQ(cos(scaled_integer<std::int16_t, power<-10>>(-3.1415926 / 3)), .5L);
 }
 
@@ -66,6 +71,23 @@ static_assert(identical(
         scaled_integer<std::int32_t, power<-10>>{2.0},
         sqrt(scaled_integer<std::int32_t, power<-20>>(4.0))));
 
+TEST(utils_tests, sqrt_span)  // NOLINT
+{
+    using operand = scaled_integer<std::int32_t, power<-20>>;
+    using result = scaled_integer<std::int32_t, power<-10>>;
+
+    std::vector<operand> x(1000);
+    for (auto i{0}; i != int(x.size()); ++i) {
+        x[i] = operand{i * 1.7};
+    }
+
+    std::vector<result> roots(x.size());
+    sqrt(std::span<operand const>{x}, std::span<result>{roots});
+    for (auto i{0}; i != int(x.size()); ++i) {
+        ASSERT_TRUE(identical(sqrt(x[i]), roots[i])) << i;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // cnl::floor
 
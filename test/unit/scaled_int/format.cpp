@@ -0,0 +1,220 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::format_to and streaming of cnl::scaled_integer
+
+#include <cnl/_impl/scaled_integer/format.h>
+
+#include <cnl/elastic_integer.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+using cnl::power;
+using cnl::scaled_integer;
+
+namespace {
+    using s24_7 = scaled_integer<std::int32_t, power<-7>>;
+    using s15_16 = scaled_integer<std::int32_t, power<-16>>;
+
+    static_assert([]() {
+        auto const spec{cnl::parse_format_spec("*^+#012.3e")};
+        return spec.ec == std::errc{} && spec.spec.fill == '*' && spec.spec.align == cnl::format_align::center
+            && spec.spec.sign == cnl::format_sign::plus && spec.spec.alternate && spec.spec.zero_pad
+            && spec.spec.width == 12 && spec.spec.precision == 3 && spec.spec.type == 'e';
+    }());
+    static_assert(cnl::parse_format_spec(">8}").ptr == std::string_view{">8}"}.begin() + 2);
+    static_assert(cnl::parse_format_spec(".f").ec == std::errc::invalid_argument);
+    static_assert(cnl::parse_format_spec("8d").ec == std::errc::invalid_argument);
+    static_assert(cnl::parse_format_spec("L").ec == std::errc::invalid_argument);
+
+    static_assert([]() {
+        auto chars{std::array<char, 8>{}};
+        auto const* const last{cnl::format_to(chars.data(), ".2f", s24_7{-2.5})};
+        return std::string_view(chars.data(), last - chars.data()) == "-2.50";
+    }());
+
+    TEST(format, exact)  // NOLINT
+    {
+        ASSERT_EQ("-1.0078125", cnl::format("", s24_7{-1.0078125}));
+        ASSERT_EQ("0", cnl::format("", s24_7{0}));
+        ASSERT_EQ("3", cnl::format("", s24_7{3}));
+        ASSERT_EQ("0.0000152587890625", cnl::format("", std::numeric_limits<s15_16>::min()));
+        ASSERT_EQ("-32768", cnl::format("", std::numeric_limits<s15_16>::lowest()));
+        ASSERT_EQ(
+                "0.9999999999999999999457898913757247782996273599565029144287109375",
+                cnl::format("", std::numeric_limits<scaled_integer<std::uint64_t, power<-64>>>::max()));
+        ASSERT_EQ("-1073741824", cnl::format("", scaled_integer<std::int8_t, power<24>>{-64 << 24}));
+    }
+
+    TEST(format, fixed)  // NOLINT
+    {
+        ASSERT_EQ("-1.007812", cnl::format("f", s24_7{-1.0078125}));
+        ASSERT_EQ("-1.01", cnl::format(".2f", s24_7{-1.0078125}));
+        ASSERT_EQ("-1.0078125000", cnl::format(".10F", s24_7{-1.0078125}));
+
+        // ties are rounded to even
+        ASSERT_EQ("2", cnl::format(".0f", s24_7{2.5}));
+        ASSERT_EQ("4", cnl::format(".0f", s24_7{3.5}));
+        ASSERT_EQ("0.12", cnl::format(".2f", s24_7{.125}));
+        ASSERT_EQ("0.13", cnl::format(".2f", s24_7{.1328125}));
+        ASSERT_EQ("10.0", cnl::format(".1f", s24_7{9.96875}));
+        ASSERT_EQ("3.", cnl::format("#.0f", s24_7{3}));
+    }
+
+    TEST(format, scientific)  // NOLINT
+    {
+        ASSERT_EQ("-1.007812e+00", cnl::format("e", s24_7{-1.0078125}));
+        ASSERT_EQ("3.91E-02", cnl::format(".2E", s24_7{.0390625}));
+        ASSERT_EQ("1.0e+03", cnl::format(".1e", s24_7{999}));
+        ASSERT_EQ("0.000e+00", cnl::format(".3e", s24_7{0}));
+        ASSERT_EQ("1e+100", cnl::format(".0e", cnl::_impl::from_rep<scaled_integer<std::int8_t, power<100, 10>>>(1)));
+    }
+
+    TEST(format, hexadecimal)  // NOLINT
+    {
+        ASSERT_EQ("-1.02p+0", cnl::format("a", s24_7{-1.0078125}));
+        ASSERT_EQ("1.8P+1", cnl::format("A", s24_7{3}));
+        ASSERT_EQ("1p-16", cnl::format("a", std::numeric_limits<s15_16>::min()));
+        ASSERT_EQ("1.0p+0", cnl::format(".1a", s24_7{1.0078125}));
+        ASSERT_EQ("1.0p+1", cnl::format(".1a", s24_7{1.9921875}));
+        ASSERT_EQ("0p+0", cnl::format("a", s24_7{0}));
+        ASSERT_EQ("1p+4", cnl::format("a", scaled_integer<int, power<1, 16>>{16}));
+    }
+
+    TEST(format, padding)  // NOLINT
+    {
+        ASSERT_EQ("   -1.5", cnl::format("7", s24_7{-1.5}));
+        ASSERT_EQ("-1.5   ", cnl::format("<7", s24_7{-1.5}));
+        ASSERT_EQ("*-1.5**", cnl::format("*^7", s24_7{-1.5}));
+        ASSERT_EQ("-0001.5", cnl::format("07", s24_7{-1.5}));
+        ASSERT_EQ("+1.5", cnl::format("+", s24_7{1.5}));
+        ASSERT_EQ(" 1.5", cnl::format(" ", s24_7{1.5}));
+        ASSERT_EQ("-1.5", cnl::format(" ", s24_7{-1.5}));
+        ASSERT_EQ("-1.5", cnl::format("2", s24_7{-1.5}));
+    }
+
+    TEST(format, radix)  // NOLINT
+    {
+        using euros = scaled_integer<int, power<-1, 100>>;
+        ASSERT_EQ("0.6", cnl::format("", euros{.6}));
+        ASSERT_EQ("-12.34", cnl::format("", euros{-12.34}));
+        ASSERT_EQ("5000", cnl::format("", scaled_integer<int, power<3, 10>>{5000}));
+        ASSERT_EQ("0.0625", cnl::format("", scaled_integer<int, power<-1, 16>>{.0625}));
+    }
+
+    TEST(format, wide)  // NOLINT
+    {
+#if defined(CNL_INT128_ENABLED)
+        using number = scaled_integer<cnl::elastic_integer<100>, power<-90>>;
+        ASSERT_EQ(
+                "-0.299999999999999988897769753748434595763683319091796875",
+                cnl::format("", number{-.3}));
+        ASSERT_EQ("-3.0000e-01", cnl::format(".4e", number{-.3}));
+#endif
+
+        using wide = scaled_integer<cnl::wide_integer<100>, power<-8>>;
+        auto const rep{(cnl::wide_integer<100>{1} << 90) + 1};
+        ASSERT_EQ("-4835703278458516698824704.00390625", cnl::format("", cnl::_impl::from_rep<wide>(-rep)));
+    }
+
+#if defined(CNL_IOSTREAMS_ENABLED)
+    TEST(format, ostream)  // NOLINT
+    {
+        std::ostringstream out;
+        out << s24_7{-1.0078125} << '|';
+        out.width(8);
+        out.fill('_');
+        out << s24_7{1.5} << '|';
+        out.setf(std::ios_base::fixed, std::ios_base::floatfield);
+        out.precision(3);
+        out << s24_7{-1.0078125} << '|';
+        out.setf(std::ios_base::scientific, std::ios_base::floatfield);
+        out.setf(std::ios_base::uppercase);
+        out << s24_7{-1.0078125} << '|';
+        out.setf(std::ios_base::fixed | std::ios_base::scientific, std::ios_base::floatfield);
+        out << s24_7{3} << '|';
+        out.unsetf(std::ios_base::floatfield | std::ios_base::uppercase);
+        out.setf(std::ios_base::showpos | std::ios_base::left);
+        out.width(6);
+        out << s24_7{.5};
+        ASSERT_EQ("-1.0078125|_____1.5|-1.008|-1.008E+00|1.8P+1|+.5___", out.str());
+    }
+
+    TEST(format, istream)  // NOLINT
+    {
+        std::istringstream in(" -12.375 +0003.00000000000000000000000000000000001 4294967296 -.5x");
+        auto a{s15_16{}};
+        auto b{s15_16{}};
+        in >> a >> b;
+        ASSERT_TRUE(in);
+        ASSERT_EQ(-12.375, a);
+        ASSERT_EQ(3, b);
+
+        // out of range
+        in >> a;
+        ASSERT_TRUE(in.fail());
+        ASSERT_EQ(-12.375, a);
+        in.clear();
+
+        auto c{scaled_integer<std::int8_t, power<-1>>{}};
+        in >> c;
+        ASSERT_TRUE(in);
+        ASSERT_EQ(-.5, c);
+        ASSERT_EQ('x', in.get());
+    }
+
+    TEST(format, istream_zero)  // NOLINT
+    {
+        std::istringstream in("0 -0 00 00.5");
+        auto a{scaled_integer<int, power<-8>>{1}};
+        auto b{scaled_integer<int, power<-8>>{1}};
+        auto c{scaled_integer<int, power<-8>>{1}};
+        auto d{scaled_integer<int, power<-8>>{1}};
+        in >> a >> b >> c >> d;
+        ASSERT_TRUE(in.eof());
+        ASSERT_FALSE(in.fail());
+        ASSERT_EQ(0, a);
+        ASSERT_EQ(0, b);
+        ASSERT_EQ(0, c);
+        ASSERT_EQ(.5, d);
+    }
+
+    TEST(format, istream_rounding)  // NOLINT
+    {
+        // exactly halfway between two values, and just beyond halfway
+        std::istringstream in("0.000003814697265625 0.0000038146972656250000000000000000000000000000001");
+        auto a{scaled_integer<std::int32_t, power<-17>>{}};
+        auto b{scaled_integer<std::int32_t, power<-17>>{}};
+        in >> a >> b;
+        ASSERT_TRUE(in.eof());
+        ASSERT_EQ(0, a);
+        ASSERT_EQ(std::numeric_limits<decltype(b)>::min(), b);
+    }
+
+    TEST(format, stream_round_trip)  // NOLINT
+    {
+        for (auto rep{std::numeric_limits<std::int32_t>::min()}; rep < std::numeric_limits<std::int32_t>::max() - 99999999;
+             rep += 99999999) {
+            auto const expected{cnl::_impl::from_rep<s15_16>(rep)};
+            std::stringstream stream;
+            stream << cnl::format("", expected);
+            auto actual{s15_16{}};
+            stream >> actual;
+            ASSERT_EQ(expected, actual) << stream.str();
+        }
+    }
+#endif
+}
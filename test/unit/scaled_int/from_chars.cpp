@@ -0,0 +1,212 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::from_chars overloaded on cnl::scaled_integer
+
+#include <cnl/_impl/scaled_integer/from_chars.h>
+
+#include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+using cnl::power;
+using cnl::scaled_integer;
+
+namespace {
+    using s7_8 = scaled_integer<std::int16_t, power<-8>>;
+    using u8_8 = scaled_integer<std::uint16_t, power<-8>>;
+    using s15_16 = scaled_integer<std::int32_t, power<-16>>;
+    using s3_28 = scaled_integer<std::int32_t, power<-28>>;
+    using s31_32 = scaled_integer<std::int64_t, power<-32>>;
+    using s0_7 = scaled_integer<std::int8_t, power<-7>>;
+    using s27_4 = scaled_integer<std::int32_t, power<4>>;
+
+    // the value of chars if they are parsed successfully in their entirety
+    template<typename Number>
+    constexpr auto parse(std::string_view chars, int base = 10) -> std::optional<Number>
+    {
+        auto value{Number{}};
+        auto const result{cnl::from_chars(chars.data(), chars.data() + chars.size(), value, base)};
+        if (result.ec != std::errc{} || result.ptr != chars.data() + chars.size()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    // the error and the number of characters consumed when parsing chars
+    template<typename Number>
+    auto parse_error(std::string_view chars, int base = 10)
+    {
+        auto value{Number{7}};
+        auto const result{cnl::from_chars(chars.data(), chars.data() + chars.size(), value, base)};
+        EXPECT_EQ(Number{7}, value) << chars;
+        return std::pair{result.ec, result.ptr - chars.data()};
+    }
+
+    // the exact decimal representation of the fixed-point value, rep * 2^-FractionDigits
+    template<int FractionDigits>
+    auto exact_decimal(std::int64_t rep)
+    {
+        static_assert(FractionDigits >= 0 && FractionDigits < 60);
+        auto const magnitude{static_cast<std::uint64_t>(rep < 0 ? -rep : rep)};
+        auto chars{std::string{(rep < 0) ? "-" : ""} + std::to_string(magnitude >> FractionDigits)};
+        if constexpr (FractionDigits != 0) {
+            constexpr auto mask{(std::uint64_t{1} << FractionDigits) - 1};
+            chars += '.';
+            auto fraction{magnitude & mask};
+            for (auto digit{0}; digit != FractionDigits; ++digit) {
+                fraction *= 10;
+                chars += static_cast<char>('0' + (fraction >> FractionDigits));
+                fraction &= mask;
+            }
+        }
+        return chars;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // compile-time evaluation
+
+    static_assert(s15_16{12.375} == parse<s15_16>("12.375"));
+    static_assert(s15_16{-12.375} == parse<s15_16>("-12.375"));
+    static_assert(s15_16{.5} == parse<s15_16>(".5"));
+    static_assert(s15_16{3} == parse<s15_16>("3."));
+    static_assert(s15_16{-1.5} == parse<s15_16>("-1.1", 2));
+    static_assert(s15_16{7.5} == parse<s15_16>("7.4", 8));
+    static_assert(s15_16{-15.5} == parse<s15_16>("-F.8", 16));
+    static_assert(u8_8{255.99609375} == parse<u8_8>("255.99609375"));
+    static_assert(s7_8{-128} == parse<s7_8>("-128"));
+    static_assert(s27_4{48} == parse<s27_4>("40.1"));
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // exactness
+
+    // every value produced from its exact decimal representation
+    template<typename Number>
+    void test_round_trip(std::int64_t first, std::int64_t last, std::int64_t step)
+    {
+        constexpr auto fraction_digits{-cnl::_impl::tag_of_t<Number>::exponent};
+        for (auto rep{first}; rep < last; rep += step) {
+            auto const expected{cnl::_impl::from_rep<Number>(static_cast<cnl::_impl::rep_of_t<Number>>(rep))};
+            auto const chars{exact_decimal<fraction_digits>(rep)};
+            ASSERT_EQ(expected, parse<Number>(chars)) << chars;
+        }
+    }
+
+    TEST(scaled_integer_from_chars, round_trip)  // NOLINT
+    {
+        test_round_trip<s0_7>(-128, 128, 1);
+        test_round_trip<s7_8>(-32768, 32768, 1);
+        test_round_trip<u8_8>(0, 65536, 1);
+        test_round_trip<s15_16>(std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max(), 65521);
+        test_round_trip<s3_28>(std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max(), 65521);
+        test_round_trip<s31_32>(
+                std::numeric_limits<std::int64_t>::min() + 1, std::numeric_limits<std::int64_t>::max() - 0x3fffffffffffLL,
+                0x3fffffffffffLL);
+    }
+
+    // values halfway between, just above and just below pairs of adjacent results
+    template<typename Number>
+    void test_ties(std::int64_t first, std::int64_t last, std::int64_t step)
+    {
+        constexpr auto fraction_digits{-cnl::_impl::tag_of_t<Number>::exponent};
+        auto const from_rep{[](std::int64_t rep) {
+            return cnl::_impl::from_rep<Number>(static_cast<cnl::_impl::rep_of_t<Number>>(rep));
+        }};
+        for (auto rep{first}; rep < last; rep += step) {
+            auto const tie{exact_decimal<fraction_digits + 1>(rep * 2 + 1)};
+            auto const even{(rep & 1) ? rep + 1 : rep};
+            ASSERT_EQ(from_rep(even), parse<Number>(tie)) << tie;
+
+            auto const toward_zero{rep < 0 ? rep + 1 : rep};
+            auto const away_from_zero{rep < 0 ? rep : rep + 1};
+            auto const above{tie + "00000000000000000000000000000001"};
+            ASSERT_EQ(from_rep(away_from_zero), parse<Number>(above)) << above;
+
+            // the last digit of every tie is a five
+            auto below{tie};
+            below.back() = '4';
+            below += "99999999999999999999999999999999";
+            ASSERT_EQ(from_rep(toward_zero), parse<Number>(below)) << below;
+        }
+    }
+
+    TEST(scaled_integer_from_chars, ties)  // NOLINT
+    {
+        test_ties<s7_8>(-32768, 32767, 1);
+        test_ties<s15_16>(-2147483647, 2147483646, 65521);
+        test_ties<s31_32>(-0x3fffffffffffffffLL, 0x3ffffffffffffffeLL, 0x3fffffffffffLL);
+        ASSERT_EQ(cnl::_impl::from_rep<s15_16>(0), parse<s15_16>("0.00008", 16));
+        ASSERT_EQ(cnl::_impl::from_rep<s15_16>(2), parse<s15_16>("0.00018", 16));
+        ASSERT_EQ(cnl::_impl::from_rep<s15_16>(1), parse<s15_16>("0.000080000001", 16));
+        ASSERT_EQ(cnl::_impl::from_rep<s15_16>(-2), parse<s15_16>("-0.00000000000000011", 2));
+        ASSERT_EQ(s27_4{32}, parse<s27_4>("24"));
+        ASSERT_EQ(s27_4{32}, parse<s27_4>("40"));
+        ASSERT_EQ(s27_4{48}, parse<s27_4>("40.00000000001"));
+        ASSERT_EQ(s27_4{-32}, parse<s27_4>("-39.999"));
+    }
+
+    TEST(scaled_integer_from_chars, wide_integer)  // NOLINT
+    {
+        using wide = scaled_integer<cnl::wide_integer<120>, power<-100>>;
+        ASSERT_EQ(wide{-1.5}, parse<wide>("-1.5"));
+        ASSERT_EQ(
+                cnl::_impl::from_rep<wide>(cnl::wide_integer<120>{1}),
+                parse<wide>("0."
+                            "000000000000000000000000000000788860905221011805411728565282"
+                            "7862296732064351090230047702789306640625"));
+        ASSERT_EQ(
+                cnl::_impl::from_rep<wide>(cnl::wide_integer<120>{0}),
+                parse<wide>("0."
+                            "000000000000000000000000000000394430452610505902705864282641"
+                            "39311483660321755451150238513946533203125"));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // errors
+
+    TEST(scaled_integer_from_chars, invalid_argument)  // NOLINT
+    {
+        using pair = std::pair<std::errc, std::ptrdiff_t>;
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<s15_16>(""));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<s15_16>("."));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<s15_16>("-"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<s15_16>("-."));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<s15_16>("+1"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<s15_16>("nan"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<u8_8>("-1"));
+        ASSERT_EQ((pair{std::errc::invalid_argument, 0}), parse_error<s15_16>("2", 2));
+    }
+
+    TEST(scaled_integer_from_chars, result_out_of_range)  // NOLINT
+    {
+        using pair = std::pair<std::errc, std::ptrdiff_t>;
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 5}), parse_error<s0_7>("0.999"));
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 3}), parse_error<s7_8>("128"));
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 12}), parse_error<s7_8>("-128.0019532"));
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 5}), parse_error<u8_8>("256.0e3"));
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 30}), parse_error<s15_16>("100000000000000000000000000.25"));
+        ASSERT_EQ((pair{std::errc::result_out_of_range, 11}), parse_error<s27_4>("34359738360"));
+    }
+
+    TEST(scaled_integer_from_chars, partial)  // NOLINT
+    {
+        auto const chars{std::string_view{"-1.25e3,"}};
+        auto value{s15_16{}};
+        auto const result{cnl::from_chars(chars.data(), chars.data() + chars.size(), value)};
+        ASSERT_EQ(std::errc{}, result.ec);
+        ASSERT_EQ(chars.data() + 5, result.ptr);
+        ASSERT_EQ(s15_16{-1.25}, value);
+    }
+}
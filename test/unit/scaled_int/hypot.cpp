@@ -0,0 +1,100 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/scaled_integer/hypot.h>
+
+#include <cnl/_impl/scaled_integer/hypot.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+using cnl::power;
+using cnl::scaled_integer;
+using cnl::_impl::identical;
+
+namespace {
+    static_assert(identical(
+            scaled_integer<int, power<-4>>{5},
+            cnl::hypot(scaled_integer<int, power<-4>>{3}, scaled_integer<int, power<-4>>{-4})));
+    static_assert(identical(
+            scaled_integer<std::uint8_t, power<-4>>{1.4375},
+            cnl::hypot(scaled_integer<std::uint8_t, power<-4>>{1}, scaled_integer<std::uint8_t, power<-4>>{1})));
+    static_assert(identical(
+            scaled_integer<std::int64_t>{INT64_C(3037000500)},
+            cnl::hypot(scaled_integer<std::int64_t>{INT64_C(3037000499)}, scaled_integer<std::int64_t>{77935})));
+    static_assert(identical(
+            scaled_integer<std::uint64_t>{UINT64_C(0xFFFFFFFFFFFFFFFF)},
+            cnl::hypot(
+                    scaled_integer<std::uint64_t>{UINT64_C(0xFFFFFFFFFFFFFFFF)},
+                    scaled_integer<std::uint64_t>{1})));
+
+    // checks that the rep of the result, r, satisfies (2r - 1)^2 <= 4(x^2 + y^2) <= (2r + 1)^2
+    template<typename Rep>
+    void test_rounded_root(int num_samples)
+    {
+        using number = scaled_integer<Rep, power<-8>>;
+        using wide = cnl::wide_integer<140, unsigned>;
+
+        auto state{UINT64_C(0x0123456789ABCDEF)};
+        auto const random = [&state]() {
+            state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+            return state;
+        };
+
+        for (auto i{0}; i < num_samples; ++i) {
+            auto const x_rep{static_cast<Rep>(random() >> (i % 64))};
+            auto const y_rep{static_cast<Rep>(random() >> ((i * 7) % 64))};
+
+            auto const magnitude = [](Rep const& rep) {
+                return wide{cnl::_impl::fp::magnitude(rep)};
+            };
+            auto const quadruple_sum_of_squares{
+                    wide{4} * (magnitude(x_rep) * magnitude(x_rep) + magnitude(y_rep) * magnitude(y_rep))};
+            auto const max_root{wide{static_cast<std::uint64_t>(std::numeric_limits<Rep>::max())}};
+            if ((max_root * wide{2} + wide{1}) * (max_root * wide{2} + wide{1}) < quadruple_sum_of_squares) {
+                continue;
+            }
+
+            auto const root{wide{static_cast<std::uint64_t>(cnl::_impl::to_rep(cnl::hypot(
+                    cnl::_impl::from_rep<number>(x_rep), cnl::_impl::from_rep<number>(y_rep))))}};
+            auto const lower_bound{root * wide{2} - wide{1}};
+            auto const upper_bound{root * wide{2} + wide{1}};
+            ASSERT_TRUE(root == wide{0} || lower_bound * lower_bound <= quadruple_sum_of_squares) << i;
+            ASSERT_TRUE(quadruple_sum_of_squares <= upper_bound * upper_bound) << i;
+        }
+    }
+
+    TEST(scaled_integer_hypot, int16)  // NOLINT
+    {
+        test_rounded_root<std::int16_t>(10000);
+    }
+
+    TEST(scaled_integer_hypot, int32)  // NOLINT
+    {
+        test_rounded_root<std::int32_t>(100000);
+    }
+
+    TEST(scaled_integer_hypot, uint32)  // NOLINT
+    {
+        test_rounded_root<std::uint32_t>(100000);
+    }
+
+    TEST(scaled_integer_hypot, int64)  // NOLINT
+    {
+        test_rounded_root<std::int64_t>(100000);
+    }
+
+    TEST(scaled_integer_hypot, uint64)  // NOLINT
+    {
+        test_rounded_root<std::uint64_t>(100000);
+    }
+}
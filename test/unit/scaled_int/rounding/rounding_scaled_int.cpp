@@ -96,6 +96,35 @@ namespace {
         static_assert(identical(dest_type{1}, dest_type{source_type{1.}}));
     }
 
+    namespace test_conversion_tie_to_even {
+        using source_type = rounding_scaled_integer<int, -2>;
+        using dest_type = rounding_scaled_integer<int, 0, cnl::tie_to_even_rounding_tag>;
+
+        static_assert(identical(dest_type{-2}, dest_type{source_type{-1.5}}));
+        static_assert(identical(dest_type{0}, dest_type{source_type{-.5}}));
+        static_assert(identical(dest_type{0}, dest_type{source_type{.5}}));
+        static_assert(identical(dest_type{1}, dest_type{source_type{.75}}));
+        static_assert(identical(dest_type{2}, dest_type{source_type{1.5}}));
+        static_assert(identical(dest_type{2}, dest_type{source_type{2.5}}));
+    }
+
+    namespace test_tie_to_even_decimal {
+        using micros = cnl::scaled_integer<
+                cnl::rounding_integer<std::int64_t, cnl::tie_to_even_rounding_tag>, cnl::power<-6, 10>>;
+        using cents = cnl::scaled_integer<
+                cnl::rounding_integer<std::int64_t, cnl::tie_to_even_rounding_tag>, cnl::power<-2, 10>>;
+
+        static_assert(identical(cents{0.12}, cents{micros{0.125}}));
+        static_assert(identical(cents{0.14}, cents{micros{0.135}}));
+        static_assert(identical(cents{-0.12}, cents{micros{-0.125}}));
+        static_assert(identical(cents{0.13}, cents{micros{0.125001}}));
+        static_assert(identical(micros{0.000002}, micros{0.0000025}));
+        static_assert(identical(micros{0.000004}, micros{0.0000035}));
+
+        static_assert(identical(micros{0.000002}, micros{micros{0.000005} / 2}));
+        static_assert(identical(micros{-0.000004}, micros{micros{-0.000007} / 2}));
+    }
+
     namespace test_jokes {
         using nearest_tens =
                 cnl::scaled_integer<cnl::rounding_integer<>, cnl::power<1, 10>>;
@@ -349,6 +349,24 @@ namespace test_descale {
         ASSERT_EQ(ex.significand, ac.significand);
         ASSERT_EQ(ex.exponent, ac.exponent);
     }
+
+    TEST(descale, 63_positive_max)  // NOLINT
+    {
+        auto const ex{cnl::_impl::descaled<int64, 10>{2147483647999999987, -9}};
+        auto const ac{cnl::_impl::descale<int64>(std::numeric_limits<int64>::max(), cnl::power<-32>{})};
+        cnl::_impl::assert_same(ex, ac);
+        ASSERT_EQ(ex.significand, ac.significand);
+        ASSERT_EQ(ex.exponent, ac.exponent);
+    }
+
+    TEST(descale, 63_negative_tinyexp)  // NOLINT
+    {
+        auto const ex{cnl::_impl::descaled<int64, 10>{-973848787495339063, -44}};
+        auto const ac{cnl::_impl::descale<int64>(int64{-12345}, cnl::power<-100>{})};
+        cnl::_impl::assert_same(ex, ac);
+        ASSERT_EQ(ex.significand, ac.significand);
+        ASSERT_EQ(ex.exponent, ac.exponent);
+    }
 }
 
 #endif  // CNL_TEST_FIXED_POINT_TO_CHARS_H
@@ -0,0 +1,160 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/scaled_integer/trig.h>
+
+#include <cnl/_impl/scaled_integer/trig.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+
+using cnl::power;
+using cnl::scaled_integer;
+using cnl::_impl::identical;
+
+namespace {
+    using s15_16 = scaled_integer<std::int32_t, power<-16>>;
+    using s3_28 = scaled_integer<std::int32_t, power<-28>>;
+    using s31_32 = scaled_integer<std::int64_t, power<-32>>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // compile-time evaluation
+
+    static_assert(identical(s15_16{0}, cnl::sin(s15_16{0})));
+    static_assert(identical(s15_16{1}, cnl::cos(s15_16{0})));
+    static_assert(identical(s15_16{0}, cnl::tan(s15_16{0})));
+    static_assert(identical(s15_16{0}, cnl::atan(s15_16{0})));
+    static_assert(identical(s15_16{0}, cnl::atan2(s15_16{0}, s15_16{0})));
+
+    // round(sin(0.5) * 2^16)
+    static_assert(identical(cnl::_impl::from_rep<s15_16>(31420), cnl::sin(s15_16{0.5})));
+
+    // round(cos(-1) * 2^28)
+    static_assert(identical(cnl::_impl::from_rep<s3_28>(145036296), cnl::cos(s3_28{-1})));
+
+    // round(tan(1) * 2^16)
+    static_assert(identical(cnl::_impl::from_rep<s15_16>(102066), cnl::tan(s15_16{1})));
+
+    // round(atan(1) * 2^28)
+    static_assert(identical(cnl::_impl::from_rep<s3_28>(210828714), cnl::atan(s3_28{1})));
+
+    // round(pi * 2^28) and round(-pi/2 * 2^28)
+    static_assert(identical(cnl::_impl::from_rep<s3_28>(843314857), cnl::atan2(s3_28{0}, s3_28{-1})));
+    static_assert(identical(cnl::_impl::from_rep<s3_28>(-421657428), cnl::atan2(s3_28{-1}, s3_28{0})));
+
+    // integer results
+    static_assert(identical(scaled_integer<int>{-1}, cnl::sin(scaled_integer<int>{-2})));
+    static_assert(identical(scaled_integer<int>{2}, cnl::atan(scaled_integer<int>{1000000})));
+
+    // angles much greater than one turn
+    static_assert(identical(
+            cnl::_impl::from_rep<s31_32>(INT64_C(2344379764)),
+            cnl::sin(s31_32{INT64_C(1000000000)})));
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison with long double
+
+    // checks that f(x) is within one ULP of reference(x) for values of x throughout [first, last)
+    template<typename Number, typename Function, typename Reference>
+    void test_against_long_double(
+            Function const& f, Reference const& reference, long double first, long double last,
+            long double max_abs_result)
+    {
+        constexpr auto num_samples{20000};
+        constexpr auto exponent{cnl::_impl::tag_of_t<Number>::exponent};
+        auto const ulp{std::ldexp(1.L, exponent)};
+        for (auto i{0}; i < num_samples; ++i) {
+            auto const x{Number{first + (last - first) * i / num_samples}};
+            auto const expected{reference(static_cast<long double>(x))};
+            if (std::fabs(expected) > max_abs_result) {
+                continue;
+            }
+            auto const actual{static_cast<long double>(f(x))};
+            ASSERT_LE(std::fabs(actual - expected), ulp) << static_cast<long double>(x);
+        }
+    }
+
+    template<typename Number>
+    void test_trig_against_long_double(long double range)
+    {
+        using limits = std::numeric_limits<Number>;
+        auto const max{static_cast<long double>(limits::max())};
+        constexpr auto exponent{cnl::_impl::tag_of_t<Number>::exponent};
+
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::sin(x); }, [](long double x) { return std::sin(x); },
+                -range, range, max);
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::cos(x); }, [](long double x) { return std::cos(x); },
+                -range, range, max);
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::tan(x); }, [](long double x) { return std::tan(x); },
+                -range, range, std::min(max, std::sqrt(std::ldexp(1.L, 56 + exponent))));
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::atan(x); }, [](long double x) { return std::atan(x); },
+                -range, range, max);
+
+        auto const y{Number{-0.3}};
+        test_against_long_double<Number>(
+                [y](Number const& x) { return cnl::atan2(y, x); },
+                [y](long double x) { return std::atan2(static_cast<long double>(y), x); }, -range, range,
+                max);
+        test_against_long_double<Number>(
+                [](Number const& x) { return cnl::atan2(x, Number{-2.}); },
+                [](long double x) { return std::atan2(x, -2.L); }, -range, range, max);
+    }
+
+    TEST(scaled_integer_trig, s3_4)  // NOLINT
+    {
+        test_trig_against_long_double<scaled_integer<std::int8_t, power<-4>>>(7.9L);
+    }
+
+    TEST(scaled_integer_trig, s3_12)  // NOLINT
+    {
+        test_trig_against_long_double<scaled_integer<std::int16_t, power<-12>>>(7.9L);
+    }
+
+    TEST(scaled_integer_trig, s15_16)  // NOLINT
+    {
+        test_trig_against_long_double<s15_16>(30000.L);
+    }
+
+    TEST(scaled_integer_trig, s3_28)  // NOLINT
+    {
+        test_trig_against_long_double<s3_28>(7.9L);
+    }
+
+    TEST(scaled_integer_trig, s31_32)  // NOLINT
+    {
+        test_trig_against_long_double<s31_32>(1e9L);
+    }
+
+    TEST(scaled_integer_trig, s7_56)  // NOLINT
+    {
+        test_trig_against_long_double<scaled_integer<std::int64_t, power<-56>>>(100.L);
+    }
+
+    TEST(scaled_integer_trig, s63)  // NOLINT
+    {
+        test_trig_against_long_double<scaled_integer<std::int64_t>>(1e18L);
+    }
+
+    TEST(scaled_integer_trig, u2_30)  // NOLINT
+    {
+        using u2_30 = scaled_integer<std::uint32_t, power<-30>>;
+        test_against_long_double<u2_30>(
+                [](u2_30 const& x) { return cnl::sin(x); }, [](long double x) { return std::sin(x); }, 0.L,
+                3.1L, 4.L);
+        test_against_long_double<u2_30>(
+                [](u2_30 const& x) { return cnl::atan(x); }, [](long double x) { return std::atan(x); }, 0.L,
+                3.9L, 4.L);
+    }
+}
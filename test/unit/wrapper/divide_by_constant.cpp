@@ -0,0 +1,177 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/wrapper/divide_by_constant.h>
+
+#include <cnl/_impl/wrapper/divide_by_constant.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/constant.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using cnl::_impl::identical;
+
+namespace {
+    // the result of dividing by a run-time divisor with the same value
+    template<auto Value, typename Numerator>
+    [[nodiscard]] constexpr auto expected(Numerator const& numerator)
+    {
+        return numerator / cnl::_impl::from_value<Numerator>(cnl::constant<Value>{});
+    }
+
+    template<auto Value, typename Numerator>
+    [[nodiscard]] constexpr auto actual(Numerator const& numerator)
+    {
+        return numerator / cnl::constant<Value>{};
+    }
+
+    template<typename Number, auto... Values>
+    void test_against_variable(int first, int last)
+    {
+        for (auto numerator{first}; numerator < last; ++numerator) {
+            auto const n{Number{numerator}};
+            ASSERT_TRUE((identical(expected<Values>(n), actual<Values>(n)) && ...)) << numerator;
+        }
+    }
+
+    namespace test_rounding_integer {
+        using nearest = cnl::rounding_integer<int, cnl::nearest_rounding_tag>;
+        static_assert(identical(nearest{2}, nearest{5} / cnl::constant<3>{}));
+        static_assert(identical(nearest{-2}, nearest{-5} / cnl::constant<3>{}));
+        static_assert(identical(nearest{-1}, nearest{-4} / cnl::constant<3>{}));
+
+        using neg_inf = cnl::rounding_integer<int, cnl::neg_inf_rounding_tag>;
+        static_assert(identical(neg_inf{1}, neg_inf{5} / cnl::constant<3>{}));
+        static_assert(identical(neg_inf{-2}, neg_inf{-5} / cnl::constant<3>{}));
+        static_assert(identical(neg_inf{-2}, neg_inf{-6} / cnl::constant<3>{}));
+
+        using native = cnl::rounding_integer<int, cnl::native_rounding_tag>;
+        static_assert(identical(native{-1}, native{-5} / cnl::constant<3>{}));
+
+        using unsigned_nearest = cnl::rounding_integer<unsigned, cnl::nearest_rounding_tag>;
+        static_assert(identical(unsigned_nearest{2}, unsigned_nearest{5} / cnl::constant<3>{}));
+
+        TEST(divide_by_constant, nearest_rounding_tag)  // NOLINT
+        {
+            test_against_variable<nearest, 1, 2, 3, 7, 10, 64, 1000>(-3000, 3000);
+        }
+
+        TEST(divide_by_constant, neg_inf_rounding_tag)  // NOLINT
+        {
+            test_against_variable<neg_inf, 1, 2, 3, 7, 10, 64, 1000>(-3000, 3000);
+        }
+
+        TEST(divide_by_constant, native_rounding_tag)  // NOLINT
+        {
+            test_against_variable<native, 1, 2, 3, 7, 10, 64, 1000>(-3000, 3000);
+        }
+
+        TEST(divide_by_constant, tie_to_pos_inf_rounding_tag)  // NOLINT
+        {
+            using tie_to_pos_inf = cnl::rounding_integer<int, cnl::tie_to_pos_inf_rounding_tag>;
+            test_against_variable<tie_to_pos_inf, 2, 3, 10>(-300, 300);
+        }
+    }
+
+    namespace test_overflow_integer {
+        using saturated = cnl::overflow_integer<std::int16_t, cnl::saturated_overflow_tag>;
+        static_assert(identical(
+                cnl::overflow_integer<int, cnl::saturated_overflow_tag>{-4681},
+                saturated{INT16_MIN} / cnl::constant<7>{}));
+
+        TEST(divide_by_constant, overflow_integer)  // NOLINT
+        {
+            test_against_variable<saturated, 1, 3, 7, 10, 1000, 32767, 40000>(INT16_MIN, INT16_MAX + 1);
+        }
+    }
+
+    namespace test_elastic_integer {
+        static_assert(identical(cnl::elastic_integer<20>{-71428}, cnl::elastic_integer<20>{-500000} / cnl::constant<7>{}));
+        static_assert(identical(
+                cnl::elastic_integer<20>{71428},
+                cnl::elastic_integer<20, unsigned>{500000} / cnl::constant<7>{}));
+
+        TEST(divide_by_constant, elastic_integer)  // NOLINT
+        {
+            test_against_variable<cnl::elastic_integer<12>, 1, 3, 7, 10, 4095, 4096>(-4095, 4096);
+            test_against_variable<cnl::elastic_integer<12, unsigned>, 1, 3, 7, 10, 4095, 4096>(0, 4096);
+        }
+    }
+
+    namespace test_wide_integer {
+        static_assert(identical(cnl::wide_integer<255>{-71428}, cnl::wide_integer<255>{-500000} / cnl::constant<7>{}));
+        static_assert(identical(
+                cnl::wide_integer<210>{1} << 190,
+                (cnl::wide_integer<210, unsigned>{1} << 200) / cnl::constant<1024>{}));
+
+        TEST(divide_by_constant, wide_integer)  // NOLINT
+        {
+            using wide = cnl::wide_integer<255>;
+            auto n{(wide{1} << 254) - wide{1}};
+            for (auto i{0}; i < 254; ++i, n >>= 1) {
+                ASSERT_TRUE(identical(expected<3>(n), actual<3>(n)));
+                ASSERT_TRUE(identical(expected<3>(-n), actual<3>(-n)));
+                ASSERT_TRUE(identical(expected<1000000007>(n), actual<1000000007>(n)));
+                ASSERT_TRUE(identical(expected<1000000007>(-n), actual<1000000007>(-n)));
+            }
+        }
+    }
+
+    namespace test_composite {
+        using rounding_elastic = cnl::rounding_integer<cnl::elastic_integer<20>>;
+        static_assert(identical(rounding_elastic{-71429}, rounding_elastic{-500000} / cnl::constant<7>{}));
+
+        using namespace cnl::literals;
+        static_assert(identical(cnl::rounding_integer<int>{33}, cnl::rounding_integer<int>{100} / 3_c));
+
+        // the constant becomes a scaled_integer with a different exponent
+        using q15_16 = cnl::scaled_integer<std::int32_t, cnl::power<-16>>;
+        static_assert(identical(expected<4>(q15_16{7.5}), actual<4>(q15_16{7.5})));
+    }
+
+    namespace test_multiword_rep {
+        template<typename Rep, auto Value>
+        void test_against_rep_operator(Rep numerator)
+        {
+            for (auto i{0}; i < cnl::digits_v<Rep>; ++i, numerator >>= 1) {
+                ASSERT_TRUE((numerator / Rep{Value} == cnl::_impl::divide_by_constant<Rep, Value>{}(numerator)));
+                if constexpr (cnl::numbers::signedness_v<Rep>) {
+                    ASSERT_TRUE((-numerator / Rep{Value} == cnl::_impl::divide_by_constant<Rep, Value>{}(-numerator)));
+                }
+            }
+        }
+
+        TEST(divide_by_constant, uintwide)  // NOLINT
+        {
+            using signed_rep = cnl::_impl::rep_of_t<cnl::wide_integer<255>>;
+            test_against_rep_operator<signed_rep, 10>(~signed_rep{} >> 1);
+            test_against_rep_operator<signed_rep, 0x7FFFFFFF>(~signed_rep{} >> 1);
+
+            using unsigned_rep = cnl::_impl::rep_of_t<cnl::wide_integer<256, unsigned>>;
+            test_against_rep_operator<unsigned_rep, 10>(~unsigned_rep{});
+            test_against_rep_operator<unsigned_rep, 0xFFFFFFFFU>(~unsigned_rep{});
+        }
+
+        TEST(divide_by_constant, duplex_integer)  // NOLINT
+        {
+            using signed_rep = cnl::_impl::narrowest_integer_t<255, cnl::intmax_t>;
+            test_against_rep_operator<signed_rep, 10>(~signed_rep{} >> 1);
+            test_against_rep_operator<signed_rep, 0x7FFFFFFF>(~signed_rep{} >> 1);
+
+            using unsigned_rep = cnl::_impl::narrowest_integer_t<256, cnl::uintmax_t>;
+            test_against_rep_operator<unsigned_rep, 10>(~unsigned_rep{});
+            test_against_rep_operator<unsigned_rep, 0xFFFFFFFFU>(~unsigned_rep{});
+        }
+    }
+}